@@ -0,0 +1,30 @@
+#include "BoatControl.h"
+
+BoatControl::BoatControl(const MotorMixerConfig& config)
+    : motorMixer(config), command(), lost(false) {
+}
+
+void BoatControl::setCommand(const struct_message& msg) {
+    command = msg;
+}
+
+void BoatControl::setLinkLost(bool linkLost) {
+    lost = linkLost;
+}
+
+MotorSpeeds BoatControl::step() {
+    if (command.trigger) {
+        // Zatrzymanie silników, gdy trigger jest aktywny
+        motorMixer.stop();
+        return motorMixer.step(0, 0);
+    }
+    if (lost) {
+        // Failsafe: łagodne zatrzymanie silników przy braku pakietów
+        return motorMixer.step(0, 0);
+    }
+
+    // Docelowe prędkości z komendy, wygładzane dla soft start/end
+    int target1, target2;
+    motorMixer.mix(command.up, command.down, command.left, command.right, target1, target2);
+    return motorMixer.step(target1, target2);
+}
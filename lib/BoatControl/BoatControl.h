@@ -0,0 +1,56 @@
+// ============================================================================
+// Logika sterowania silnikami łodzi (niezależna od sprzętu)
+// ============================================================================
+#ifndef BOAT_CONTROL_H
+#define BOAT_CONTROL_H
+
+#include <stdint.h>
+#include <BoatLink.h>
+#include <MotorMixer.h>
+
+/**
+ * Miesza komendę z kontrolera na prędkości silników i wygładza je
+ * w stałym okresie pętli sterowania (soft start/end). Tempo rampy zależy
+ * wyłącznie od liczby wywołań step(), a nie od momentu nadejścia pakietów.
+ * Przy utracie łącza (failsafe) silniki zwalniają do zera tą samą rampą.
+ */
+class BoatControl {
+public:
+    /**
+     * @param config Krzywe osi, ograniczenie narastania i okres pętli sterowania
+     */
+    explicit BoatControl(const MotorMixerConfig& config);
+
+    /**
+     * Ustawia nową komendę z kontrolera (obowiązuje do kolejnej komendy)
+     * @param msg Odebrana struktura danych
+     */
+    void setCommand(const struct_message& msg);
+
+    /**
+     * Włącza lub wyłącza failsafe utraty łącza. Ostatnia komenda jest
+     * zachowywana i obowiązuje ponownie po powrocie łącza.
+     * @param lost true, jeśli łącze zostało utracone
+     */
+    void setLinkLost(bool lost);
+    bool linkLost() const { return lost; }
+
+    /**
+     * Wykonuje jeden okres pętli sterowania
+     * @return Docelowe i bieżące prędkości obu silników
+     */
+    MotorSpeeds step();
+
+    int currentSpeed1() const { return motorMixer.speed1(); }
+    int currentSpeed2() const { return motorMixer.speed2(); }
+
+    // Mikser (także przeliczenie prędkości na PWM)
+    const MotorMixer& mixer() const { return motorMixer; }
+
+private:
+    MotorMixer motorMixer;
+    struct_message command;
+    bool lost;  // Failsafe aktywny - cel prędkości równy zero
+};
+
+#endif
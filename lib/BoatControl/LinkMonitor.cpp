@@ -0,0 +1,57 @@
+#include "LinkMonitor.h"
+
+LinkMonitor::LinkMonitor(uint32_t timeoutMs, uint32_t rateWindowMs)
+    : timeoutMs(timeoutMs), rateWindowMs(rateWindowMs), lastSeenMs(0), seen(false),
+      packets(0), longestGapMs(0), gapHistogram(), windowStartMs(0), windowCount(0), lastRate(0) {
+}
+
+void LinkMonitor::notePacket(uint32_t nowMs) {
+    if (seen.load(std::memory_order_relaxed)) {
+        // Klasyfikacja odstępu od poprzedniego pakietu
+        uint32_t gap = nowMs - lastSeenMs.load(std::memory_order_relaxed);
+        int bucket = 0;
+        while (bucket < LINK_GAP_BUCKETS - 1 && gap >= LINK_GAP_LIMITS[bucket]) bucket++;
+        gapHistogram[bucket]++;
+        if (gap > longestGapMs) longestGapMs = gap;
+    } else {
+        windowStartMs = nowMs;
+    }
+
+    // Zamknięcie okna częstotliwości (dłuższa cisza zeruje wynik)
+    uint32_t elapsed = nowMs - windowStartMs;
+    if (elapsed >= rateWindowMs) {
+        lastRate = elapsed < 2 * rateWindowMs ? windowCount * 1000 / elapsed : 0;
+        windowStartMs = nowMs;
+        windowCount = 0;
+    }
+    windowCount++;
+    packets++;
+
+    lastSeenMs.store(nowMs, std::memory_order_relaxed);
+    seen.store(true, std::memory_order_release);
+}
+
+bool LinkMonitor::isLost(uint32_t nowMs) const {
+    if (!seen.load(std::memory_order_acquire)) return true;
+    return nowMs - lastSeenMs.load(std::memory_order_relaxed) > timeoutMs;
+}
+
+LinkStats LinkMonitor::stats(uint32_t nowMs) const {
+    LinkStats out;
+    bool hasPackets = seen.load(std::memory_order_acquire);
+    out.packets = packets;
+    out.lastSeenAgeMs = hasPackets ? nowMs - lastSeenMs.load(std::memory_order_relaxed) : UINT32_MAX;
+    out.longestGapMs = longestGapMs;
+    for (int i = 0; i < LINK_GAP_BUCKETS; i++) out.gapHistogram[i] = gapHistogram[i];
+
+    // Częstotliwość z poprzedniego okna, o ile bieżące jeszcze trwa
+    uint32_t elapsed = nowMs - windowStartMs;
+    if (!hasPackets || elapsed >= 2 * rateWindowMs) {
+        out.packetRate = 0;
+    } else if (elapsed >= rateWindowMs) {
+        out.packetRate = windowCount * 1000 / elapsed;
+    } else {
+        out.packetRate = lastRate;
+    }
+    return out;
+}
@@ -0,0 +1,70 @@
+// ============================================================================
+// Nadzór łącza ESP-NOW po stronie łodzi (watchdog utraty łącza i statystyki)
+// ============================================================================
+#ifndef LINK_MONITOR_H
+#define LINK_MONITOR_H
+
+#include <atomic>
+#include <stdint.h>
+
+// Przedziały histogramu odstępów między pakietami (górne granice w ms)
+const int LINK_GAP_BUCKETS = 6;
+const uint32_t LINK_GAP_LIMITS[LINK_GAP_BUCKETS - 1] = {50, 100, 200, 500, 1000}; // Ostatni: >= 1000
+
+// Migawka statystyk łącza
+struct LinkStats {
+    uint32_t packets;                        // Wszystkie odnotowane pakiety
+    uint32_t packetRate;                     // Pakiety na sekundę w ostatnim pełnym oknie
+    uint32_t lastSeenAgeMs;                  // Czas od ostatniego pakietu (UINT32_MAX - brak pakietów)
+    uint32_t longestGapMs;                   // Najdłuższy zaobserwowany odstęp
+    uint32_t gapHistogram[LINK_GAP_BUCKETS]; // Liczba odstępów w przedziałach LINK_GAP_LIMITS
+};
+
+/**
+ * Odnotowuje czas nadejścia poprawnych pakietów i stwierdza utratę łącza,
+ * gdy od ostatniego minęło więcej niż timeoutMs. notePacket() wywołuje
+ * callback ESP-NOW, isLost() pętla sterowania - czas ostatniego pakietu
+ * jest atomowy, pozostałe liczniki służą tylko do diagnostyki.
+ */
+class LinkMonitor {
+public:
+    /**
+     * @param timeoutMs Czas bez pakietów, po którym łącze uznaje się za utracone
+     * @param rateWindowMs Długość okna liczenia częstotliwości pakietów
+     */
+    explicit LinkMonitor(uint32_t timeoutMs, uint32_t rateWindowMs = 1000);
+
+    /**
+     * Odnotowuje poprawny pakiet
+     * @param nowMs Bieżący czas odbiorcy
+     */
+    void notePacket(uint32_t nowMs);
+
+    /**
+     * @param nowMs Bieżący czas odbiorcy
+     * @return true, jeśli nie było jeszcze pakietu lub ostatni jest starszy niż timeoutMs
+     */
+    bool isLost(uint32_t nowMs) const;
+
+    /**
+     * @param nowMs Bieżący czas odbiorcy
+     * @return Statystyki łącza w chwili nowMs
+     */
+    LinkStats stats(uint32_t nowMs) const;
+
+    uint32_t timeout() const { return timeoutMs; }
+
+private:
+    uint32_t timeoutMs;
+    uint32_t rateWindowMs;
+    std::atomic<uint32_t> lastSeenMs;
+    std::atomic<bool> seen;
+    uint32_t packets;
+    uint32_t longestGapMs;
+    uint32_t gapHistogram[LINK_GAP_BUCKETS];
+    uint32_t windowStartMs; // Początek bieżącego okna częstotliwości
+    uint32_t windowCount;   // Pakiety w bieżącym oknie
+    uint32_t lastRate;      // Pakiety na sekundę w poprzednim oknie
+};
+
+#endif
@@ -0,0 +1,502 @@
+// ============================================================================
+// Format ramek ESP-NOW między kontrolerem a łodzią (wspólny dla obu stron)
+// ============================================================================
+#ifndef BOAT_LINK_H
+#define BOAT_LINK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Komenda sterująca z kontrolera
+// Użyto atrybutu packed, aby zapewnić spójny rozmiar struktury
+typedef struct __attribute__((packed)) struct_message {
+    uint8_t up;     // Prędkość do przodu (0-255)
+    uint8_t down;   // Prędkość do tyłu (0-255)
+    uint8_t left;   // Skręt w lewo (0-255)
+    uint8_t right;  // Skręt w prawo (0-255)
+    bool trigger;   // Stan przycisku wyzwalającego (true/false)
+} struct_message;
+
+/*
+ * Układ ramki (little-endian):
+ *   [0]     wersja formatu (LINK_VERSION)
+ *   [1]     typ ramki (LinkFrameType)
+ *   [2..3]  numer sekwencyjny
+ *   [4..7]  znacznik czasu nadawcy w ms (millis())
+ *   [...]   dane zależne od typu
+ *   [n-2..] CRC-16/CCITT-FALSE z wszystkich poprzednich bajtów
+ *
+ * Ramka KEEPALIVE ("bez zmian") zamiast komendy przenosi numer sekwencyjny
+ * ostatniej pełnej ramki CONTROL, którą potwierdza. Ramka TELEMETRY idzie
+ * w przeciwną stronę (łódź -> kontroler) i zbiera LINK_TELEMETRY_SAMPLES
+ * okresów pętli sterowania.
+ */
+const uint8_t LINK_VERSION = 1;
+const size_t LINK_HEADER_SIZE = 8;
+const size_t LINK_CRC_SIZE = 2;
+const size_t LINK_CONTROL_FRAME_SIZE = LINK_HEADER_SIZE + 5 + LINK_CRC_SIZE;   // 15 bajtów
+const size_t LINK_KEEPALIVE_FRAME_SIZE = LINK_HEADER_SIZE + 2 + LINK_CRC_SIZE; // 12 bajtów
+const uint8_t LINK_TELEMETRY_SAMPLES = 5; // Okresy sterowania w jednej ramce telemetrii
+const size_t LINK_TELEMETRY_PAYLOAD_SIZE = 1 + 1 + 4 + 4 * LINK_TELEMETRY_SAMPLES + 6 + 12 + 2;
+const size_t LINK_TELEMETRY_FRAME_SIZE = LINK_HEADER_SIZE + LINK_TELEMETRY_PAYLOAD_SIZE + LINK_CRC_SIZE; // 56 bajtów
+const size_t LINK_MAX_FRAME_SIZE = 250; // Limit ESP-NOW
+
+// Okresy nadawania kontrolera i limit ciszy łodzi - wspólne, żeby się nie rozjechały
+const uint32_t LINK_KEEPALIVE_MS = 100; // Ramka "bez zmian" przy niezmienionej komendzie
+const uint32_t LINK_REFRESH_MS = 200;   // Powtórzenie pełnej ramki na wypadek jej utraty
+const uint32_t LINK_TIMEOUT_MS = 500;   // Cisza dłuższa niż limit włącza failsafe łodzi
+static_assert(2 * LINK_REFRESH_MS < LINK_TIMEOUT_MS, "A lost CONTROL frame must be re-sent before the failsafe fires");
+
+enum LinkFrameType : uint8_t {
+    LINK_FRAME_CONTROL = 1,   // Pełna komenda sterująca
+    LINK_FRAME_KEEPALIVE = 2, // Komenda bez zmian
+    LINK_FRAME_TELEMETRY = 3, // Stan łodzi dla kontrolera
+};
+
+enum LinkDecodeResult : uint8_t {
+    LINK_OK,
+    LINK_ERR_LENGTH,  // Zła długość ramki dla danego typu
+    LINK_ERR_VERSION, // Nieobsługiwana wersja formatu
+    LINK_ERR_TYPE,    // Nieznany typ ramki
+    LINK_ERR_CRC,     // Niezgodna suma kontrolna
+};
+
+// Flagi stanu w ramce telemetrii
+const uint8_t LINK_TELEMETRY_FAILSAFE = 0x01; // Łódź nie odbiera komend (failsafe)
+
+// Telemetria łodzi z LINK_TELEMETRY_SAMPLES okresów pętli sterowania
+struct LinkTelemetry {
+    uint8_t sampleCount;                            // Liczba ważnych próbek prędkości
+    uint8_t flags;                                  // LINK_TELEMETRY_*
+    int16_t targetSpeed1;                           // Docelowe prędkości z ostatniego okresu
+    int16_t targetSpeed2;
+    int16_t speed1[LINK_TELEMETRY_SAMPLES];         // Bieżące prędkości w kolejnych okresach
+    int16_t speed2[LINK_TELEMETRY_SAMPLES];
+    uint16_t loopBusyMaxUs;                         // Najdłuższy czas wykonania pętli
+    uint32_t loopPeriodMaxUs;                       // Najdłuższy odstęp między wybudzeniami pętli
+    uint32_t accepted;                              // Liczniki łącza sterowania (LinkCounters)
+    uint32_t dropped;
+    uint32_t stale;
+    uint16_t batteryMv;                             // Napięcie akumulatora łodzi w mV
+};
+
+// Zdekodowana ramka
+struct LinkFrame {
+    uint8_t type;
+    uint16_t seq;
+    uint32_t timestampMs;
+    struct_message command;  // LINK_FRAME_CONTROL
+    uint16_t refSeq;         // LINK_FRAME_KEEPALIVE: potwierdzana ramka CONTROL
+    LinkTelemetry telemetry; // LINK_FRAME_TELEMETRY
+};
+
+// ============================================================================
+// Suma kontrolna i serializacja
+// ============================================================================
+
+/**
+ * CRC-16/CCITT-FALSE (wielomian 0x1021, start 0xFFFF), tablica półbajtowa
+ * @param data Dane wejściowe
+ * @param len Liczba bajtów
+ * @return Suma kontrolna
+ */
+inline uint16_t linkCrc16(const uint8_t* data, size_t len) {
+    static const uint16_t table[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    };
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc = (uint16_t)((crc << 4) ^ table[((crc >> 12) ^ (data[i] >> 4)) & 0x0F]);
+        crc = (uint16_t)((crc << 4) ^ table[((crc >> 12) ^ (data[i] & 0x0F)) & 0x0F]);
+    }
+    return crc;
+}
+
+inline void linkPut16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+inline void linkPut32(uint8_t* p, uint32_t v) {
+    linkPut16(p, (uint16_t)v);
+    linkPut16(p + 2, (uint16_t)(v >> 16));
+}
+
+inline uint16_t linkGet16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+inline uint32_t linkGet32(const uint8_t* p) {
+    return (uint32_t)linkGet16(p) | ((uint32_t)linkGet16(p + 2) << 16);
+}
+
+// Zapis nagłówka, zwraca wskaźnik na dane ramki
+inline uint8_t* linkPutHeader(uint8_t* buf, uint8_t type, uint16_t seq, uint32_t timestampMs) {
+    buf[0] = LINK_VERSION;
+    buf[1] = type;
+    linkPut16(buf + 2, seq);
+    linkPut32(buf + 4, timestampMs);
+    return buf + LINK_HEADER_SIZE;
+}
+
+// Dopisanie CRC za danymi, zwraca pełną długość ramki
+inline size_t linkSeal(uint8_t* buf, size_t payloadEnd) {
+    linkPut16(buf + payloadEnd, linkCrc16(buf, payloadEnd));
+    return payloadEnd + LINK_CRC_SIZE;
+}
+
+/**
+ * Koduje pełną ramkę komendy
+ * @param buf Bufor o rozmiarze co najmniej LINK_CONTROL_FRAME_SIZE
+ * @return Długość ramki w bajtach
+ */
+inline size_t linkEncodeControl(uint8_t* buf, uint16_t seq, uint32_t timestampMs, const struct_message& cmd) {
+    uint8_t* p = linkPutHeader(buf, LINK_FRAME_CONTROL, seq, timestampMs);
+    p[0] = cmd.up;
+    p[1] = cmd.down;
+    p[2] = cmd.left;
+    p[3] = cmd.right;
+    p[4] = cmd.trigger ? 1 : 0;
+    return linkSeal(buf, LINK_HEADER_SIZE + 5);
+}
+
+/**
+ * Koduje ramkę "bez zmian"
+ * @param buf Bufor o rozmiarze co najmniej LINK_KEEPALIVE_FRAME_SIZE
+ * @param refSeq Numer potwierdzanej ramki CONTROL
+ * @return Długość ramki w bajtach
+ */
+inline size_t linkEncodeKeepalive(uint8_t* buf, uint16_t seq, uint32_t timestampMs, uint16_t refSeq) {
+    uint8_t* p = linkPutHeader(buf, LINK_FRAME_KEEPALIVE, seq, timestampMs);
+    linkPut16(p, refSeq);
+    return linkSeal(buf, LINK_HEADER_SIZE + 2);
+}
+
+/**
+ * Koduje ramkę telemetrii
+ * @param buf Bufor o rozmiarze co najmniej LINK_TELEMETRY_FRAME_SIZE
+ * @return Długość ramki w bajtach
+ */
+inline size_t linkEncodeTelemetry(uint8_t* buf, uint16_t seq, uint32_t timestampMs, const LinkTelemetry& t) {
+    uint8_t* p = linkPutHeader(buf, LINK_FRAME_TELEMETRY, seq, timestampMs);
+    *p++ = t.sampleCount;
+    *p++ = t.flags;
+    linkPut16(p, (uint16_t)t.targetSpeed1);
+    linkPut16(p + 2, (uint16_t)t.targetSpeed2);
+    p += 4;
+    for (uint8_t i = 0; i < LINK_TELEMETRY_SAMPLES; i++, p += 4) {
+        linkPut16(p, (uint16_t)t.speed1[i]);
+        linkPut16(p + 2, (uint16_t)t.speed2[i]);
+    }
+    linkPut16(p, t.loopBusyMaxUs);
+    linkPut32(p + 2, t.loopPeriodMaxUs);
+    linkPut32(p + 6, t.accepted);
+    linkPut32(p + 10, t.dropped);
+    linkPut32(p + 14, t.stale);
+    linkPut16(p + 18, t.batteryMv);
+    return linkSeal(buf, LINK_HEADER_SIZE + LINK_TELEMETRY_PAYLOAD_SIZE);
+}
+
+// Odczyt danych ramki telemetrii (długość i CRC sprawdzone wcześniej)
+inline void linkDecodeTelemetry(const uint8_t* p, LinkTelemetry& t) {
+    t.sampleCount = p[0] < LINK_TELEMETRY_SAMPLES ? p[0] : LINK_TELEMETRY_SAMPLES;
+    t.flags = p[1];
+    t.targetSpeed1 = (int16_t)linkGet16(p + 2);
+    t.targetSpeed2 = (int16_t)linkGet16(p + 4);
+    p += 6;
+    for (uint8_t i = 0; i < LINK_TELEMETRY_SAMPLES; i++, p += 4) {
+        t.speed1[i] = (int16_t)linkGet16(p);
+        t.speed2[i] = (int16_t)linkGet16(p + 2);
+    }
+    t.loopBusyMaxUs = linkGet16(p);
+    t.loopPeriodMaxUs = linkGet32(p + 2);
+    t.accepted = linkGet32(p + 6);
+    t.dropped = linkGet32(p + 10);
+    t.stale = linkGet32(p + 14);
+    t.batteryMv = linkGet16(p + 18);
+}
+
+/**
+ * Sprawdza i dekoduje ramkę
+ * @param data Odebrane bajty
+ * @param len Liczba odebranych bajtów
+ * @param out Zdekodowana ramka (ważna tylko dla LINK_OK)
+ * @return LINK_OK lub przyczyna odrzucenia
+ */
+inline LinkDecodeResult linkDecode(const uint8_t* data, size_t len, LinkFrame& out) {
+    if (len < LINK_HEADER_SIZE + LINK_CRC_SIZE) return LINK_ERR_LENGTH;
+    if (data[0] != LINK_VERSION) return LINK_ERR_VERSION;
+
+    size_t expected;
+    switch (data[1]) {
+        case LINK_FRAME_CONTROL: expected = LINK_CONTROL_FRAME_SIZE; break;
+        case LINK_FRAME_KEEPALIVE: expected = LINK_KEEPALIVE_FRAME_SIZE; break;
+        case LINK_FRAME_TELEMETRY: expected = LINK_TELEMETRY_FRAME_SIZE; break;
+        default: return LINK_ERR_TYPE;
+    }
+    if (len != expected) return LINK_ERR_LENGTH;
+    if (linkGet16(data + len - LINK_CRC_SIZE) != linkCrc16(data, len - LINK_CRC_SIZE)) return LINK_ERR_CRC;
+
+    const uint8_t* p = data + LINK_HEADER_SIZE;
+    out.type = data[1];
+    out.seq = linkGet16(data + 2);
+    out.timestampMs = linkGet32(data + 4);
+    out.command = struct_message();
+    out.refSeq = 0;
+    if (out.type == LINK_FRAME_CONTROL) {
+        out.command.up = p[0];
+        out.command.down = p[1];
+        out.command.left = p[2];
+        out.command.right = p[3];
+        out.command.trigger = p[4] != 0;
+    } else if (out.type == LINK_FRAME_KEEPALIVE) {
+        out.refSeq = linkGet16(p);
+    } else {
+        linkDecodeTelemetry(p, out.telemetry);
+    }
+    return LINK_OK;
+}
+
+// ============================================================================
+// Nadawca (kontroler)
+// ============================================================================
+
+/**
+ * Decyduje, czy wysłać pełną komendę, ramkę "bez zmian", czy nic.
+ * Zmieniona komenda idzie od razu; niezmieniona tylko co keepaliveMs,
+ * a co refreshMs powtarzana jest pełna ramka na wypadek jej utraty.
+ */
+class LinkSender {
+public:
+    LinkSender(uint32_t keepaliveMs = LINK_KEEPALIVE_MS, uint32_t refreshMs = LINK_REFRESH_MS)
+        : keepaliveMs(keepaliveMs), refreshMs(refreshMs) {}
+
+    /**
+     * @param buf Bufor o rozmiarze co najmniej LINK_CONTROL_FRAME_SIZE
+     * @param cmd Bieżąca komenda
+     * @param nowMs Bieżący czas nadawcy
+     * @return Długość ramki do wysłania lub 0, jeśli nie trzeba nic wysyłać
+     */
+    size_t encode(uint8_t* buf, const struct_message& cmd, uint32_t nowMs) {
+        bool changed = !hasSent || !sameCommand(cmd, lastCommand);
+        if (changed || nowMs - lastControlMs >= refreshMs) {
+            lastCommand = cmd;
+            lastControlSeq = nextSeq;
+            lastControlMs = nowMs;
+            lastSentMs = nowMs;
+            hasSent = true;
+            return linkEncodeControl(buf, nextSeq++, nowMs, cmd);
+        }
+        if (nowMs - lastSentMs >= keepaliveMs) {
+            lastSentMs = nowMs;
+            return linkEncodeKeepalive(buf, nextSeq++, nowMs, lastControlSeq);
+        }
+        return 0;
+    }
+
+    uint16_t nextSequence() const { return nextSeq; }
+
+private:
+    static bool sameCommand(const struct_message& a, const struct_message& b) {
+        return a.up == b.up && a.down == b.down && a.left == b.left &&
+               a.right == b.right && a.trigger == b.trigger;
+    }
+
+    uint32_t keepaliveMs;
+    uint32_t refreshMs;
+    uint16_t nextSeq = 0;
+    uint16_t lastControlSeq = 0;
+    uint32_t lastControlMs = 0;
+    uint32_t lastSentMs = 0;
+    bool hasSent = false;
+    struct_message lastCommand = struct_message();
+};
+
+// ============================================================================
+// Telemetria (łódź)
+// ============================================================================
+
+/**
+ * Zbiera stan pętli sterowania z kolejnych okresów i oddaje pełną paczkę
+ * co LINK_TELEMETRY_SAMPLES okresów, więc telemetria zajmuje jedną ramkę
+ * na kilka okresów zamiast konkurować z ruchem sterującym.
+ */
+class LinkTelemetryBatch {
+public:
+    LinkTelemetryBatch() { reset(); }
+
+    /**
+     * Dodaje jeden okres pętli sterowania
+     * @param busyUs Czas wykonania pętli w tym okresie
+     * @param periodUs Odstęp od poprzedniego wybudzenia pętli
+     * @return true, jeśli paczka jest pełna i można ją wysłać
+     */
+    bool add(int targetSpeed1, int targetSpeed2, int speed1, int speed2, uint32_t busyUs, uint32_t periodUs) {
+        if (batch.sampleCount >= LINK_TELEMETRY_SAMPLES) reset();
+        uint8_t i = batch.sampleCount++;
+        batch.targetSpeed1 = (int16_t)targetSpeed1;
+        batch.targetSpeed2 = (int16_t)targetSpeed2;
+        batch.speed1[i] = (int16_t)speed1;
+        batch.speed2[i] = (int16_t)speed2;
+        uint16_t busy = busyUs > 0xFFFF ? 0xFFFF : (uint16_t)busyUs;
+        if (busy > batch.loopBusyMaxUs) batch.loopBusyMaxUs = busy;
+        if (periodUs > batch.loopPeriodMaxUs) batch.loopPeriodMaxUs = periodUs;
+        return batch.sampleCount == LINK_TELEMETRY_SAMPLES;
+    }
+
+    // Paczka do uzupełnienia licznikami łącza i napięciem przed wysłaniem
+    LinkTelemetry& telemetry() { return batch; }
+
+private:
+    void reset() {
+        batch = LinkTelemetry();
+    }
+
+    LinkTelemetry batch;
+};
+
+// ============================================================================
+// Odbiorca (łódź: sterowanie, kontroler: telemetria)
+// ============================================================================
+
+enum LinkVerdict : uint8_t {
+    LINK_ACCEPTED,   // Nowa ramka - użyć
+    LINK_DUPLICATE,  // Numer już widziany lub starszy (zmiana kolejności)
+    LINK_STALE,      // Ramka dotarła ze zbyt dużym opóźnieniem
+    LINK_DESYNC,     // KEEPALIVE potwierdza komendę, której nie mamy
+};
+
+// Liczniki jakości łącza
+struct LinkCounters {
+    uint32_t accepted;
+    uint32_t dropped;    // Luki w numeracji
+    uint32_t reordered;  // Ramki starsze od ostatniej przyjętej
+    uint32_t stale;      // Ramki spóźnione ponad staleMs
+    uint32_t desynced;   // KEEPALIVE bez znanej komendy
+    uint32_t resyncs;    // Restart nadawcy (nowa sesja)
+};
+
+/**
+ * Pilnuje kolejności ramek i wykrywa utracone, przestawione i spóźnione.
+ * Opóźnienie ramki liczone jest względem najmniejszej różnicy zegarów nadawcy
+ * i odbiorcy z ostatnich dwóch okien BASELINE_WINDOW_MS, więc zegary nie muszą
+ * być zsynchronizowane, a podstawa nadąża za dryfem kwarców.
+ *
+ * Restart nadawcy (numeracja i zegar od zera) rozpoznaje duży skok numeru
+ * wstecz albo seria odrzuconych ramek trwająca co najmniej staleMs - wtedy
+ * zaczyna się nowa sesja niezależnie od tego, na jakim numerze była stara.
+ */
+class LinkReceiver {
+public:
+    static const int16_t REORDER_WINDOW = 64;          // Większy skok wstecz = restart nadawcy
+    static const uint8_t RESYNC_REJECTS = 3;           // Odrzucone ramki z rzędu, po których zaczyna się nowa sesja
+    static const uint32_t BASELINE_WINDOW_MS = 10000;  // Okno minimum różnicy zegarów
+
+    explicit LinkReceiver(uint32_t staleMs = 200) : staleMs(staleMs) {}
+
+    /**
+     * @param frame Poprawnie zdekodowana ramka
+     * @param nowMs Bieżący czas odbiorcy
+     * @return Werdykt; tylko LINK_ACCEPTED oznacza ramkę do użycia
+     */
+    LinkVerdict accept(const LinkFrame& frame, uint32_t nowMs) {
+        int32_t offset = (int32_t)(nowMs - frame.timestampMs);
+
+        if (!hasLast) {
+            startSession(offset, nowMs);
+        } else {
+            int16_t diff = (int16_t)(frame.seq - lastSeq);
+            if (diff <= 0 && diff > -REORDER_WINDOW) {
+                if (!senderRestarted(nowMs)) {
+                    counters.reordered++;
+                    return LINK_DUPLICATE;
+                }
+                counters.resyncs++;      // Restart tuż po starcie, nowe numery w oknie
+                startSession(offset, nowMs);
+            } else if (diff <= -REORDER_WINDOW) {
+                counters.resyncs++;      // Nadawca zaczął od nowa
+                startSession(offset, nowMs);
+            } else {
+                counters.dropped += (uint32_t)(diff - 1);
+            }
+        }
+        hasLast = true;
+        lastSeq = frame.seq;
+
+        trackBaseline(offset, nowMs);
+        if ((uint32_t)(offset - minOffset) > staleMs) {
+            if (!senderRestarted(nowMs)) {
+                counters.stale++;
+                return LINK_STALE;
+            }
+            counters.resyncs++;          // Zegar nadawcy cofnięty, numer poszedł do przodu
+            startSession(offset, nowMs);
+        }
+        rejectRun = 0;
+
+        if (frame.type == LINK_FRAME_KEEPALIVE && (!hasControl || frame.refSeq != lastControlSeq)) {
+            counters.desynced++;
+            return LINK_DESYNC;
+        }
+        if (frame.type == LINK_FRAME_CONTROL) {
+            hasControl = true;
+            lastControlSeq = frame.seq;
+        }
+        counters.accepted++;
+        return LINK_ACCEPTED;
+    }
+
+    const LinkCounters& stats() const { return counters; }
+
+private:
+    // Nowa sesja nadawcy: bez komendy, podstawa różnicy zegarów od tej ramki
+    void startSession(int32_t offset, uint32_t nowMs) {
+        hasControl = false;
+        rejectRun = 0;
+        minOffset = windowMin = offset;
+        windowStartMs = nowMs;
+    }
+
+    /**
+     * Minimum różnicy zegarów z bieżącego i poprzedniego okna. Stare minimum
+     * wypada po dwóch oknach, więc podstawa podąża za dryfem zamiast tylko maleć.
+     */
+    void trackBaseline(int32_t offset, uint32_t nowMs) {
+        uint32_t elapsed = nowMs - windowStartMs;
+        if (elapsed >= BASELINE_WINDOW_MS) {
+            int32_t previousMin = elapsed >= 2 * BASELINE_WINDOW_MS ? offset : windowMin;
+            windowMin = offset;
+            windowStartMs = nowMs;
+            minOffset = previousMin < offset ? previousMin : offset;
+        } else {
+            if (offset < windowMin) windowMin = offset;
+            if (offset < minOffset) minOffset = offset;
+        }
+    }
+
+    /**
+     * Zlicza odrzuconą ramkę. Pojedyncze spóźnione lub powtórzone ramki, także
+     * w paczce, zostają odrzucone; restart nadawcy odrzuca wszystko przez dłużej niż staleMs.
+     * @return true, jeśli ramkę należy uznać za początek nowej sesji
+     */
+    bool senderRestarted(uint32_t nowMs) {
+        if (rejectRun == 0) rejectStartMs = nowMs;
+        if (rejectRun < RESYNC_REJECTS) rejectRun++;
+        return rejectRun >= RESYNC_REJECTS && nowMs - rejectStartMs >= staleMs;
+    }
+
+    uint32_t staleMs;
+    bool hasLast = false;
+    bool hasControl = false;
+    uint16_t lastSeq = 0;
+    uint16_t lastControlSeq = 0;
+    int32_t minOffset = 0;      // Podstawa: minimum z windowMin i poprzedniego okna
+    int32_t windowMin = 0;      // Minimum w bieżącym oknie
+    uint32_t windowStartMs = 0;
+    uint8_t rejectRun = 0;      // Odrzucone ramki z rzędu
+    uint32_t rejectStartMs = 0;
+    LinkCounters counters = LinkCounters();
+};
+
+#endif
@@ -0,0 +1,73 @@
+#include "BoatLog.h"
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+LogRing<BOAT_LOG_BUFFER_SIZE> boatLogRing;
+
+// Skróty poziomów w wypisywanych liniach
+static const char* const LEVEL_PREFIX[BOAT_LOG_LEVEL_COUNT] = {"[T] ", "[I] ", "[W] ", "[E] "};
+static const size_t LEVEL_PREFIX_LEN = 4;
+
+// Liczba pominiętych komunikatów już zgłoszonych przez boatLogFlush()
+static uint32_t reportedDropped = 0;
+
+void boatLogWrite(uint8_t level, const char* format, ...) {
+    char message[BOAT_LOG_MAX_MESSAGE + 1];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    if (len < 0) return;
+    boatLogRing.push(level, message, (size_t)len < BOAT_LOG_MAX_MESSAGE ? (size_t)len : BOAT_LOG_MAX_MESSAGE);
+}
+
+size_t boatLogFlush(Print& out) {
+    size_t written = 0;
+    char message[LogRing<BOAT_LOG_BUFFER_SIZE>::MAX_MESSAGE + 1];
+    uint8_t level = 0;
+
+    // Raport o pominiętych komunikatach ma pierwszeństwo przed kolejnymi
+    uint32_t dropped = boatLogRing.droppedTotal();
+    if (dropped != reportedDropped) {
+        int len = snprintf(message, sizeof(message), "[W] log: pominieto %lu komunikatow (T/I/W/E: %lu/%lu/%lu/%lu)\r\n",
+                           (unsigned long)(dropped - reportedDropped),
+                           (unsigned long)boatLogRing.dropped(BOAT_LOG_LEVEL_TRACE),
+                           (unsigned long)boatLogRing.dropped(BOAT_LOG_LEVEL_INFO),
+                           (unsigned long)boatLogRing.dropped(BOAT_LOG_LEVEL_WARN),
+                           (unsigned long)boatLogRing.dropped(BOAT_LOG_LEVEL_ERROR));
+        if (out.availableForWrite() < len) return written;
+        out.write(message);
+        reportedDropped = dropped;
+    }
+
+    int next;
+    while ((next = boatLogRing.peekLength()) >= 0 &&
+           out.availableForWrite() >= next + (int)LEVEL_PREFIX_LEN + 2) {
+        if (boatLogRing.pop(message, level) < 0) break;
+        out.write(LEVEL_PREFIX[level]);
+        out.write(message);
+        out.write("\r\n");
+        written++;
+    }
+    return written;
+}
+
+static const uint32_t LOG_TASK_STACK = 3072;      // Rozmiar stosu zadania w bajtach
+static const TickType_t LOG_TASK_PERIOD = pdMS_TO_TICKS(10);
+
+// Zadanie opróżniania bufora; działa tylko wtedy, gdy pozostałe zadania czekają
+static void boatLogTask(void* param) {
+    Print& out = *static_cast<Print*>(param);
+    for (;;) {
+        boatLogFlush(out);
+        vTaskDelay(LOG_TASK_PERIOD);
+    }
+}
+
+void boatLogBegin(Print& out) {
+    xTaskCreatePinnedToCore(boatLogTask, "log", LOG_TASK_STACK, &out, tskIDLE_PRIORITY, nullptr, tskNO_AFFINITY);
+}
@@ -0,0 +1,192 @@
+// ============================================================================
+// Nieblokujące logowanie przez bufor pierścieniowy (wspólne dla obu płytek)
+// ============================================================================
+#ifndef BOAT_LOG_H
+#define BOAT_LOG_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class Print;
+
+// Poziomy logowania (numeracja jak LV_LOG_LEVEL_*)
+#define BOAT_LOG_LEVEL_TRACE 0 // Dane z każdego pakietu i okresu pętli
+#define BOAT_LOG_LEVEL_INFO  1 // Zdarzenia i okresowe statystyki
+#define BOAT_LOG_LEVEL_WARN  2 // Nieoczekiwane, ale obsłużone sytuacje
+#define BOAT_LOG_LEVEL_ERROR 3 // Błędy
+#define BOAT_LOG_LEVEL_NONE  4 // Logowanie wyłączone
+#define BOAT_LOG_LEVEL_COUNT 4
+
+// Poziom ustalany przy kompilacji (np. -D BOAT_LOG_LEVEL=0), niższe poziomy nie trafiają do programu
+#ifndef BOAT_LOG_LEVEL
+#define BOAT_LOG_LEVEL BOAT_LOG_LEVEL_INFO
+#endif
+
+#ifndef BOAT_LOG_BUFFER_SIZE
+#define BOAT_LOG_BUFFER_SIZE 2048 // Rozmiar bufora w bajtach (potęga dwójki)
+#endif
+
+#define BOAT_LOG_MAX_MESSAGE 120 // Dłuższe komunikaty są obcinane
+
+/**
+ * Bufor pierścieniowy komunikatów: wielu producentów, jeden konsument.
+ * Producent nigdy nie czeka - przy braku miejsca lub równoczesnym zapisie
+ * z innego zadania komunikat jest pomijany i liczony w dropped().
+ * Rekord: [poziom][długość][tekst bez zakończenia zerem].
+ */
+template <size_t Capacity>
+class LogRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static const size_t MAX_MESSAGE = 255;
+
+    LogRing() : head(0), tail(0) {
+        writing.clear();
+        for (int i = 0; i < BOAT_LOG_LEVEL_COUNT; i++) droppedCount[i].store(0);
+    }
+
+    /**
+     * Dopisuje komunikat (wywołanie producenta, dowolne zadanie)
+     * @param level Poziom BOAT_LOG_LEVEL_*
+     * @param text Treść
+     * @param len Długość treści (obcinana do MAX_MESSAGE)
+     * @return false, jeśli komunikat pominięto
+     */
+    bool push(uint8_t level, const char* text, size_t len) {
+        if (level >= BOAT_LOG_LEVEL_COUNT) level = BOAT_LOG_LEVEL_ERROR;
+        if (len > MAX_MESSAGE) len = MAX_MESSAGE;
+        if (writing.test_and_set(std::memory_order_acquire)) {
+            drop(level);
+            return false;
+        }
+        size_t h = head.load(std::memory_order_relaxed);
+        if (Capacity - (h - tail.load(std::memory_order_acquire)) < len + 2) {
+            writing.clear(std::memory_order_release);
+            drop(level);
+            return false;
+        }
+        buffer[h & MASK] = level;
+        buffer[(h + 1) & MASK] = (uint8_t)len;
+        copyIn(h + 2, text, len);
+        head.store(h + len + 2, std::memory_order_release);
+        writing.clear(std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return Długość najstarszego komunikatu lub -1, jeśli bufor jest pusty
+     */
+    int peekLength() const {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return -1;
+        return buffer[(t + 1) & MASK];
+    }
+
+    /**
+     * Pobiera najstarszy komunikat (wywołanie jedynego konsumenta)
+     * @param out Bufor na co najmniej MAX_MESSAGE + 1 znaków, zakończony zerem
+     * @param level Poziom komunikatu
+     * @return Długość komunikatu lub -1, jeśli bufor jest pusty
+     */
+    int pop(char* out, uint8_t& level) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return -1;
+        level = buffer[t & MASK];
+        size_t len = buffer[(t + 1) & MASK];
+        copyOut(out, t + 2, len);
+        out[len] = '\0';
+        tail.store(t + len + 2, std::memory_order_release);
+        return (int)len;
+    }
+
+    uint32_t dropped(uint8_t level) const { return droppedCount[level].load(std::memory_order_relaxed); }
+
+    uint32_t droppedTotal() const {
+        uint32_t total = 0;
+        for (int i = 0; i < BOAT_LOG_LEVEL_COUNT; i++) total += dropped(i);
+        return total;
+    }
+
+private:
+    static const size_t MASK = Capacity - 1;
+
+    void drop(uint8_t level) { droppedCount[level].fetch_add(1, std::memory_order_relaxed); }
+
+    void copyIn(size_t pos, const char* text, size_t len) {
+        size_t start = pos & MASK;
+        size_t first = len < Capacity - start ? len : Capacity - start;
+        memcpy(buffer + start, text, first);
+        memcpy(buffer, text + first, len - first);
+    }
+
+    void copyOut(char* out, size_t pos, size_t len) const {
+        size_t start = pos & MASK;
+        size_t first = len < Capacity - start ? len : Capacity - start;
+        memcpy(out, buffer + start, first);
+        memcpy(out + first, buffer, len - first);
+    }
+
+    uint8_t buffer[Capacity];
+    std::atomic<size_t> head;  // Zapisywane przez producenta pod flagą writing
+    std::atomic<size_t> tail;  // Zapisywane tylko przez konsumenta
+    std::atomic_flag writing;
+    std::atomic<uint32_t> droppedCount[BOAT_LOG_LEVEL_COUNT];
+};
+
+// Wspólny bufor logów programu
+extern LogRing<BOAT_LOG_BUFFER_SIZE> boatLogRing;
+
+/**
+ * Formatuje komunikat (jak printf) i dopisuje go do bufora bez blokowania.
+ * Zwykle wywoływane przez makra BOAT_LOG_*, które usuwają wyłączone poziomy.
+ * @param level Poziom BOAT_LOG_LEVEL_*
+ */
+void boatLogWrite(uint8_t level, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+/**
+ * Przepisuje komunikaty z bufora do wyjścia, tylko dopóki mieści się ono
+ * w wolnym miejscu nadajnika (availableForWrite), więc nigdy nie czeka na UART.
+ * Raportuje też liczbę komunikatów pominiętych od poprzedniego raportu.
+ * @param out Wyjście (zwykle Serial)
+ * @return Liczba przepisanych komunikatów
+ */
+size_t boatLogFlush(Print& out);
+
+/**
+ * Uruchamia zadanie o priorytecie bezczynności opróżniające bufor do out
+ * @param out Wyjście (zwykle Serial)
+ */
+void boatLogBegin(Print& out);
+
+// Wyłączony poziom: wywołanie w martwej gałęzi - argumenty nie są liczone, ale nadal
+// są "użyte" (bez -Wunused-parameter) i sprawdzane z formatem, a kompilator usuwa kod
+#define BOAT_LOG_DISABLED(level, ...) do { if (0) boatLogWrite(level, __VA_ARGS__); } while (0)
+
+#if BOAT_LOG_LEVEL <= BOAT_LOG_LEVEL_TRACE
+#define BOAT_LOG_TRACE(...) boatLogWrite(BOAT_LOG_LEVEL_TRACE, __VA_ARGS__)
+#else
+#define BOAT_LOG_TRACE(...) BOAT_LOG_DISABLED(BOAT_LOG_LEVEL_TRACE, __VA_ARGS__)
+#endif
+
+#if BOAT_LOG_LEVEL <= BOAT_LOG_LEVEL_INFO
+#define BOAT_LOG_INFO(...) boatLogWrite(BOAT_LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define BOAT_LOG_INFO(...) BOAT_LOG_DISABLED(BOAT_LOG_LEVEL_INFO, __VA_ARGS__)
+#endif
+
+#if BOAT_LOG_LEVEL <= BOAT_LOG_LEVEL_WARN
+#define BOAT_LOG_WARN(...) boatLogWrite(BOAT_LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define BOAT_LOG_WARN(...) BOAT_LOG_DISABLED(BOAT_LOG_LEVEL_WARN, __VA_ARGS__)
+#endif
+
+#if BOAT_LOG_LEVEL <= BOAT_LOG_LEVEL_ERROR
+#define BOAT_LOG_ERROR(...) boatLogWrite(BOAT_LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define BOAT_LOG_ERROR(...) BOAT_LOG_DISABLED(BOAT_LOG_LEVEL_ERROR, __VA_ARGS__)
+#endif
+
+#endif
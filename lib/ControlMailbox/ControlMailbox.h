@@ -0,0 +1,64 @@
+// ============================================================================
+// Jednoelementowa skrzynka pocztowa bez blokad (single-slot mailbox)
+// ============================================================================
+#ifndef CONTROL_MAILBOX_H
+#define CONTROL_MAILBOX_H
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * Przechowuje zawsze tylko ostatnią wartość wpisaną przez producenta.
+ * Przeznaczona dla jednego producenta (callback ESP-NOW w zadaniu Wi-Fi)
+ * i jednego konsumenta (zadanie pętli sterowania). Zapis nigdy nie czeka,
+ * a odczyt nie blokuje producenta - spójność kopii zapewnia licznik sekwencji
+ * (seqlock): nieparzysta wartość oznacza zapis w toku.
+ */
+template <typename T>
+class ControlMailbox {
+public:
+    /**
+     * Zapisuje nową wartość, nadpisując poprzednią (wywołanie producenta)
+     * @param value Wartość do opublikowania
+     */
+    void push(const T& value) {
+        uint32_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&slot, &value, sizeof(T));
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * Pobiera ostatnią wartość, jeśli pojawiła się od poprzedniego pobrania
+     * (wywołanie konsumenta)
+     * @param out Miejsce na skopiowaną wartość
+     * @return true, jeśli skopiowano nową wartość
+     */
+    bool take(T& out) {
+        for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+            uint32_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1u) continue;          // Zapis w toku
+            if (before == lastTaken) return false; // Brak nowych danych
+            T copy;
+            memcpy(&copy, &slot, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                out = copy;
+                lastTaken = before;
+                return true;
+            }
+        }
+        return false; // Producent cały czas pisał - spróbujemy w kolejnym okresie
+    }
+
+private:
+    static const int MAX_READ_ATTEMPTS = 4;
+
+    std::atomic<uint32_t> sequence{0}; // Licznik zapisów (x2)
+    T slot;                            // Ostatnia opublikowana wartość
+    uint32_t lastTaken = 0;            // Sekwencja ostatnio pobranej wartości (tylko konsument)
+};
+
+#endif
@@ -0,0 +1,49 @@
+#include "DisplayFlush.h"
+#include <Arduino.h>
+
+// Stały koszt odświeżenia obszaru (przejście drzewa obiektów, flush, DMA)
+// wyrażony w pikselach - najszybszy wynik w test_area_join_benchmark
+static const uint32_t AREA_OVERHEAD_PX = 1000;
+
+DisplayFlush::DisplayFlush(TFT_eSPI& tft) : tft(tft), display(nullptr), flushCount(0) {
+}
+
+bool DisplayFlush::begin(lv_display_t* disp, void* buf1, void* buf2, uint32_t bufBytes) {
+    if (!tft.initDMA()) return false;
+    display = disp;
+
+    // LVGL rysuje od razu w kolejności big-endian - DMA wysyła bufor bez zamiany i kopiowania
+    tft.setSwapBytes(false);
+    tft.setDMACompleteCallback(transferDone, this);
+
+    // Ekran jest sam na swojej magistrali SPI, więc transakcja pozostaje otwarta
+    tft.startWrite();
+
+    lv_display_set_user_data(disp, this);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565_SWAPPED);  // Przed buforami (stride)
+    lv_display_set_buffers(disp, buf1, buf2, bufBytes, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flushCb);
+    lv_display_set_flush_wait_cb(disp, waitCb);
+    lv_display_set_area_overhead(disp, AREA_OVERHEAD_PX);
+    return true;
+}
+
+void DisplayFlush::flushCb(lv_display_t* disp, const lv_area_t* area, uint8_t* pixelmap) {
+    DisplayFlush* self = static_cast<DisplayFlush*>(lv_display_get_user_data(disp));
+    uint32_t width = area->x2 - area->x1 + 1;
+    uint32_t height = area->y2 - area->y1 + 1;
+
+    // Poprzedni transfer jest już zakończony (waitCb), więc start jest natychmiastowy
+    self->tft.pushImageDMA(area->x1, area->y1, width, height, (uint16_t*)pixelmap);
+    self->flushCount++;
+}
+
+void DisplayFlush::waitCb(lv_display_t* disp) {
+    DisplayFlush* self = static_cast<DisplayFlush*>(lv_display_get_user_data(disp));
+    self->tft.dmaWait();
+}
+
+void DisplayFlush::transferDone(void* param) {
+    DisplayFlush* self = static_cast<DisplayFlush*>(param);
+    lv_display_flush_ready(self->display);
+}
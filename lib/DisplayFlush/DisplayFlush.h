@@ -0,0 +1,45 @@
+// ============================================================================
+// Odświeżanie ekranu LVGL przez DMA z dwoma buforami (TFT_eSPI)
+// ============================================================================
+#ifndef DISPLAY_FLUSH_H
+#define DISPLAY_FLUSH_H
+
+#include <stdint.h>
+#include <TFT_eSPI.h>
+#include "lvgl.h"
+
+/**
+ * Backend flush dla LVGL: pasek N jest wysyłany przez DMA, a LVGL w tym
+ * czasie rysuje pasek N+1 w drugim buforze. Koniec transferu zgłasza
+ * przerwanie SPI (lv_display_flush_ready), a LVGL czeka na zwolnienie
+ * bufora w dmaWait(), które usypia zadanie zamiast kręcić się w pętli.
+ * Ekran LVGL ma format LV_COLOR_FORMAT_RGB565_SWAPPED, więc piksele są
+ * zapisywane od razu w kolejności big-endian i flush niczego nie przelicza.
+ */
+class DisplayFlush {
+public:
+    explicit DisplayFlush(TFT_eSPI& tft);
+
+    /**
+     * Uruchamia DMA i podłącza bufory oraz callbacki do ekranu LVGL
+     * @param disp Ekran LVGL
+     * @param buf1 Pierwszy bufor (pamięć zdolna do DMA)
+     * @param buf2 Drugi bufor tego samego rozmiaru
+     * @param bufBytes Rozmiar jednego bufora w bajtach
+     * @return false, jeśli nie udało się uruchomić DMA
+     */
+    bool begin(lv_display_t* disp, void* buf1, void* buf2, uint32_t bufBytes);
+
+    uint32_t flushes() const { return flushCount; }
+
+private:
+    static void flushCb(lv_display_t* disp, const lv_area_t* area, uint8_t* pixelmap);
+    static void waitCb(lv_display_t* disp);
+    static void transferDone(void* param);
+
+    TFT_eSPI& tft;
+    lv_display_t* display;
+    uint32_t flushCount;
+};
+
+#endif
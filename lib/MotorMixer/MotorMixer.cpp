@@ -0,0 +1,66 @@
+#include "MotorMixer.h"
+#include <math.h>
+
+MotorMixer::MotorMixer(const MotorMixerConfig& config)
+    : settings(config), speed1Q8(0), speed2Q8(0) {
+    // Krzywa osi: martwa strefa, a dalej mieszanka liniowej i sześciennej (expo)
+    int deadband = settings.deadband < 0 ? 0 : (settings.deadband > 254 ? 254 : settings.deadband);
+    float expo = (settings.expo < 0 ? 0 : (settings.expo > 100 ? 100 : settings.expo)) / 100.0f;
+    for (int i = 0; i < 256; i++) {
+        if (i <= deadband) {
+            curveTable[i] = 0;
+            continue;
+        }
+        float x = (float)(i - deadband) / (float)(MAX_SPEED - deadband);
+        float y = (1.0f - expo) * x + expo * x * x * x;
+        curveTable[i] = (uint8_t)lroundf(y * MAX_SPEED);
+    }
+
+    // PWM: zero zostaje zerem, pozostałe wartości skalowane do zakresu minPwm-255 (jak map())
+    int minPwm = settings.minPwm < 0 ? 0 : (settings.minPwm > MAX_SPEED ? MAX_SPEED : settings.minPwm);
+    pwmTable[0] = 0;
+    for (int i = 1; i < 256; i++) {
+        pwmTable[i] = (uint8_t)(i * (MAX_SPEED - minPwm) / MAX_SPEED + minPwm);
+    }
+
+    // Krok na okres w 1/256 jednostki (zaokrąglony), co najmniej 1, aby rampa zawsze postępowała
+    int64_t step = ((int64_t)settings.slewRate * settings.periodMs * 256 + 500) / 1000;
+    const int64_t fullSwing = 2 * MAX_SPEED * 256;
+    stepQ8 = (int32_t)(step < 1 ? 1 : (step > fullSwing ? fullSwing : step));
+}
+
+void MotorMixer::mix(uint8_t up, uint8_t down, uint8_t left, uint8_t right, int& target1, int& target2) const {
+    // Prędkość bazowa (przód - tył) i korekta skrętu (prawo - lewo) po krzywych osi
+    int baseSpeed = (int)curveTable[up] - (int)curveTable[down];
+    int turnAdjust = ((int)curveTable[right] - (int)curveTable[left]) / 2;
+
+    target1 = clampSpeed(baseSpeed + turnAdjust); // Silnik lewy
+    target2 = clampSpeed(baseSpeed - turnAdjust); // Silnik prawy
+}
+
+int32_t MotorMixer::slew(int32_t currentQ8, int32_t targetQ8) const {
+    if (currentQ8 < targetQ8) {
+        // Soft start: zwiększ prędkość o maksymalnie stepQ8
+        return targetQ8 - currentQ8 > stepQ8 ? currentQ8 + stepQ8 : targetQ8;
+    } else if (currentQ8 > targetQ8) {
+        // Soft end: zmniejsz prędkość o maksymalnie stepQ8
+        return currentQ8 - targetQ8 > stepQ8 ? currentQ8 - stepQ8 : targetQ8;
+    }
+    return currentQ8;
+}
+
+MotorSpeeds MotorMixer::step(int target1, int target2) {
+    MotorSpeeds out;
+    out.targetSpeed1 = clampSpeed(target1);
+    out.targetSpeed2 = clampSpeed(target2);
+    speed1Q8 = slew(speed1Q8, out.targetSpeed1 * 256);
+    speed2Q8 = slew(speed2Q8, out.targetSpeed2 * 256);
+    out.currentSpeed1 = speed1();
+    out.currentSpeed2 = speed2();
+    return out;
+}
+
+void MotorMixer::stop() {
+    speed1Q8 = 0;
+    speed2Q8 = 0;
+}
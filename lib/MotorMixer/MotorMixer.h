@@ -0,0 +1,91 @@
+// ============================================================================
+// Mieszanie napędu różnicowego z krzywymi sterowania (niezależne od sprzętu)
+// ============================================================================
+#ifndef MOTOR_MIXER_H
+#define MOTOR_MIXER_H
+
+#include <stdint.h>
+
+// Wynik jednego kroku pętli sterowania
+struct MotorSpeeds {
+    int targetSpeed1;  // Docelowa prędkość silnika lewego (-255 do 255)
+    int targetSpeed2;  // Docelowa prędkość silnika prawego (-255 do 255)
+    int currentSpeed1; // Bieżąca prędkość silnika lewego po ograniczeniu narastania
+    int currentSpeed2; // Bieżąca prędkość silnika prawego po ograniczeniu narastania
+};
+
+// Parametry miksera (wartości domyślne odtwarzają liniowe sterowanie bez martwej strefy)
+struct MotorMixerConfig {
+    int deadband;  // Martwa strefa osi wejściowych (0-254), poniżej prędkość 0
+    int expo;      // Krzywa expo w % (0 = liniowa, 100 = sześcienna, większa precyzja przy małych wychyleniach)
+    int slewRate;  // Maksymalna zmiana prędkości w jednostkach na sekundę (255 = pełna skala w 1 s)
+    int periodMs;  // Okres pętli sterowania, w którym wywoływane jest step()
+    int minPwm;    // Minimalne PWM, przy którym silnik rusza (0-255)
+
+    MotorMixerConfig() : deadband(0), expo(0), slewRate(125), periodMs(80), minPwm(0) {}
+};
+
+/**
+ * Zamienia osie z kontrolera (0-255) na prędkości dwóch silników napędu
+ * różnicowego: baza = przód - tył, skręt = (prawo - lewo) / 2. Krzywe osi
+ * (martwa strefa, expo) oraz przeliczenie prędkości na PWM są zapisane
+ * w tablicach liczonych raz w konstruktorze, więc próbka nie wymaga
+ * dzielenia. Narastanie prędkości ograniczane jest w jednostkach na sekundę
+ * (stałoprzecinkowo, 1/256 jednostki), niezależnie od okresu pętli.
+ */
+class MotorMixer {
+public:
+    static const int MAX_SPEED = 255;
+
+    explicit MotorMixer(const MotorMixerConfig& config = MotorMixerConfig());
+
+    /**
+     * Liczy docelowe prędkości silników z osi kontrolera
+     * @param up Wychylenie do przodu (0-255)
+     * @param down Wychylenie do tyłu (0-255)
+     * @param left Wychylenie w lewo (0-255)
+     * @param right Wychylenie w prawo (0-255)
+     * @param target1 Docelowa prędkość silnika lewego (-255 do 255)
+     * @param target2 Docelowa prędkość silnika prawego (-255 do 255)
+     */
+    void mix(uint8_t up, uint8_t down, uint8_t left, uint8_t right, int& target1, int& target2) const;
+
+    /**
+     * Wykonuje jeden okres pętli: zbliża prędkości do celu najwyżej o slewRate * periodMs
+     * @return Docelowe i bieżące prędkości obu silników
+     */
+    MotorSpeeds step(int target1, int target2);
+
+    // Natychmiastowe zatrzymanie obu silników (bez rampy)
+    void stop();
+
+    int speed1() const { return speed1Q8 / 256; }
+    int speed2() const { return speed2Q8 / 256; }
+
+    /**
+     * @param speed Prędkość silnika (-255 do 255)
+     * @return Wypełnienie PWM (0 lub minPwm-255)
+     */
+    uint8_t pwm(int speed) const { return pwmTable[clampSpeed(speed < 0 ? -speed : speed)]; }
+
+    // Wartość osi po martwej strefie i krzywej expo (0-255)
+    uint8_t curve(uint8_t axis) const { return curveTable[axis]; }
+
+    const MotorMixerConfig& config() const { return settings; }
+
+private:
+    static int clampSpeed(int value) {
+        return value < -MAX_SPEED ? -MAX_SPEED : (value > MAX_SPEED ? MAX_SPEED : value);
+    }
+
+    int32_t slew(int32_t currentQ8, int32_t targetQ8) const;
+
+    MotorMixerConfig settings;
+    uint8_t curveTable[256]; // Oś wejściowa -> wartość po krzywej
+    uint8_t pwmTable[256];   // |prędkość| -> PWM z progiem minPwm
+    int32_t stepQ8;          // Maksymalna zmiana na okres (1/256 jednostki)
+    int32_t speed1Q8;        // Bieżąca prędkość silnika lewego (1/256 jednostki)
+    int32_t speed2Q8;        // Bieżąca prędkość silnika prawego (1/256 jednostki)
+};
+
+#endif
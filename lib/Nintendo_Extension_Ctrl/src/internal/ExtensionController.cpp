@@ -34,6 +34,9 @@ void ExtensionController::begin() {
 boolean ExtensionController::connect() {
 	boolean success = false;  // assume no connection
 
+	data.connectAttempted = true;
+	data.lastConnectAttempt = millis();
+
 	if (initialize()) {
 		identifyController();  // poll controller for its identity
 
@@ -47,6 +50,7 @@ boolean ExtensionController::connect() {
 		data.connectedType = ExtensionType::NoController;
 	}
 
+	setConnected(success);
 	return success;
 }
 
@@ -58,6 +62,21 @@ void ExtensionController::reset() {
 	data.connectedType = ExtensionType::NoController;  // Nothing connected
 	memset(&data.controlData, 0x00, ExtensionData::ControlDataSize);  // Clear control data
 	data.requestSize = MinRequestSize;  // Request size back to minimum
+	setConnected(false);
+}
+
+void ExtensionController::setConnected(boolean connected) {
+	data.connectionState = connected ? ConnectionState::Connected : ConnectionState::Reconnecting;
+	data.failedPolls = 0;
+	data.updateStatus = UpdateStatus::Idle;  // Drop any transaction started before
+}
+
+ConnectionState ExtensionController::getConnectionState() const {
+	return data.connectionState;
+}
+
+boolean ExtensionController::isConnected() const {
+	return data.connectionState != ConnectionState::Reconnecting;
 }
 
 boolean ExtensionController::controllerTypeMatches() const {
@@ -89,6 +108,91 @@ boolean ExtensionController::update() {
 	return false;  // Something went wrong :(
 }
 
+boolean ExtensionController::poll() {
+	/* Reads the controller once per call without re-initializing it.
+	 * A failed read only marks the connection as suspect, and a suspect
+	 * controller is checked with a single identity read. The full connect()
+	 * (~30 ms of init delays) only runs once the controller is really gone,
+	 * and then at most once per ReconnectInterval.
+	 */
+	switch (data.connectionState) {
+	case ConnectionState::Connected:
+		if (update()) return true;
+		data.connectionState = ConnectionState::Suspect;
+		data.failedPolls = 1;
+		return false;
+
+	case ConnectionState::Suspect:
+		if (!checkAlive()) {
+			setConnected(false);  // No answer or a different controller, start over
+			return false;
+		}
+		if (update()) {
+			setConnected(true);
+			return true;
+		}
+		if (++data.failedPolls >= SuspectPollLimit) {
+			setConnected(false);  // Responding, but the data is garbage: re-initialize
+		}
+		return false;
+
+	case ConnectionState::Reconnecting:
+	default:
+		if (data.connectAttempted && millis() - data.lastConnectAttempt < ReconnectInterval) {
+			return false;  // Too soon to retry
+		}
+		return connect() && update();
+	}
+}
+
+boolean ExtensionController::beginUpdate() {
+	/* Non-blocking version of update(), split into two phases so the caller
+	 * can do other work during the conversion delay instead of spinning in
+	 * delayMicroseconds(). Only available while connected, use poll() to
+	 * handle reconnection.
+	 */
+	if (data.connectionState != ConnectionState::Connected) return false;
+	if (data.updateStatus == UpdateStatus::Pending) return true;  // Already in progress
+
+	if (!i2c_writePointer(data.i2c, I2C_Addr, 0x00, false)) {
+		data.connectionState = ConnectionState::Suspect;
+		data.failedPolls = 1;
+		return false;
+	}
+
+	data.updateDeadline = micros() + I2C_ConversionDelay;
+	data.updateStatus = UpdateStatus::Pending;
+	return true;
+}
+
+UpdateStatus ExtensionController::pollUpdate() {
+	if (data.updateStatus != UpdateStatus::Pending) {
+		UpdateStatus result = data.updateStatus;
+		data.updateStatus = UpdateStatus::Idle;  // Results are only reported once
+		return result;
+	}
+
+	if (!i2c_deadlineReached(data.updateDeadline)) {
+		return UpdateStatus::Pending;  // Conversion still running
+	}
+
+	data.updateStatus = UpdateStatus::Idle;
+	if (i2c_requestMultiple(data.i2c, I2C_Addr, data.requestSize, data.controlData)
+		&& verifyData(data.controlData, data.requestSize)) {
+		return UpdateStatus::Ready;
+	}
+
+	data.connectionState = ConnectionState::Suspect;  // poll() decides what happens next
+	data.failedPolls = 1;
+	return UpdateStatus::Failed;
+}
+
+boolean ExtensionController::checkAlive() const {
+	uint8_t idData[ID_Size];
+	if (!requestIdentity(idData)) return false;  // Controller is not responding
+	return decodeIdentity(idData) == data.connectedType;
+}
+
 uint8_t ExtensionController::getControlData(uint8_t controlIndex) const {
 	return data.controlData[controlIndex];
 }
@@ -219,6 +323,7 @@ boolean ExtensionPort::connect() {
 		ptr = ptr->getNext();
 	}
 
+	setConnected(success);
 	return success;
 }
 
@@ -29,6 +29,18 @@
 #include "NXC_DataMaps.h"
 #include "NXC_LinkedList.h"
 
+enum class ConnectionState : uint8_t {
+	Connected,     // Last poll returned valid data
+	Suspect,       // Last poll failed, checking liveness before re-initializing
+	Reconnecting,  // Controller lost, periodically retrying the full connect()
+};
+
+enum class UpdateStatus : uint8_t {
+	Idle,     // No transaction in progress
+	Pending,  // Waiting for the controller's data conversion
+	Ready,    // New control data available (returned once)
+	Failed,   // Transaction failed (returned once)
+};
 
 namespace NintendoExtensionCtrl {
 
@@ -47,6 +59,14 @@ namespace NintendoExtensionCtrl {
 			ExtensionType connectedType = ExtensionType::NoController;
 			uint8_t requestSize = MinRequestSize;
 			uint8_t controlData[ControlDataSize];
+
+			ConnectionState connectionState = ConnectionState::Reconnecting;
+			uint8_t failedPolls = 0;  // Consecutive failures while suspect
+			boolean connectAttempted = false;
+			unsigned long lastConnectAttempt = 0;  // millis() of the last connect()
+
+			UpdateStatus updateStatus = UpdateStatus::Idle;
+			unsigned long updateDeadline = 0;  // micros() when the requested data is ready
 		};
 
 		ExtensionController(ExtensionData& dataRef);
@@ -57,9 +77,16 @@ namespace NintendoExtensionCtrl {
 		virtual boolean specificInit();
 
 		boolean update();
+		boolean poll();
+
+		boolean beginUpdate();
+		UpdateStatus pollUpdate();
 
 		void reset();
 
+		ConnectionState getConnectionState() const;
+		boolean isConnected() const;
+
 		virtual ExtensionType getExpectedType() const;
 		ExtensionType getControllerType() const;
 		boolean controllerTypeMatches() const;
@@ -75,6 +102,9 @@ namespace NintendoExtensionCtrl {
 		void printDebugRaw(Print& output = NXC_SERIAL_DEFAULT) const;
 		void printDebugRaw(uint8_t baseFormat, Print& output = NXC_SERIAL_DEFAULT) const;
 
+		static const uint8_t SuspectPollLimit = 3;  // Failed polls before re-initializing
+		static const unsigned long ReconnectInterval = 500;  // ms between connect() retries
+
 		static const uint8_t MinRequestSize = 6;   // Smallest reporting mode (0x37)
 		static const uint8_t MaxRequestSize = ExtensionData::ControlDataSize;
 
@@ -110,6 +140,8 @@ namespace NintendoExtensionCtrl {
 
 		inline ExtensionType identifyController() const { return data.connectedType = identifyController(data.i2c); }
 
+		boolean checkAlive() const;
+
 	protected:
 		typedef NintendoExtensionCtrl::IndexMap  IndexMap;
 		typedef NintendoExtensionCtrl::ByteMap   ByteMap;
@@ -137,6 +169,8 @@ namespace NintendoExtensionCtrl {
 
 		void setControlData(uint8_t index, uint8_t val);
 
+		void setConnected(boolean connected);
+
 	private:
 		ExtensionData &data;  // I2C and shared connection data
 	};
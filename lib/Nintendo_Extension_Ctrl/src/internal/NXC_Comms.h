@@ -72,6 +72,10 @@ namespace NintendoExtensionCtrl {
 		return i2c_requestMultiple(i2c, addr, requestSize, dataOut);
 	}
 
+	inline boolean i2c_deadlineReached(unsigned long deadline) {
+		return (long)(micros() - deadline) >= 0;  // Rollover-safe
+	}
+
 	inline boolean i2c_readRegister(NXC_I2C_TYPE& i2c, byte addr, byte reg, uint8_t* dataOut) {
 		return i2c_readDataArray(i2c, addr, reg, 1, dataOut);  // read one register
 	}
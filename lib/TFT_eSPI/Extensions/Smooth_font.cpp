@@ -125,12 +125,15 @@ void TFT_eSPI::loadFont(String fontName, bool flash)
 
   gFont.gArray   = (const uint8_t*)fontPtr;
 
-  gFont.gCount   = (uint16_t)readInt32(); // glyph count in file
-                             readInt32(); // vlw encoder version - discard
-  gFont.yAdvance = (uint16_t)readInt32(); // Font size in points, not pixels
-                             readInt32(); // discard
-  gFont.ascent   = (uint16_t)readInt32(); // top of "d"
-  gFont.descent  = (uint16_t)readInt32(); // bottom of "p"
+  uint8_t header[24];
+  readBlock(header, sizeof(header));      // Whole header in one read
+
+  gFont.gCount   = (uint16_t)getInt32(header);      // glyph count in file
+                                                    // vlw encoder version - discard
+  gFont.yAdvance = (uint16_t)getInt32(header + 8);  // Font size in points, not pixels
+                                                    // discard
+  gFont.ascent   = (uint16_t)getInt32(header + 16); // top of "d"
+  gFont.descent  = (uint16_t)getInt32(header + 20); // bottom of "p"
 
   // These next gFont values might be updated when the Metrics are fetched
   gFont.maxAscent  = gFont.ascent;   // Determined from metrics
@@ -187,17 +190,34 @@ void TFT_eSPI::loadMetrics(void)
   if (fs_font) fontFile.seek(headerPtr, fs::SeekSet);
 #endif
 
+  // The metrics table is read in blocks of glyphs instead of one byte per read() call
+  const uint16_t blockGlyphs = 16;
+  uint8_t  block[blockGlyphs * 28];
+  uint8_t* metrics = block;
+  uint16_t blockLeft = 0;
+
   uint16_t gNum = 0;
 
   while (gNum < gFont.gCount)
   {
-    gUnicode[gNum]  = (uint16_t)readInt32(); // Unicode code point value
-    gHeight[gNum]   =  (uint8_t)readInt32(); // Height of glyph
-    gWidth[gNum]    =  (uint8_t)readInt32(); // Width of glyph
-    gxAdvance[gNum] =  (uint8_t)readInt32(); // xAdvance - to move x cursor
-    gdY[gNum]       =  (int16_t)readInt32(); // y delta from baseline
-    gdX[gNum]       =   (int8_t)readInt32(); // x delta from cursor
-    readInt32(); // ignored
+    if (blockLeft == 0)
+    {
+      blockLeft = gFont.gCount - gNum;
+      if (blockLeft > blockGlyphs) blockLeft = blockGlyphs;
+      readBlock(block, blockLeft * 28);
+      metrics = block;
+      yield();
+    }
+
+    gUnicode[gNum]  = (uint16_t)getInt32(metrics);      // Unicode code point value
+    gHeight[gNum]   =  (uint8_t)getInt32(metrics + 4);  // Height of glyph
+    gWidth[gNum]    =  (uint8_t)getInt32(metrics + 8);  // Width of glyph
+    gxAdvance[gNum] =  (uint8_t)getInt32(metrics + 12); // xAdvance - to move x cursor
+    gdY[gNum]       =  (int16_t)getInt32(metrics + 16); // y delta from baseline
+    gdX[gNum]       =   (int8_t)getInt32(metrics + 20); // x delta from cursor
+                                                         // padding at metrics + 24 ignored
+    metrics += 28;
+    blockLeft--;
 
     //Serial.print("Unicode = 0x"); Serial.print(gUnicode[gNum], HEX); Serial.print(", gHeight  = "); Serial.println(gHeight[gNum]);
     //Serial.print("Unicode = 0x"); Serial.print(gUnicode[gNum], HEX); Serial.print(", gWidth  = "); Serial.println(gWidth[gNum]);
@@ -239,12 +259,59 @@ void TFT_eSPI::loadMetrics(void)
     bitmapPtr += gWidth[gNum] * gHeight[gNum];
 
     gNum++;
-    yield();
   }
 
   gFont.yAdvance = gFont.maxAscent + gFont.maxDescent;
 
   gFont.spaceWidth = (gFont.ascent + gFont.descent) * 2/7;  // Guess at space width
+
+  sortMetrics();
+
+#ifdef SMOOTH_FONT_CACHE_ENABLED
+  createCache();
+#endif
+}
+
+
+/***************************************************************************************
+** Function name:           sortMetrics
+** Description:             Index the glyphs in Unicode order for a binary search
+*************************************************************************************x*/
+static int compareGlyphKeys(const void* a, const void* b)
+{
+  uint32_t ka = *(const uint32_t*)a;
+  uint32_t kb = *(const uint32_t*)b;
+  return (ka > kb) - (ka < kb);
+}
+
+void TFT_eSPI::sortMetrics(void)
+{
+  // Fonts created by Processing list the glyphs in ascending Unicode order, so
+  // gUnicode can be searched directly and no index memory is needed
+  gLinearSearch = false;
+  uint16_t gNum = 1;
+  while (gNum < gFont.gCount && gUnicode[gNum] > gUnicode[gNum - 1]) gNum++;
+  if (gNum >= gFont.gCount) return;
+
+  // Sort keys of Unicode value and glyph number, so for duplicated codes the
+  // first glyph in the file is found as with a linear search
+  uint32_t* keys = (uint32_t*)malloc( gFont.gCount * 4);
+  gSorted = (uint16_t*)malloc( gFont.gCount * 2);
+  if (!keys || !gSorted)
+  {
+    // Not enough memory, getUnicodeIndex() falls back to a linear search
+    if (keys) free(keys);
+    if (gSorted) free(gSorted);
+    gSorted = NULL;
+    gLinearSearch = true;
+    return;
+  }
+
+  for (gNum = 0; gNum < gFont.gCount; gNum++) keys[gNum] = ((uint32_t)gUnicode[gNum] << 16) | gNum;
+  qsort(keys, gFont.gCount, sizeof(uint32_t), compareGlyphKeys);
+  for (gNum = 0; gNum < gFont.gCount; gNum++) gSorted[gNum] = (uint16_t)keys[gNum];
+
+  free(keys);
 }
 
 
@@ -260,6 +327,12 @@ void TFT_eSPI::unloadFont( void )
     gUnicode = NULL;
   }
 
+  if (gSorted)
+  {
+    free(gSorted);
+    gSorted = NULL;
+  }
+
   if (gHeight)
   {
     free(gHeight);
@@ -298,6 +371,10 @@ void TFT_eSPI::unloadFont( void )
 
   gFont.gArray = nullptr;
 
+#ifdef SMOOTH_FONT_CACHE_ENABLED
+  deleteCache();
+#endif
+
 #ifdef FONT_FS_AVAILABLE
   if (fs_font && fontFile) fontFile.close();
 #endif
@@ -307,30 +384,30 @@ void TFT_eSPI::unloadFont( void )
 
 
 /***************************************************************************************
-** Function name:           readInt32
-** Description:             Get a 32-bit integer from the font file
+** Function name:           readBlock
+** Description:             Read a block of bytes from the font file or array
 *************************************************************************************x*/
-uint32_t TFT_eSPI::readInt32(void)
+void TFT_eSPI::readBlock(uint8_t* buffer, uint32_t length)
 {
-  uint32_t val = 0;
-
 #ifdef FONT_FS_AVAILABLE
   if (fs_font) {
-    val  = (uint32_t)fontFile.read() << 24;
-    val |= (uint32_t)fontFile.read() << 16;
-    val |= (uint32_t)fontFile.read() << 8;
-    val |= (uint32_t)fontFile.read();
+    uint32_t count = fontFile.read(buffer, length);
+    if (count < length) memset(buffer + count, 0, length - count); // Truncated file
+    return;
   }
-  else
 #endif
-  {
-    val  = (uint32_t)pgm_read_byte(fontPtr++) << 24;
-    val |= (uint32_t)pgm_read_byte(fontPtr++) << 16;
-    val |= (uint32_t)pgm_read_byte(fontPtr++) << 8;
-    val |= (uint32_t)pgm_read_byte(fontPtr++);
-  }
 
-  return val;
+  for (uint32_t i = 0; i < length; i++) buffer[i] = pgm_read_byte(fontPtr++);
+}
+
+
+/***************************************************************************************
+** Function name:           getInt32
+** Description:             Get a big-endian 32-bit integer from a block of the font
+*************************************************************************************x*/
+uint32_t TFT_eSPI::getInt32(const uint8_t* bytes)
+{
+  return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
 }
 
 
@@ -340,11 +417,37 @@ uint32_t TFT_eSPI::readInt32(void)
 *************************************************************************************x*/
 bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 {
-  for (uint16_t i = 0; i < gFont.gCount; i++)
+  if (gFont.gCount == 0 || !gUnicode) return false;
+
+  if (gLinearSearch)
   {
-    if (gUnicode[i] == unicode)
+    for (uint16_t i = 0; i < gFont.gCount; i++)
     {
-      *index = i;
+      if (gUnicode[i] == unicode)
+      {
+        *index = i;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Binary search for the first glyph with a code >= unicode
+  uint16_t lo = 0;
+  uint16_t hi = gFont.gCount;
+  while (lo < hi)
+  {
+    uint16_t mid = (uint16_t)(((uint32_t)lo + hi) >> 1);
+    if (gUnicode[gSorted ? gSorted[mid] : mid] < unicode) lo = mid + 1;
+    else hi = mid;
+  }
+
+  if (lo < gFont.gCount)
+  {
+    uint16_t gNum = gSorted ? gSorted[lo] : lo;
+    if (gUnicode[gNum] == unicode)
+    {
+      *index = gNum;
       return true;
     }
   }
@@ -352,6 +455,137 @@ bool TFT_eSPI::getUnicodeIndex(uint16_t unicode, uint16_t *index)
 }
 
 
+#ifdef SMOOTH_FONT_CACHE_ENABLED
+/***************************************************************************************
+** Function name:           createCache
+** Description:             Allocate the glyph bitmap cache for a font file
+*************************************************************************************x*/
+void TFT_eSPI::createCache(void)
+{
+  fontCacheHits   = 0;
+  fontCacheMisses = 0;
+
+  // Array fonts are already in memory
+  if (!fs_font || fontCacheSize == 0) return;
+
+  uint32_t slotSize = 0;
+  for (uint16_t gNum = 0; gNum < gFont.gCount; gNum++)
+  {
+    uint32_t size = gWidth[gNum] * gHeight[gNum];
+    if (size > slotSize) slotSize = size;
+  }
+  if (slotSize == 0) return;
+
+  uint32_t slots = fontCacheSize / slotSize;
+  if (slots > gFont.gCount) slots = gFont.gCount;
+  if (slots == 0) return;
+
+#if defined (ESP32) && defined (CONFIG_SPIRAM_SUPPORT)
+  if ( psramFound() && _psram_enable ) gCacheArena = (uint8_t*)ps_malloc(slots * slotSize);
+  else
+#endif
+  gCacheArena = (uint8_t*)malloc(slots * slotSize);
+  gCacheSlot  = (uint16_t*)malloc(gFont.gCount * 2);
+  gCacheList  = (glyphSlot*)malloc(slots * sizeof(glyphSlot));
+
+  if (!gCacheArena || !gCacheSlot || !gCacheList)
+  {
+    // Not enough memory, glyphs are read from the file as they are drawn
+    deleteCache();
+    return;
+  }
+
+  memset(gCacheSlot, 0xFF, gFont.gCount * 2);
+  for (uint16_t s = 0; s < slots; s++)
+  {
+    gCacheList[s].gNum = 0xFFFF;
+    gCacheList[s].prev = (uint16_t)(s - 1); // 0xFFFF for the head
+    gCacheList[s].next = ((uint32_t)s + 1 < slots) ? s + 1 : 0xFFFF;
+  }
+  gCacheSlotSize = slotSize;
+  gCacheSlots    = slots;
+  gCacheHead     = 0;
+  gCacheTail     = slots - 1;
+}
+
+
+/***************************************************************************************
+** Function name:           deleteCache
+** Description:             Free the glyph bitmap cache
+*************************************************************************************x*/
+void TFT_eSPI::deleteCache(void)
+{
+  if (gCacheArena)
+  {
+    free(gCacheArena);
+    gCacheArena = NULL;
+  }
+
+  if (gCacheSlot)
+  {
+    free(gCacheSlot);
+    gCacheSlot = NULL;
+  }
+
+  if (gCacheList)
+  {
+    free(gCacheList);
+    gCacheList = NULL;
+  }
+
+  gCacheSlotSize = 0;
+  gCacheSlots    = 0;
+  gCacheHead     = 0xFFFF;
+  gCacheTail     = 0xFFFF;
+}
+
+
+/***************************************************************************************
+** Function name:           getCachedBitmap
+** Description:             Get a glyph bitmap from the cache, NULL if it is not available
+*************************************************************************************x*/
+const uint8_t* TFT_eSPI::getCachedBitmap(uint16_t gNum)
+{
+  if (!gCacheArena) return NULL;
+
+  uint16_t slot = gCacheSlot[gNum];
+
+  if (slot != 0xFFFF) fontCacheHits++;
+  else
+  {
+    // Reload the least recently used slot with the whole bitmap in one read
+    slot = gCacheTail;
+    if (gCacheList[slot].gNum != 0xFFFF) gCacheSlot[gCacheList[slot].gNum] = 0xFFFF;
+    gCacheList[slot].gNum = 0xFFFF;
+
+    uint32_t size = gWidth[gNum] * gHeight[gNum];
+    fontFile.seek(gBitmap[gNum], fs::SeekSet);
+    if (fontFile.read(gCacheArena + slot * gCacheSlotSize, size) != size) return NULL;
+
+    gCacheList[slot].gNum = gNum;
+    gCacheSlot[gNum] = slot;
+    fontCacheMisses++;
+  }
+
+  // Move the slot to the head of the list
+  if (slot != gCacheHead)
+  {
+    glyphSlot* entry = &gCacheList[slot];
+    gCacheList[entry->prev].next = entry->next;
+    if (entry->next != 0xFFFF) gCacheList[entry->next].prev = entry->prev;
+    else gCacheTail = entry->prev;
+
+    entry->prev = 0xFFFF;
+    entry->next = gCacheHead;
+    gCacheList[gCacheHead].prev = slot;
+    gCacheHead = slot;
+  }
+
+  return gCacheArena + slot * gCacheSlotSize;
+}
+#endif
+
+
 /***************************************************************************************
 ** Function name:           drawGlyph
 ** Description:             Write a character to the TFT cursor position
@@ -405,15 +639,23 @@ void TFT_eSPI::drawGlyph(uint16_t code)
     if (cursor_x == 0) cursor_x -= gdX[gNum];
 
     uint8_t* pbuffer = nullptr;
-    const uint8_t* gPtr = (const uint8_t*) gFont.gArray;
+    const uint8_t* gPtr = nullptr; // Glyph bitmap in memory
 
 #ifdef FONT_FS_AVAILABLE
     if (fs_font)
     {
-      fontFile.seek(gBitmap[gNum], fs::SeekSet);
-      pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+#ifdef SMOOTH_FONT_CACHE_ENABLED
+      gPtr = getCachedBitmap(gNum); // Read before startWrite() as the file may be on SD
+      if (!gPtr)
+#endif
+      {
+        fontFile.seek(gBitmap[gNum], fs::SeekSet);
+        pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      }
     }
+    else
 #endif
+    gPtr = (const uint8_t*) gFont.gArray + gBitmap[gNum];
 
     int16_t cy = cursor_y + gFont.maxAscent - gdY[gNum];
     int16_t cx = cursor_x + gdX[gNum];
@@ -461,7 +703,7 @@ void TFT_eSPI::drawGlyph(uint16_t code)
     for (int32_t y = 0; y < gHeight[gNum]; y++)
     {
 #ifdef FONT_FS_AVAILABLE
-      if (fs_font) {
+      if (pbuffer) {
         if (spiffs)
         {
           fontFile.read(pbuffer, gWidth[gNum]);
@@ -480,10 +722,10 @@ void TFT_eSPI::drawGlyph(uint16_t code)
       for (int32_t x = 0; x < gWidth[gNum]; x++)
       {
 #ifdef FONT_FS_AVAILABLE
-        if (fs_font) pixel = pbuffer[x];
+        if (pbuffer) pixel = pbuffer[x];
         else
 #endif
-        pixel = pgm_read_byte(gPtr + gBitmap[gNum] + x + gWidth[gNum] * y);
+        pixel = pgm_read_byte(gPtr + x + gWidth[gNum] * y);
 
         if (pixel)
         {
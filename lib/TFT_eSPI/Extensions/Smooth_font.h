@@ -33,6 +33,8 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
 
   // These are for the metrics for each individual glyph (so we don't need to seek this in file and waste time)
   uint16_t* gUnicode = NULL;  //UTF-16 code, the codes are searched so do not need to be sequential
+  uint16_t* gSorted = NULL;   //glyph numbers in ascending Unicode order, NULL if gUnicode is already sorted
+  bool      gLinearSearch = false; //gUnicode is not sorted and there was no memory for gSorted
   uint8_t*  gHeight = NULL;   //cheight
   uint8_t*  gWidth = NULL;    //cwidth
   uint8_t*  gxAdvance = NULL; //setWidth
@@ -42,6 +44,35 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
 
   bool     fontLoaded = false; // Flags when a anti-aliased font is loaded
 
+#if defined (FONT_FS_AVAILABLE) && defined (SMOOTH_FONT_CACHE)
+  // Optional cache for glyph bitmaps of font files, define SMOOTH_FONT_CACHE as the arena size in bytes.
+  // The arena is allocated in PSRAM (if enabled) or heap when a font file is loaded and split into equal
+  // slots sized for the largest glyph. The least recently used slot is reloaded on a miss.
+  #define SMOOTH_FONT_CACHE_ENABLED
+
+  typedef struct
+  {
+    uint16_t gNum;                   // Glyph held by the slot, 0xFFFF if empty
+    uint16_t prev;                   // Slot used just before this one, 0xFFFF at the head
+    uint16_t next;                   // Slot used just after this one, 0xFFFF at the tail
+  } glyphSlot;
+
+  uint32_t  fontCacheSize  = SMOOTH_FONT_CACHE; // Arena size for the next loadFont(), 0 to disable
+  uint32_t  fontCacheHits  = 0;
+  uint32_t  fontCacheMisses = 0;
+
+  uint8_t*  gCacheArena = NULL;  // Slot bitmaps, slot s at gCacheArena + s * gCacheSlotSize
+  uint16_t* gCacheSlot  = NULL;  // Slot holding each glyph, 0xFFFF if not cached
+  glyphSlot* gCacheList = NULL;  // Slots in least recently used order
+  uint32_t  gCacheSlotSize = 0;
+  uint16_t  gCacheSlots = 0;
+  uint16_t  gCacheHead  = 0xFFFF; // Most recently used slot
+  uint16_t  gCacheTail  = 0xFFFF; // Least recently used slot, reloaded on the next miss
+
+  // Return the bitmap of glyph gNum from the cache, reading it from the file on a miss
+  const uint8_t* getCachedBitmap(uint16_t gNum);
+#endif
+
 #ifdef FONT_FS_AVAILABLE
   fs::File fontFile;
   fs::FS   &fontFS  = SPIFFS;
@@ -55,7 +86,13 @@ fontMetrics gFont = { nullptr, 0, 0, 0, 0, 0, 0, 0 };
   private:
 
   void     loadMetrics(void);
-  uint32_t readInt32(void);
+  void     sortMetrics(void);
+  void     readBlock(uint8_t* buffer, uint32_t length);
+  static uint32_t getInt32(const uint8_t* bytes);
+#ifdef SMOOTH_FONT_CACHE_ENABLED
+  void     createCache(void);
+  void     deleteCache(void);
+#endif
 
   uint8_t* fontPtr = nullptr;
 
@@ -388,11 +388,182 @@ void TFT_eSprite::deleteSprite(void)
 }
 
 
+#define FP_SCALE 10
+
+/***************************************************************************************
+** Function name:           spanLimits
+** Description:             Limit a range of steps to those inside 0 <= a + k * b < e
+***************************************************************************************/
+// Divide rounding towards minus infinity
+static inline int32_t floorDiv(int32_t n, int32_t d)
+{
+  int32_t q = n / d;
+  if ((n % d != 0) && ((n < 0) != (d < 0))) q--;
+  return q;
+}
+
+static void spanLimits(int32_t a, int32_t b, int32_t e, int32_t *k0, int32_t *k1)
+{
+  int32_t lo, hi;
+
+  if (b > 0) {
+    lo = -floorDiv(a, b);
+    hi = -floorDiv(a - e, b);
+  }
+  else if (b < 0) {
+    lo = floorDiv(a - e, -b) + 1;
+    hi = floorDiv(a, -b) + 1;
+  }
+  else {
+    if (a >= 0 && a < e) return;
+    *k1 = *k0; // No step is inside
+    return;
+  }
+
+  if (lo > *k0) *k0 = lo;
+  if (hi < *k1) *k1 = hi;
+}
+
+
+/***************************************************************************************
+** Function name:           copyStrided
+** Description:             Copy pixels read every step pixels, two per 32-bit store
+***************************************************************************************/
+// Used for rotations by multiples of 90 degrees, step is +/-1 along a row or
+// +/-width along a column (a transposed copy). Assumes a little-endian processor.
+static void copyStrided(uint16_t *dst, const uint16_t *src, int32_t step, int32_t count)
+{
+  if (step == 1) {
+    memcpy(dst, src, count << 1);
+    return;
+  }
+
+  int32_t i = 0;
+  if (count && ((uintptr_t)dst & 2)) { *dst++ = *src; i = 1; }
+
+  uint32_t *dst32 = (uint32_t*)dst;
+  for (; i + 1 < count; i += 2) *dst32++ = src[i * step] | (uint32_t)src[(i + 1) * step] << 16;
+
+  if (i < count) *(uint16_t*)dst32 = src[i * step];
+}
+
+
+/***************************************************************************************
+** Function name:           readDirect
+** Description:             Check if readPixel() equals a direct read of the Sprite buffer
+***************************************************************************************/
+bool TFT_eSprite::readDirect(void)
+{
+  // No viewport, datum or 1bpp coordinate rotation
+  return !_vpOoB && _xDatum == 0 && _yDatum == 0 && _vpX == 0 && _vpY == 0 &&
+         _vpW >= _dwidth && _vpH >= _dheight && (_bpp != 1 || rotation == 0);
+}
+
+
+/***************************************************************************************
+** Function name:           getRotatedSpan
+** Description:             Get the pixels of a destination row that map inside the Sprite
+***************************************************************************************/
+// xs, ys are the fixed point source coordinates of step 0 of the row. On entry
+// *x0 and *x1 give the range of steps to draw, on exit they are limited to the
+// steps that read a source pixel and xs, ys are moved to step *x0.
+bool TFT_eSprite::getRotatedSpan(int32_t *xs, int32_t *ys, int32_t *x0, int32_t *x1)
+{
+  spanLimits(*xs, _cosra, _dwidth << FP_SCALE, x0, x1);
+  spanLimits(*ys, _sinra, _dheight << FP_SCALE, x0, x1);
+  if (*x0 >= *x1) return false;
+
+  *xs += *x0 * _cosra;
+  *ys += *x0 * _sinra;
+  return true;
+}
+
+
+/***************************************************************************************
+** Function name:           readRotatedSpan
+** Description:             Read a span of rotated Sprite pixels as swapped 565 colours
+***************************************************************************************/
+// All pixels of the span must be inside the Sprite (see getRotatedSpan)
+void TFT_eSprite::readRotatedSpan(uint16_t *buffer, int32_t count, int32_t xs, int32_t ys)
+{
+  if (_bpp == 16)
+  {
+    // Multiples of 90 degrees step exactly one pixel along a source row or column
+    int32_t step = 0;
+    if (_sinra == 0 && (_cosra == (1 << FP_SCALE) || _cosra == -(1 << FP_SCALE))) step = (_cosra > 0) ? 1 : -1;
+    if (_cosra == 0 && (_sinra == (1 << FP_SCALE) || _sinra == -(1 << FP_SCALE))) step = (_sinra > 0) ? _iwidth : -_iwidth;
+
+    if (step) {
+      copyStrided(buffer, _img + (xs >> FP_SCALE) + (ys >> FP_SCALE) * _iwidth, step, count);
+      return;
+    }
+
+    while (count--) {
+      *buffer++ = _img[(xs >> FP_SCALE) + (ys >> FP_SCALE) * _iwidth];
+      xs += _cosra;
+      ys += _sinra;
+    }
+    return;
+  }
+
+  if (!readDirect())
+  {
+    // Viewport or 1bpp rotation set, so use readPixel()
+    while (count--) {
+      uint16_t rp = readPixel(xs >> FP_SCALE, ys >> FP_SCALE);
+      *buffer++ = rp>>8 | rp<<8;
+      xs += _cosra;
+      ys += _sinra;
+    }
+    return;
+  }
+
+  if (_bpp == 8)
+  {
+    const uint8_t blue[] = {0, 11, 21, 31};
+    while (count--) {
+      uint16_t color = _img8[(xs >> FP_SCALE) + (ys >> FP_SCALE) * _iwidth];
+      if (color != 0) {
+        color =   (color & 0xE0)<<8 | (color & 0xC0)<<5
+                | (color & 0x1C)<<6 | (color & 0x1C)<<3
+                | blue[color & 0x03];
+      }
+      *buffer++ = color>>8 | color<<8;
+      xs += _cosra;
+      ys += _sinra;
+    }
+  }
+  else if (_bpp == 4)
+  {
+    uint16_t palette[16];
+    for (uint8_t i = 0; i < 16; i++) palette[i] = _colorMap[i]>>8 | _colorMap[i]<<8;
+    while (count--) {
+      int32_t xp = xs >> FP_SCALE;
+      uint8_t pair = _img4[(xp + (ys >> FP_SCALE) * _iwidth)>>1];
+      *buffer++ = palette[(xp & 0x01) ? (pair & 0x0F) : (pair >> 4)];
+      xs += _cosra;
+      ys += _sinra;
+    }
+  }
+  else // 1bpp
+  {
+    uint16_t fg = _tft->bitmap_fg>>8 | _tft->bitmap_fg<<8;
+    uint16_t bg = _tft->bitmap_bg>>8 | _tft->bitmap_bg<<8;
+    while (count--) {
+      int32_t xp = xs >> FP_SCALE;
+      bool set = (_img8[(xp + (ys >> FP_SCALE) * _bitwidth)>>3] << (xp & 0x7)) & 0x80;
+      *buffer++ = set ? fg : bg;
+      xs += _cosra;
+      ys += _sinra;
+    }
+  }
+}
+
+
 /***************************************************************************************
 ** Function name:           pushRotated - Fast fixed point integer maths version
 ** Description:             Push rotated Sprite to TFT screen
 ***************************************************************************************/
-#define FP_SCALE 10
 bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp)
 {
   if ( !_created || _tft->_vpOoB) return false;
@@ -406,52 +577,52 @@ bool TFT_eSprite::pushRotated(int16_t angle, uint32_t transp)
   // Get the bounding box of this rotated source Sprite relative to Sprite pivot
   if ( !getRotatedBounds(angle, &min_x, &min_y, &max_x, &max_y) ) return false;
 
+  // Bounding box is clipped to the viewport edge, which is outside of the viewport
+  if (max_y >= _tft->_vpH) max_y = _tft->_vpH - 1;
+
   uint16_t sline_buffer[max_x - min_x + 1];
 
   int32_t xt = min_x - _tft->_xPivot;
   int32_t yt = min_y - _tft->_yPivot;
-  uint32_t xe = _dwidth << FP_SCALE;
-  uint32_t ye = _dheight << FP_SCALE;
   uint16_t tpcolor = (uint16_t)transp;
+  bool     transparent = (transp != 0x00FFFFFF);
 
-  if (transp != 0x00FFFFFF) {
+  if (transparent) {
     if (_bpp == 4) tpcolor = _colorMap[transp & 0x0F];
     tpcolor = tpcolor>>8 | tpcolor<<8; // Working with swapped color bytes
   }
   _tft->startWrite(); // Avoid transaction overhead for every tft pixel
 
-  // Scan destination bounding box and fetch transformed pixels from source Sprite
+  // Scan destination bounding box, the span of each row inside the source Sprite is
+  // found first so pixels are then fetched without any bounds checks
   for (int32_t y = min_y; y <= max_y; y++, yt++) {
-    int32_t x = min_x;
-    uint32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
-    uint32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
-
-    while ((xs >= xe || ys >= ye) && x < max_x) { x++; xs += _cosra; ys += _sinra; }
-    if (x == max_x) continue;
-
-    uint32_t pixel_count = 0;
-    do {
-      uint32_t rp;
-      int32_t xp = xs >> FP_SCALE;
-      int32_t yp = ys >> FP_SCALE;
-      if (_bpp == 16) {rp = _img[xp + yp * _iwidth]; }
-      else { rp = readPixel(xp, yp); rp = (uint16_t)(rp>>8 | rp<<8); }
-      if (transp != 0x00FFFFFF && tpcolor == rp) {
-        if (pixel_count) {
-          // TFT window is already clipped, so this is faster than pushImage()
-          _tft->setWindow(x - pixel_count, y, x - 1, y);
-          _tft->pushPixels(sline_buffer, pixel_count);
-          pixel_count = 0;
-        }
+    int32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    int32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    int32_t x0 = 0;
+    int32_t x1 = max_x - min_x;
+
+    if (!getRotatedSpan(&xs, &ys, &x0, &x1)) continue;
+
+    int32_t count = x1 - x0;
+    readRotatedSpan(sline_buffer, count, xs, ys);
+
+    // TFT window is already clipped, so this is faster than pushImage()
+    if (!transparent) {
+      _tft->setWindow(min_x + x0, y, min_x + x1 - 1, y);
+      _tft->pushPixels(sline_buffer, count);
+      continue;
+    }
+
+    // Push the runs between transparent pixels
+    int32_t i = 0;
+    while (i < count) {
+      while (i < count && sline_buffer[i] == tpcolor) i++;
+      int32_t start = i;
+      while (i < count && sline_buffer[i] != tpcolor) i++;
+      if (i > start) {
+        _tft->setWindow(min_x + x0 + start, y, min_x + x0 + i - 1, y);
+        _tft->pushPixels(sline_buffer + start, i - start);
       }
-      else {
-        sline_buffer[pixel_count++] = rp;
-      }
-    } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
-    if (pixel_count) {
-      // TFT window is already clipped, so this is faster than pushImage()
-      _tft->setWindow(x - pixel_count, y, x - 1, y);
-      _tft->pushPixels(sline_buffer, pixel_count);
     }
   }
 
@@ -480,15 +651,23 @@ bool TFT_eSprite::pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp)
   // Get the bounding box of this rotated source Sprite
   if ( !getRotatedBounds(spr, angle, &min_x, &min_y, &max_x, &max_y) ) return false;
 
+  if (spr->_vpOoB) return true;
+
+  // Clip rows and columns to the destination viewport, as pushImage() would. A 1bpp
+  // pushImage() reads the 16-bit line as packed bits, so its runs are left unclipped.
+  int32_t clip_x0 = (spr->_bpp == 1) ? INT16_MIN : spr->_vpX - spr->_xDatum;
+  int32_t clip_x1 = (spr->_bpp == 1) ? INT16_MAX : spr->_vpW - spr->_xDatum;
+  if (min_y < spr->_vpY - spr->_yDatum) min_y = spr->_vpY - spr->_yDatum;
+  if (max_y >= spr->_vpH - spr->_yDatum) max_y = spr->_vpH - spr->_yDatum - 1;
+
   uint16_t sline_buffer[max_x - min_x + 1];
 
   int32_t xt = min_x - spr->_xPivot;
   int32_t yt = min_y - spr->_yPivot;
-  uint32_t xe = _dwidth << FP_SCALE;
-  uint32_t ye = _dheight << FP_SCALE;
   uint16_t tpcolor = (uint16_t)transp;
+  bool     transparent = (transp != 0x00FFFFFF);
   
-  if (transp != 0x00FFFFFF) {
+  if (transparent) {
     if (_bpp == 4) tpcolor = _colorMap[transp & 0x0F];
     tpcolor = tpcolor>>8 | tpcolor<<8; // Working with swapped color bytes
   }
@@ -496,33 +675,49 @@ bool TFT_eSprite::pushRotated(TFT_eSprite *spr, int16_t angle, uint32_t transp)
   bool oldSwapBytes = spr->getSwapBytes();
   spr->setSwapBytes(false);
 
-  // Scan destination bounding box and fetch transformed pixels from source Sprite
+  // Scan destination bounding box and fetch the span of each row inside the source Sprite
   for (int32_t y = min_y; y <= max_y; y++, yt++) {
-    int32_t x = min_x;
-    uint32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
-    uint32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    int32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    int32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    int32_t x0 = (clip_x0 > min_x) ? clip_x0 - min_x : 0;
+    int32_t x1 = max_x - min_x;
+    if (clip_x1 - min_x < x1) x1 = clip_x1 - min_x;
 
-    while ((xs >= xe || ys >= ye) && x < max_x) { x++; xs += _cosra; ys += _sinra; }
-    if (x == max_x) continue;
+    if (!getRotatedSpan(&xs, &ys, &x0, &x1)) continue;
 
-    uint32_t pixel_count = 0;
-    do {
-      uint32_t rp;
-      int32_t xp = xs >> FP_SCALE;
-      int32_t yp = ys >> FP_SCALE;
-      if (_bpp == 16) rp = _img[xp + yp * _iwidth];
-      else { rp = readPixel(xp, yp); rp = (uint16_t)(rp>>8 | rp<<8); }
-      if (transp != 0x00FFFFFF && tpcolor == rp) {
-        if (pixel_count) {
-          spr->pushImage(x - pixel_count, y, pixel_count, 1, sline_buffer);
-          pixel_count = 0;
-        }
+    int32_t  count = x1 - x0;
+    int32_t  x = min_x + x0;
+    uint32_t dst = (x + spr->_xDatum) + (y + spr->_yDatum) * spr->_iwidth;
+
+    if (spr->_bpp == 16 && !transparent) {
+      // Read straight into the destination row
+      readRotatedSpan(spr->_img + dst, count, xs, ys);
+      continue;
+    }
+
+    readRotatedSpan(sline_buffer, count, xs, ys);
+
+    if (spr->_bpp == 16) {
+      uint16_t *out = spr->_img + dst;
+      for (int32_t i = 0; i < count; i++) if (sline_buffer[i] != tpcolor) out[i] = sline_buffer[i];
+    }
+    else if (spr->_bpp == 8) {
+      uint8_t *out = spr->_img8 + dst;
+      for (int32_t i = 0; i < count; i++) {
+        uint16_t color = sline_buffer[i];
+        if (transparent && color == tpcolor) continue;
+        out[i] = (uint8_t)((color & 0xE0) | (color & 0x07)<<2 | (color & 0x1800)>>11);
       }
-      else {
-        sline_buffer[pixel_count++] = rp;
+    }
+    else { // 1bpp destination, pixels are written by pushImage()
+      int32_t i = 0;
+      while (i < count) {
+        while (i < count && transparent && sline_buffer[i] == tpcolor) i++;
+        int32_t start = i;
+        while (i < count && !(transparent && sline_buffer[i] == tpcolor)) i++;
+        if (i > start) spr->pushImage(x + start, y, i - start, 1, sline_buffer + start);
       }
-    } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
-    if (pixel_count) spr->pushImage(x - pixel_count, y, pixel_count, 1, sline_buffer);
+    }
   }
   spr->setSwapBytes(oldSwapBytes);
   return true;
@@ -758,6 +953,68 @@ bool TFT_eSprite::pushToSprite(TFT_eSprite *dspr, int32_t x, int32_t y, uint16_t
   if (_bpp ==  4 || ds_bpp ==  4) return false;
   if (_bpp ==  1 && ds_bpp !=  1) return false;
 
+  // 16 and 8 bpp buffers are copied directly, a run of opaque pixels at a time
+  if (_bpp != 1 && readDirect() && !dspr->getSwapBytes()) {
+    if (dspr->_vpOoB) return true;
+
+    // Clip once to the destination viewport
+    int32_t dx = x + dspr->_xDatum;
+    int32_t dy = y + dspr->_yDatum;
+    int32_t x0 = 0, x1 = _dwidth;
+    int32_t y0 = 0, y1 = _dheight;
+    if (dx < dspr->_vpX) x0 = dspr->_vpX - dx;
+    if (dy < dspr->_vpY) y0 = dspr->_vpY - dy;
+    if (dx + x1 > dspr->_vpW) x1 = dspr->_vpW - dx;
+    if (dy + y1 > dspr->_vpH) y1 = dspr->_vpH - dy;
+    if (x0 >= x1 || y0 >= y1) return true;
+
+    uint16_t tswap = transp>>8 | transp<<8; // Working with swapped color bytes
+
+    // 8 bpp pixels are only transparent if they expand to the transparent colour
+    uint8_t  t8 = (uint8_t)((transp & 0xE000)>>8 | (transp & 0x0700)>>6 | (transp & 0x0018)>>3);
+    uint16_t t16 = 0;
+    if (t8 != 0) {
+      const uint8_t blue[] = {0, 11, 21, 31};
+      t16 =   (t8 & 0xE0)<<8 | (t8 & 0xC0)<<5
+            | (t8 & 0x1C)<<6 | (t8 & 0x1C)<<3
+            | blue[t8 & 0x03];
+    }
+    bool has8 = (t16 == transp);
+
+    for (int32_t ys = y0; ys < y1; ys++) {
+      int32_t xs = x0;
+      int32_t drow = dx + (dy + ys) * dspr->_iwidth;
+
+      while (xs < x1) {
+        int32_t start;
+        if (_bpp == 16) {
+          const uint16_t *src = _img + ys * _iwidth;
+          while (xs < x1 && src[xs] == tswap) xs++;
+          start = xs;
+          while (xs < x1 && src[xs] != tswap) xs++;
+          if (xs == start) break;
+          if (ds_bpp == 16) memcpy(dspr->_img + drow + start, src + start, (xs - start) << 1);
+          else {
+            uint8_t *out = dspr->_img8 + drow;
+            for (int32_t i = start; i < xs; i++) {
+              uint16_t color = src[i];
+              out[i] = (uint8_t)((color & 0xE0) | (color & 0x07)<<2 | (color & 0x1800)>>11);
+            }
+          }
+        }
+        else {
+          const uint8_t *src = _img8 + ys * _iwidth;
+          while (xs < x1 && has8 && src[xs] == t8) xs++;
+          start = xs;
+          while (xs < x1 && !(has8 && src[xs] == t8)) xs++;
+          if (xs == start) break;
+          memcpy(dspr->_img8 + drow + start, src + start, xs - start);
+        }
+      }
+    }
+    return true;
+  }
+
   bool oldSwapBytes = dspr->getSwapBytes();
   uint16_t sline_buffer[width()];
 
@@ -2476,14 +2733,22 @@ void TFT_eSprite::drawGlyph(uint16_t code)
     }
 
     uint8_t* pbuffer = nullptr;
-    const uint8_t* gPtr = (const uint8_t*) gFont.gArray;
+    const uint8_t* gPtr = nullptr; // Glyph bitmap in memory
 
 #ifdef FONT_FS_AVAILABLE
     if (fs_font) {
-      fontFile.seek(gBitmap[gNum], fs::SeekSet); // This is slow for a significant position shift!
-      pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+#ifdef SMOOTH_FONT_CACHE_ENABLED
+      gPtr = getCachedBitmap(gNum);
+      if (!gPtr)
+#endif
+      {
+        fontFile.seek(gBitmap[gNum], fs::SeekSet); // This is slow for a significant position shift!
+        pbuffer =  (uint8_t*)malloc(gWidth[gNum]);
+      }
     }
+    else
 #endif
+    gPtr = (const uint8_t*) gFont.gArray + gBitmap[gNum];
 
     int16_t cy = cursor_y + gFont.maxAscent - gdY[gNum];
     int16_t cx = cursor_x + gdX[gNum];
@@ -2528,7 +2793,7 @@ void TFT_eSprite::drawGlyph(uint16_t code)
     for (int32_t y = 0; y < gHeight[gNum]; y++)
     {
 #ifdef FONT_FS_AVAILABLE
-      if (fs_font) {
+      if (pbuffer) {
         fontFile.read(pbuffer, gWidth[gNum]);
       }
 #endif
@@ -2536,10 +2801,10 @@ void TFT_eSprite::drawGlyph(uint16_t code)
       for (int32_t x = 0; x < gWidth[gNum]; x++)
       {
 #ifdef FONT_FS_AVAILABLE
-        if (fs_font) pixel = pbuffer[x];
+        if (pbuffer) pixel = pbuffer[x];
         else
 #endif
-        pixel = pgm_read_byte(gPtr + gBitmap[gNum] + x + gWidth[gNum] * y);
+        pixel = pgm_read_byte(gPtr + x + gWidth[gNum] * y);
 
         if (pixel)
         {
@@ -159,6 +159,13 @@ class TFT_eSprite : public TFT_eSPI {
   void     begin_nin_write(void) { ; }
   void     end_nin_write(void) { ; }
 
+           // True if readPixel() is a plain read of the buffer (no viewport, datum or 1bpp rotation)
+  bool     readDirect(void);
+           // Limit a rotated destination row to the steps that map inside the Sprite
+  bool     getRotatedSpan(int32_t *xs, int32_t *ys, int32_t *x0, int32_t *x1);
+           // Read count rotated pixels as byte swapped 565 colours, starting at xs, ys
+  void     readRotatedSpan(uint16_t *buffer, int32_t count, int32_t xs, int32_t ys);
+
  protected:
 
   uint8_t  _bpp;     // bits per pixel (1, 4, 8 or 16)
@@ -769,13 +769,31 @@ void IRAM_ATTR dc_callback(spi_transaction_t *spi_tx)
 
 /***************************************************************************************
 ** Function name:           dma_end_callback
-** Description:             Clear DMA run flag to stop retransmission loop
+** Description:             Clear DMA run flag to stop retransmission loop and notify
+**                          the sketch that the transfer is complete
 ***************************************************************************************/
 extern "C" void dma_end_callback();
 
+static void (*dmaCompleteCallback)(void* param) = nullptr;
+static void* dmaCompleteParam = nullptr;
+
 void IRAM_ATTR dma_end_callback(spi_transaction_t *spi_tx)
 {
-  WRITE_PERI_REG(SPI_DMA_CONF_REG(spi_host), 0);
+  #ifndef CONFIG_IDF_TARGET_ESP32
+    WRITE_PERI_REG(SPI_DMA_CONF_REG(spi_host), 0);
+  #endif
+  if (dmaCompleteCallback) dmaCompleteCallback(dmaCompleteParam);
+}
+
+/***************************************************************************************
+** Function name:           setDMACompleteCallback
+** Description:             Set function called from the SPI interrupt after each DMA transfer
+***************************************************************************************/
+void TFT_eSPI::setDMACompleteCallback(void (*callback)(void* param), void* param)
+{
+  dmaCompleteCallback = nullptr; // Never call a callback with the wrong parameter
+  dmaCompleteParam = param;
+  dmaCompleteCallback = callback;
 }
 
 /***************************************************************************************
@@ -821,11 +839,7 @@ bool TFT_eSPI::initDMA(bool ctrl_cs)
     .flags = SPI_DEVICE_NO_DUMMY, //0,
     .queue_size = 1,
     .pre_cb = 0, //dc_callback, //Callback to handle D/C line
-    #ifdef CONFIG_IDF_TARGET_ESP32
-      .post_cb = 0
-    #else
-      .post_cb = dma_end_callback
-    #endif
+    .post_cb = dma_end_callback
   };
   ret = spi_bus_initialize(spi_host, &buscfg, DMA_CHANNEL);
   ESP_ERROR_CHECK(ret);
@@ -795,6 +795,13 @@ class TFT_eSPI : public Print { friend class TFT_eSprite; // Sprite class has ac
   bool     dmaBusy(void); // returns true if DMA is still in progress
   void     dmaWait(void); // wait until DMA is complete
 
+#if defined (ESP32) // ESP32 only at the moment
+           // Set a function to be called when a DMA transfer is complete, e.g. to release the buffer
+           // to a graphics library. The callback runs in the SPI interrupt, so it must be short and
+           // must not call any TFT_eSPI functions. Pass nullptr to remove the callback.
+  void     setDMACompleteCallback(void (*callback)(void* param), void* param = nullptr);
+#endif
+
   bool     DMA_Enabled = false;   // Flag for DMA enabled state
   uint8_t  spiBusyCheck = 0;      // Number of ESP32 transfer buffers to check
 
@@ -327,6 +327,10 @@
 // this will save ~20kbytes of FLASH
 #define SMOOTH_FONT
 
+// Uncomment to keep recently drawn glyph bitmaps of smooth font files in RAM (PSRAM if enabled),
+// the value is the cache size in bytes. Fonts loaded from arrays are not cached.
+//#define SMOOTH_FONT_CACHE 16384
+
 
 // ##################################################################################
 //
@@ -0,0 +1,105 @@
+#include "TouchCalibration.h"
+#include <math.h>
+#include <Preferences.h>
+
+static const char* NVS_NAMESPACE = "touch";
+static const char* NVS_KEY = "cal";
+
+// Zapis w NVS: wersja formatu, rozmiar ekranu i współczynniki
+struct StoredCalibration {
+    uint16_t version;
+    uint16_t width;
+    uint16_t height;
+    uint16_t reserved;
+    int32_t coefficients[6];
+};
+
+TouchCalibration::TouchCalibration() : ax(0), bx(0), cx(0), ay(0), by(0), cy(0), maxX(-1), maxY(-1) {
+}
+
+// Rozwiązanie układu v = a * rawX + b * rawY + c dla trzech punktów (wzory Cramera)
+static void solve(const TouchPoint raw[3], const int32_t value[3], double det, double& a, double& b, double& c) {
+    double x02 = raw[0].x - raw[2].x, y02 = raw[0].y - raw[2].y;
+    double x12 = raw[1].x - raw[2].x, y12 = raw[1].y - raw[2].y;
+    double v02 = value[0] - value[2], v12 = value[1] - value[2];
+    a = (v02 * y12 - v12 * y02) / det;
+    b = (x02 * v12 - x12 * v02) / det;
+    c = value[2] - a * raw[2].x - b * raw[2].y;
+}
+
+// Wartość stałoprzecinkowa lub false, jeśli nie mieści się w limicie
+static bool toFixed(double value, int32_t limit, int32_t& out) {
+    double scaled = value * (1 << TouchCalibration::SHIFT);
+    if (fabs(scaled) > limit) return false;
+    out = (int32_t)lround(scaled);
+    return true;
+}
+
+bool TouchCalibration::compute(const TouchPoint screen[3], const TouchPoint raw[3], uint16_t width, uint16_t height) {
+    double det = (double)(raw[0].x - raw[2].x) * (raw[1].y - raw[2].y) -
+                 (double)(raw[1].x - raw[2].x) * (raw[0].y - raw[2].y);
+    if (fabs(det) < 1.0 || width == 0 || height == 0) return false;
+
+    const int32_t sx[3] = {screen[0].x, screen[1].x, screen[2].x};
+    const int32_t sy[3] = {screen[0].y, screen[1].y, screen[2].y};
+    double a, b, c, d, e, f;
+    solve(raw, sx, det, a, b, c);
+    solve(raw, sy, det, d, e, f);
+
+    // +0.5 piksela w wyrazie wolnym: przesunięcie w apply() zaokrągla zamiast obcinać
+    int32_t fixed[6];
+    if (!toFixed(a, MAX_SCALE, fixed[0]) || !toFixed(b, MAX_SCALE, fixed[1]) || !toFixed(c + 0.5, MAX_OFFSET, fixed[2]) ||
+        !toFixed(d, MAX_SCALE, fixed[3]) || !toFixed(e, MAX_SCALE, fixed[4]) || !toFixed(f + 0.5, MAX_OFFSET, fixed[5])) {
+        return false;
+    }
+    ax = fixed[0];
+    bx = fixed[1];
+    cx = fixed[2];
+    ay = fixed[3];
+    by = fixed[4];
+    cy = fixed[5];
+    maxX = width - 1;
+    maxY = height - 1;
+    return true;
+}
+
+bool TouchCalibration::load(uint16_t width, uint16_t height) {
+    Preferences prefs;
+    if (!prefs.begin(NVS_NAMESPACE, true)) return false;
+    StoredCalibration stored;
+    bool ok = prefs.getBytesLength(NVS_KEY) == sizeof(stored) &&
+              prefs.getBytes(NVS_KEY, &stored, sizeof(stored)) == sizeof(stored);
+    prefs.end();
+    if (!ok || stored.version != VERSION || stored.width != width || stored.height != height) return false;
+
+    for (int i = 0; i < 6; i++) {
+        int32_t limit = i % 3 == 2 ? MAX_OFFSET : MAX_SCALE;
+        if (stored.coefficients[i] > limit || stored.coefficients[i] < -limit) return false;
+    }
+    ax = stored.coefficients[0];
+    bx = stored.coefficients[1];
+    cx = stored.coefficients[2];
+    ay = stored.coefficients[3];
+    by = stored.coefficients[4];
+    cy = stored.coefficients[5];
+    maxX = width - 1;
+    maxY = height - 1;
+    return true;
+}
+
+bool TouchCalibration::save() const {
+    if (!valid()) return false;
+    StoredCalibration stored = {VERSION, (uint16_t)(maxX + 1), (uint16_t)(maxY + 1), 0, {ax, bx, cx, ay, by, cy}};
+    Preferences prefs;
+    if (!prefs.begin(NVS_NAMESPACE, false)) return false;
+    bool ok = prefs.putBytes(NVS_KEY, &stored, sizeof(stored)) == sizeof(stored);
+    prefs.end();
+    return ok;
+}
+
+void TouchCalibration::erase() {
+    Preferences prefs;
+    if (!prefs.begin(NVS_NAMESPACE, false)) return;
+    prefs.remove(NVS_KEY);
+    prefs.end();
+}
@@ -0,0 +1,72 @@
+// ============================================================================
+// Kalibracja dotyku z trzech punktów (przekształcenie afiniczne, zapis w NVS)
+// ============================================================================
+#ifndef TOUCH_CALIBRATION_H
+#define TOUCH_CALIBRATION_H
+
+#include <stdint.h>
+
+// Punkt na ekranie (piksele) lub surowy odczyt przetwornika (0-4095)
+struct TouchPoint {
+    int32_t x;
+    int32_t y;
+};
+
+/**
+ * Przekształcenie surowego odczytu na piksele:
+ *   x = (ax * rawX + bx * rawY + cx) >> SHIFT
+ *   y = (ay * rawX + by * rawY + cy) >> SHIFT
+ * Współczynniki (stałoprzecinkowo, 1/65536) liczone są raz z trzech
+ * punktów kalibracji, więc uwzględniają skalę, przesunięcie, obrót
+ * i zamianę osi panelu, a odczyt nie wymaga dzielenia. Zaokrąglenie
+ * jest wliczone w cx i cy.
+ */
+class TouchCalibration {
+public:
+    static const int SHIFT = 16;
+    static const uint16_t VERSION = 1; // Zmiana formatu zapisu unieważnia zapisane dane
+
+    TouchCalibration();
+
+    /**
+     * Liczy współczynniki z trzech punktów nieleżących na jednej prostej
+     * @param screen Położenia celów na ekranie
+     * @param raw Surowe odczyty dotyku tych celów
+     * @param width Szerokość ekranu (wynik jest ograniczany do 0..width-1)
+     * @param height Wysokość ekranu
+     * @return false, jeśli punkty są współliniowe lub skala nie mieści się w zakresie
+     */
+    bool compute(const TouchPoint screen[3], const TouchPoint raw[3], uint16_t width, uint16_t height);
+
+    // Przelicza surowy odczyt na piksele ekranu (tylko mnożenia i przesunięcia)
+    void apply(int32_t rawX, int32_t rawY, int32_t& x, int32_t& y) const {
+        x = clamp((ax * rawX + bx * rawY + cx) >> SHIFT, maxX);
+        y = clamp((ay * rawX + by * rawY + cy) >> SHIFT, maxY);
+    }
+
+    /**
+     * Wczytuje kalibrację z NVS
+     * @return false, jeśli brak zapisu, zapis jest w innym formacie lub dla innego ekranu
+     */
+    bool load(uint16_t width, uint16_t height);
+
+    // Zapisuje kalibrację w NVS
+    bool save() const;
+
+    // Usuwa zapisaną kalibrację (następne uruchomienie poprosi o nową)
+    static void erase();
+
+    bool valid() const { return maxX >= 0; }
+
+private:
+    static const int32_t MAX_SCALE = 2 << SHIFT;   // |ax|, |bx|, |ay|, |by| (bez przepełnienia dla 12 bitów)
+    static const int32_t MAX_OFFSET = 8192 << SHIFT; // |cx|, |cy|
+
+    static int32_t clamp(int32_t value, int32_t max) { return value < 0 ? 0 : (value > max ? max : value); }
+
+    int32_t ax, bx, cx;
+    int32_t ay, by, cy;
+    int32_t maxX, maxY; // -1 = brak kalibracji
+};
+
+#endif
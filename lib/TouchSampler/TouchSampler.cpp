@@ -0,0 +1,140 @@
+#include "TouchSampler.h"
+
+// Bajty sterujące XPT2046 (pomiar różnicowy, 12 bitów)
+static const uint8_t CMD_Z1 = 0xB1;
+static const uint8_t CMD_Z2 = 0xC1;
+static const uint8_t CMD_X = 0x91;
+static const uint8_t CMD_Y = 0xD1;
+static const uint8_t CMD_Y_POWER_DOWN = 0xD0; // Ostatni pomiar włącza z powrotem PENIRQ
+
+static const uint32_t TOUCH_TASK_STACK = 2048; // Rozmiar stosu zadania w bajtach
+
+void TouchFilter::apply(const uint16_t* xs, const uint16_t* ys, uint8_t count, uint16_t& x, uint16_t& y) {
+    int32_t mx = (int32_t)median(xs, count) << 4;
+    int32_t my = (int32_t)median(ys, count) << 4;
+    if (!started) {
+        xQ4 = mx;
+        yQ4 = my;
+        started = true;
+    } else {
+        xQ4 += (mx - xQ4) >> shift;
+        yQ4 += (my - yQ4) >> shift;
+    }
+    x = (uint16_t)((xQ4 + 8) >> 4);
+    y = (uint16_t)((yQ4 + 8) >> 4);
+}
+
+uint16_t TouchFilter::median(const uint16_t* values, uint8_t count) {
+    // Sortowanie przez wstawianie - najwyżej TOUCH_MAX_OVERSAMPLE elementów
+    uint16_t sorted[TOUCH_MAX_OVERSAMPLE];
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t value = values[i];
+        uint8_t j = i;
+        for (; j > 0 && sorted[j - 1] > value; j--) sorted[j] = sorted[j - 1];
+        sorted[j] = value;
+    }
+    if (count & 1) return sorted[count / 2];
+    return (uint16_t)((sorted[count / 2 - 1] + sorted[count / 2] + 1) / 2);
+}
+
+TouchSampler::TouchSampler(SPIClass& spi, uint8_t csPin, uint8_t irqPin, const TouchSamplerConfig& config)
+    : spi(spi), csPin(csPin), irqPin(irqPin), settings(config), filter(config.iirShift), irqPending(true),
+      taskHandle(nullptr), active(false), pressed(false), releasePending(false), last(), batchCount(0) {
+    if (settings.oversample < 1) settings.oversample = 1;
+    if (settings.oversample > TOUCH_MAX_OVERSAMPLE) settings.oversample = TOUCH_MAX_OVERSAMPLE;
+
+    // Komendy paczki: Z1, Z2, odrzucany X, X..., odrzucany Y, Y...; pierwszy pomiar po zmianie kanału jest zaszumiony
+    uint8_t commands[COMMANDS];
+    uint8_t n = 0;
+    commands[n++] = CMD_Z1;
+    commands[n++] = CMD_Z2;
+    for (uint8_t i = 0; i <= settings.oversample; i++) commands[n++] = CMD_X;
+    for (uint8_t i = 0; i <= settings.oversample; i++) commands[n++] = CMD_Y;
+    commands[n - 1] = CMD_Y_POWER_DOWN;
+    commandCount = n;
+
+    // Komenda i co drugi bajt, wynik komendy i w bajtach 2i+1 i 2i+2 (jak kolejne transfer16() sterownika)
+    frameBytes = 2 * (size_t)n + 1;
+    memset(tx, 0, sizeof(tx));
+    for (uint8_t i = 0; i < n; i++) tx[2 * i] = commands[i];
+}
+
+void TouchSampler::begin() {
+    pinMode(csPin, OUTPUT);
+    digitalWrite(csPin, HIGH);
+    pinMode(irqPin, INPUT);
+    attachInterruptArg(digitalPinToInterrupt(irqPin), onIrq, this, FALLING);
+}
+
+bool TouchSampler::start(UBaseType_t priority, BaseType_t core) {
+    return xTaskCreatePinnedToCore(task, "touch", TOUCH_TASK_STACK, this, priority, &taskHandle, core) == pdPASS;
+}
+
+uint16_t TouchSampler::result(uint8_t command) const {
+    return (uint16_t)(((rx[2 * command + 1] << 8) | rx[2 * command + 2]) >> 3) & 0x0FFF;
+}
+
+bool TouchSampler::step() {
+    bool woken = irqPending.exchange(false);
+    if (releasePending) releasePending = !queue.push(last);
+    if (!active && !woken) return releasePending;
+
+    spi.beginTransaction(SPISettings(settings.spiClock, MSBFIRST, SPI_MODE0));
+    digitalWrite(csPin, LOW);
+    spi.transferBytes(tx, rx, frameBytes);
+    digitalWrite(csPin, HIGH);
+    spi.endTransaction();
+    batchCount++;
+
+    int32_t z = (int32_t)result(0) + 4095 - result(1);
+    if (z < 0) z = 0;
+    active = z >= settings.releaseThreshold;
+
+    if (z >= settings.pressThreshold) {
+        uint8_t n = settings.oversample;
+        uint16_t xs[TOUCH_MAX_OVERSAMPLE], ys[TOUCH_MAX_OVERSAMPLE];
+        for (uint8_t i = 0; i < n; i++) {
+            xs[i] = result(3 + i);
+            ys[i] = result(4 + n + i);
+        }
+        filter.apply(xs, ys, n, last.x, last.y);
+        last.z = (uint16_t)z;
+        last.timeMs = millis();
+        last.pressed = true;
+        pressed = true;
+        queue.push(last);
+    } else if (pressed) {
+        // Puszczenie w miejscu ostatniego dotyku
+        filter.reset();
+        last.z = 0;
+        last.timeMs = millis();
+        last.pressed = false;
+        pressed = false;
+        releasePending = !queue.push(last);
+    }
+    return active || releasePending;
+}
+
+void IRAM_ATTR TouchSampler::onIrq(void* param) {
+    TouchSampler* self = static_cast<TouchSampler*>(param);
+    self->irqPending.store(true);
+    if (self->taskHandle) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(self->taskHandle, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+}
+
+// Zadanie próbkowania: co periodMs podczas dotyku, poza tym śpi do przerwania TIRQ
+void TouchSampler::task(void* param) {
+    TouchSampler* self = static_cast<TouchSampler*>(param);
+    TickType_t lastWake = xTaskGetTickCount();
+    for (;;) {
+        if (self->step()) {
+            vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(self->settings.periodMs));
+        } else {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            lastWake = xTaskGetTickCount();
+        }
+    }
+}
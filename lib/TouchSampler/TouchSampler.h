@@ -0,0 +1,174 @@
+// ============================================================================
+// Próbkowanie dotyku XPT2046 w tle: przerwanie TIRQ, filtr i kolejka zdarzeń
+// ============================================================================
+#ifndef TOUCH_SAMPLER_H
+#define TOUCH_SAMPLER_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <Arduino.h>
+#include <SPI.h>
+
+#define TOUCH_MAX_OVERSAMPLE 9 // Pomiary X i Y w jednej paczce (45 bajtów mieści się w FIFO SPI)
+
+// Parametry próbkowania i filtru (wartości domyślne jak progi XPT2046_Touchscreen)
+struct TouchSamplerConfig {
+    uint8_t oversample;        // Pomiary X i Y na paczkę (1-TOUCH_MAX_OVERSAMPLE), wynik to mediana
+    uint8_t iirShift;          // Wygładzanie między paczkami: krok 1/2^iirShift (0 = bez filtru IIR)
+    uint16_t pressThreshold;   // Nacisk (z) uznawany za dotyk
+    uint16_t releaseThreshold; // Poniżej: palec zdjęty, czekanie na przerwanie TIRQ
+    uint32_t periodMs;         // Okres próbkowania podczas dotyku
+    uint32_t spiClock;         // Zegar SPI w Hz
+
+    TouchSamplerConfig()
+        : oversample(7), iirShift(1), pressThreshold(400), releaseThreshold(75), periodMs(10), spiClock(2000000) {}
+};
+
+// Zdarzenie dotyku w surowych współrzędnych przetwornika (0-4095)
+struct TouchEvent {
+    uint16_t x;
+    uint16_t y;
+    uint16_t z;      // Nacisk
+    uint32_t timeMs; // Czas pomiaru (millis())
+    bool pressed;
+};
+
+/**
+ * Kolejka zdarzeń bez blokad: jeden producent (zadanie próbkowania)
+ * i jeden konsument (wątek LVGL). Przy pełnej kolejce nowe zdarzenie
+ * jest odrzucane i liczone w dropped().
+ */
+template <size_t Capacity>
+class TouchQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    TouchQueue() : head(0), tail(0), droppedCount(0) {}
+
+    bool push(const TouchEvent& event) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= Capacity) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        events[h & MASK] = event;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(TouchEvent& event) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        event = events[t & MASK];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+    bool empty() const { return size() == 0; }
+    uint32_t dropped() const { return droppedCount.load(std::memory_order_relaxed); }
+
+private:
+    static const uint32_t MASK = Capacity - 1;
+
+    TouchEvent events[Capacity];
+    std::atomic<uint32_t> head; // Zapisywany tylko przez producenta
+    std::atomic<uint32_t> tail; // Zapisywany tylko przez konsumenta
+    std::atomic<uint32_t> droppedCount;
+};
+
+/**
+ * Filtr paczki pomiarów: mediana odrzuca pojedyncze skoki przetwornika,
+ * a IIR (stałoprzecinkowo, 1/16 jednostki) wygładza drżenie między
+ * kolejnymi paczkami. Pierwsza paczka po dotknięciu ustawia stan filtru
+ * bez opóźnienia.
+ */
+class TouchFilter {
+public:
+    explicit TouchFilter(uint8_t iirShift = 0) : shift(iirShift), started(false), xQ4(0), yQ4(0) {}
+
+    /**
+     * @param xs Pomiary X (kolejność nie ma znaczenia)
+     * @param ys Pomiary Y
+     * @param count Liczba pomiarów (1-TOUCH_MAX_OVERSAMPLE)
+     * @param x Wynik X po filtrze
+     * @param y Wynik Y po filtrze
+     */
+    void apply(const uint16_t* xs, const uint16_t* ys, uint8_t count, uint16_t& x, uint16_t& y);
+
+    // Zdjęcie palca: następna paczka zaczyna filtr od nowa
+    void reset() { started = false; }
+
+    static uint16_t median(const uint16_t* values, uint8_t count);
+
+private:
+    uint8_t shift;
+    bool started;
+    int32_t xQ4, yQ4;
+};
+
+/**
+ * Próbkowanie XPT2046 we własnym zadaniu FreeRTOS. Zbocze opadające TIRQ
+ * budzi zadanie, które co periodMs wykonuje jedną transakcję SPI: Z1, Z2
+ * i oversample pomiarów X oraz Y wysłanych jednym transferBytes(), filtruje
+ * je i dopisuje zdarzenie do kolejki. Po zdjęciu palca dopisuje zdarzenie
+ * puszczenia i znów czeka na przerwanie, nie używając magistrali.
+ */
+class TouchSampler {
+public:
+    static const size_t QUEUE_SIZE = 16;
+
+    TouchSampler(SPIClass& spi, uint8_t csPin, uint8_t irqPin, const TouchSamplerConfig& config = TouchSamplerConfig());
+
+    // Konfiguruje CS i przerwanie TIRQ (magistrala musi być już uruchomiona)
+    void begin();
+
+    /**
+     * Uruchamia zadanie próbkowania
+     * @return false, jeśli nie udało się utworzyć zadania
+     */
+    bool start(UBaseType_t priority, BaseType_t core);
+
+    /**
+     * Jeden krok zadania: paczka pomiarów, jeśli dotyk trwa lub było przerwanie
+     * @return true, jeśli dotyk trwa i kolejny krok ma nastąpić po periodMs
+     */
+    bool step();
+
+    // Pobiera najstarsze zdarzenie (wątek LVGL)
+    bool read(TouchEvent& event) { return queue.pop(event); }
+    bool available() const { return !queue.empty(); }
+
+    uint32_t batches() const { return batchCount; }
+    uint32_t dropped() const { return queue.dropped(); }
+    const TouchSamplerConfig& config() const { return settings; }
+
+private:
+    static const uint8_t COMMANDS = 4 + 2 * TOUCH_MAX_OVERSAMPLE; // Z1, Z2, 2 pomiary odrzucane, X i Y
+    static const size_t FRAME_BYTES = 2 * COMMANDS + 1;
+
+    static void IRAM_ATTR onIrq(void* param);
+    static void task(void* param);
+
+    uint16_t result(uint8_t command) const;
+
+    SPIClass& spi;
+    uint8_t csPin, irqPin;
+    TouchSamplerConfig settings;
+    TouchFilter filter;
+    TouchQueue<QUEUE_SIZE> queue;
+    std::atomic<bool> irqPending;
+    TaskHandle_t taskHandle;
+    bool active;         // Palec na ekranie lub nacisk powyżej releaseThreshold
+    bool pressed;        // Ostatnie zdarzenie w kolejce to dotyk
+    bool releasePending; // Zdarzenie puszczenia czeka na miejsce w kolejce
+    TouchEvent last;
+    uint32_t batchCount;
+    uint8_t commandCount;
+    size_t frameBytes;
+    uint8_t tx[FRAME_BYTES];
+    uint8_t rx[FRAME_BYTES];
+};
+
+#endif
@@ -76,6 +76,23 @@ TS_Point XPT2046_Touchscreen::getPoint()
 	return TS_Point(xraw, yraw, zraw);
 }
 
+// touched() followed by getPoint() with a single update(). While the
+// TIRQ pin has not signalled a touch since the last release, no SPI
+// transfer is made and the sample is returned as not valid.
+TS_Sample XPT2046_Touchscreen::readSample()
+{
+	TS_Sample s;
+	if (!isrWake) return s;
+	update();
+	s.z = zraw;
+	s.valid = (zraw >= Z_THRESHOLD);
+	if (s.valid) {
+		s.x = xraw;
+		s.y = yraw;
+	}
+	return s;
+}
+
 bool XPT2046_Touchscreen::tirqTouched()
 {
 	return (isrWake);
@@ -45,6 +45,14 @@ public:
 	int16_t x, y, z;
 };
 
+// One reading of the controller: position and pressure are valid together
+class TS_Sample {
+public:
+	TS_Sample(void) : x(0), y(0), z(0), valid(false) {}
+	int16_t x, y, z;
+	bool valid;
+};
+
 class XPT2046_Touchscreen {
 public:
 	constexpr XPT2046_Touchscreen(uint8_t cspin, uint8_t tirq=255)
@@ -55,6 +63,7 @@ public:
 #endif
 
 	TS_Point getPoint();
+	TS_Sample readSample();
 	bool tirqTouched();
 	bool touched();
 	void readData(uint16_t *x, uint16_t *y, uint8_t *z);
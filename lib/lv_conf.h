@@ -26,7 +26,7 @@
 /*Color depth: 8 (A8), 16 (RGB565), 24 (RGB888), 32 (XRGB8888)*/
 #define LV_COLOR_DEPTH 16  //16
 
-#define LV_COLOR_16_SWAP 0  //(LV_COLOR_16_SWAP is abandoned by LVGL9, but lv_draw_sw_rgb565_swap() is added to display flush function)
+#define LV_COLOR_16_SWAP 0  //(LV_COLOR_16_SWAP is abandoned by LVGL9, the display uses LV_COLOR_FORMAT_RGB565_SWAPPED instead, see DisplayFlush)
 
 /*=========================
    STDLIB WRAPPER SETTINGS
@@ -136,6 +136,11 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /* Cache the color maps of the gradients (in bytes).
+     * A gradient of N pixels uses about N * 4 bytes, the least recently used ones are freed first.
+     * 0: to disable caching */
+    #define LV_DRAW_SW_GRADIENT_CACHE_SIZE (4 * 1024)
+
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -430,6 +435,16 @@
  *Compiler error will be triggered if a font needs it.*/
 #define LV_FONT_FMT_TXT_LARGE 0
 
+/*Cache the glyph ids of the letters and the kern pair values per font.
+ *U+0000..U+00FF use a table, other letters a hashed cache with this many entries (power of 2).
+ *Needs about 512 + LV_FONT_FMT_TXT_CACHE_SIZE * 8 bytes for each used font.
+ *0: to disable caching*/
+#define LV_FONT_FMT_TXT_CACHE_SIZE 16
+
+/*Cache the glyph bitmaps of the fonts decoded to A8 (in bytes).
+ *The least recently used glyphs are freed first. 0: to disable caching*/
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (8 * 1024)
+
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
@@ -529,6 +544,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LINE_CACHE 1     /*Store the line breaks and line widths of the labels to measure the text only when it changes*/
     #define LV_LABEL_WAIT_CHAR_COUNT 3  /*The count of wait chart*/
 #endif
 
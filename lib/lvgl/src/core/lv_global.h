@@ -118,6 +118,11 @@ typedef struct _lv_global_t {
 #if LV_DRAW_SW_COMPLEX
     _lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if defined(LV_DRAW_SW_GRADIENT_CACHE_SIZE) && LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    lv_cache_t * sw_grad_cache;
+    uint32_t sw_grad_cache_hit_cnt;
+    uint32_t sw_grad_cache_miss_cnt;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
@@ -175,6 +180,16 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if defined(LV_FONT_FMT_TXT_CACHE_SIZE) && LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    struct _lv_font_fmt_txt_cache_t * font_fmt_txt_cache;
+    lv_mutex_t font_fmt_txt_cache_mutex;
+#endif
+#if defined(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE) && LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    lv_cache_t * font_fmt_txt_glyph_cache;
+    uint32_t font_fmt_txt_glyph_cache_hit_cnt;
+    uint32_t font_fmt_txt_glyph_cache_miss_cnt;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
@@ -375,6 +375,8 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         lv_event_remove_all(&obj->spec_attr->event_list);
 
+        _lv_obj_layer_cache_free(obj);
+
         lv_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
@@ -208,12 +208,17 @@ typedef struct {
     int32_t ext_click_pad;          /**< Extra click padding in all direction*/
     int32_t ext_draw_size;          /**< EXTend the size in every direction for drawing.*/
 
+    lv_draw_buf_t * layer_cache;    /**< The object rendered with its transformation, see `lv_obj_set_layer_cache`*/
+    lv_area_t layer_cache_area;     /**< Area of `layer_cache` relative to the object's coordinates*/
+    lv_area_t layer_cache_dirty;    /**< Area to redraw in `layer_cache` relative to the object's coordinates*/
+
     uint16_t child_cnt;             /**< Number of children*/
     uint16_t scrollbar_mode : 2;    /**< How to display scrollbars, see `lv_scrollbar_mode_t`*/
     uint16_t scroll_snap_x : 2;     /**< Where to align the snappable children horizontally, see `lv_scroll_snap_t`*/
     uint16_t scroll_snap_y : 2;     /**< Where to align the snappable children vertically*/
     uint16_t scroll_dir : 4;        /**< The allowed scroll direction(s), see `lv_dir_t`*/
     uint16_t layer_type : 2;        /**< Cache the layer type here. Element of @lv_intermediate_layer_type_t */
+    uint16_t layer_cache_en : 1;    /**< Keep the transformed layer in `layer_cache` between refreshes*/
 } _lv_obj_spec_attr_t;
 
 struct _lv_obj_t {
@@ -11,6 +11,7 @@
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/cache/lv_image_cache.h"
 
 /*********************
  *      DEFINES
@@ -319,6 +320,66 @@ lv_layer_type_t _lv_obj_get_layer_type(const lv_obj_t * obj)
     else return LV_LAYER_TYPE_NONE;
 }
 
+void lv_obj_set_layer_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(en) {
+        lv_obj_allocate_spec_attr(obj);
+        obj->spec_attr->layer_cache_en = 1;
+    }
+    else if(obj->spec_attr) {
+        _lv_obj_layer_cache_free(obj);
+        obj->spec_attr->layer_cache_en = 0;
+    }
+
+    lv_obj_invalidate(obj);
+}
+
+bool lv_obj_get_layer_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return obj->spec_attr && obj->spec_attr->layer_cache_en;
+}
+
+void _lv_obj_layer_cache_invalidate(const lv_obj_t * obj, const lv_area_t * area)
+{
+    /*The area can be mapped to the cached layer only if there is no other transformation in between*/
+    bool transformed = false;
+    const lv_obj_t * parent = obj;
+    while(parent) {
+        _lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+        if(spec_attr && spec_attr->layer_cache) {
+            lv_area_t dirty;
+            if(transformed) {
+                int32_t ext_draw_size = spec_attr->ext_draw_size;
+                lv_area_copy(&dirty, &parent->coords);
+                lv_area_increase(&dirty, ext_draw_size, ext_draw_size);
+            }
+            else {
+                lv_area_copy(&dirty, area);
+            }
+            lv_area_move(&dirty, -parent->coords.x1, -parent->coords.y1);
+
+            if(spec_attr->layer_cache_dirty.x2 < spec_attr->layer_cache_dirty.x1) spec_attr->layer_cache_dirty = dirty;
+            else _lv_area_join(&spec_attr->layer_cache_dirty, &spec_attr->layer_cache_dirty, &dirty);
+        }
+
+        if(_lv_obj_get_layer_type(parent) == LV_LAYER_TYPE_TRANSFORM) transformed = true;
+        parent = lv_obj_get_parent(parent);
+    }
+}
+
+void _lv_obj_layer_cache_free(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->layer_cache == NULL) return;
+
+    lv_image_cache_drop(obj->spec_attr->layer_cache);
+    lv_draw_buf_destroy(obj->spec_attr->layer_cache);
+    obj->spec_attr->layer_cache = NULL;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -107,6 +107,39 @@ int32_t _lv_obj_get_ext_draw_size(const lv_obj_t * obj);
 
 lv_layer_type_t _lv_obj_get_layer_type(const lv_obj_t * obj);
 
+/**
+ * Keep the object rendered with its transformation (rotation, scale) between refreshes.
+ * The cached layer is redrawn only where the object or its children were invalidated,
+ * so redrawing the area around the object (e.g. a background update) doesn't render the object again.
+ * If the object is rotated by 90, 180 or 270 degrees without scaling only the invalidated part is redrawn,
+ * else the whole layer.
+ * Requires a buffer of the transformed object's size in ARGB8888 format.
+ * @param obj       pointer to an object
+ * @param en        true: enable the cache; false: disable the cache and free its buffer
+ */
+void lv_obj_set_layer_cache(lv_obj_t * obj, bool en);
+
+/**
+ * Tell whether the object's transformed layer is cached
+ * @param obj       pointer to an object
+ * @return          true: the layer cache is enabled
+ */
+bool lv_obj_get_layer_cache(const lv_obj_t * obj);
+
+/**
+ * Mark an area of the cached layers of the object and its parents to be redrawn.
+ * Called when the object is invalidated.
+ * @param obj       pointer to an object
+ * @param area      the invalidated area in absolute coordinates
+ */
+void _lv_obj_layer_cache_invalidate(const lv_obj_t * obj, const lv_area_t * area);
+
+/**
+ * Free the cached layer of an object
+ * @param obj       pointer to an object
+ */
+void _lv_obj_layer_cache_free(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
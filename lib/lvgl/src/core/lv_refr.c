@@ -17,6 +17,7 @@
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/cache/lv_image_cache.h"
 #include "lv_global.h"
 
 /*********************
@@ -41,6 +42,12 @@ static void refr_area_part(lv_layer_t * layer);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj);
+static void layer_draw_dsc_init(lv_obj_t * obj, lv_draw_image_dsc_t * dsc, const lv_area_t * buf_area);
+static lv_result_t refr_obj_from_layer_cache(lv_layer_t * layer, lv_obj_t * obj, lv_opa_t opa);
+static lv_result_t layer_cache_update(lv_obj_t * obj, const lv_area_t * layer_area,
+                                      const lv_draw_image_dsc_t * tr_dsc, const lv_area_t * dirty, bool right_angle);
+static void layer_render_sync(lv_layer_t * layer, lv_obj_t * obj, const lv_draw_image_dsc_t * img_dsc,
+                              const lv_area_t * img_coords);
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
@@ -291,14 +298,27 @@ void _lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
         if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
+    /*If no place for the area join it into the area which grows the least.
+     *This way the areas become clusters of nearby areas instead of redrawing the whole screen.*/
+    if(disp->inv_p >= LV_INV_BUF_SIZE) {
+        uint32_t best_i = 0;
+        uint32_t best_growth = UINT32_MAX;
+        lv_area_t joined_area;
+        for(i = 0; i < disp->inv_p; i++) {
+            _lv_area_join(&joined_area, &disp->inv_areas[i], &com_area);
+            uint32_t growth = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+            if(growth < best_growth) {
+                best_growth = growth;
+                best_i = i;
+            }
+        }
+        _lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], &com_area);
+    }
     /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    else {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -350,6 +370,8 @@ void _lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    lv_memzero(&disp_refr->refr_stats, sizeof(lv_display_refr_stats_t));
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
 
     /*Refresh the screen's layout if required*/
@@ -369,6 +391,12 @@ void _lv_display_refr_timer(lv_timer_t * tmr)
         goto refr_finish;
     }
 
+    disp_refr->refr_stats.inv_area_cnt = disp_refr->inv_p;
+    uint32_t a;
+    for(a = 0; a < disp_refr->inv_p; a++) {
+        disp_refr->refr_stats.px_invalidated += lv_area_get_size(&disp_refr->inv_areas[a]);
+    }
+
     lv_refr_join_area();
     refr_sync_areas();
     refr_invalid_areas();
@@ -416,7 +444,12 @@ refr_finish:
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the invalidated areas if rendering their bounding box is cheaper than rendering them separately.
+ * Every area has a fixed cost (walking the object tree, calling flush_cb) given in pixels by
+ * `disp->area_overhead_px`, so two areas are joined if the bounding box has fewer pixels than
+ * the two areas together plus the overhead. Joining makes an area larger which might make it
+ * worth joining with an area skipped before, so the passes are repeated until nothing changes.
+ * As there are at most LV_INV_BUF_SIZE areas a simple pairwise check is the cheapest.
  */
 static void lv_refr_join_area(void)
 {
@@ -424,33 +457,33 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
-
-            /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+    bool joined;
+    do {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                    continue;
+                }
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                /*Join two area only if it's cheaper than rendering them separately*/
+                if(lv_area_get_size(&joined_area) < lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                   lv_area_get_size(&disp_refr->inv_areas[join_from]) + disp_refr->area_overhead_px) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    joined = true;
+                }
             }
         }
-    }
+    } while(joined);
     LV_PROFILER_END;
 }
 
@@ -563,6 +596,7 @@ static void refr_invalid_areas(void)
 
             if(i == last_i) disp_refr->last_area = 1;
             disp_refr->last_part = 0;
+            disp_refr->refr_stats.area_cnt++;
             refr_area(&disp_refr->inv_areas[i]);
         }
     }
@@ -623,7 +657,7 @@ static void refr_area(const lv_area_t * area_p)
     }
 
     /*Normal refresh: draw the area in parts*/
-    /*Calculate the max row num*/
+    /*Calculate the max row num. The buffer's size is fixed so narrow areas are drawn in taller parts*/
     int32_t w = lv_area_get_width(area_p);
     int32_t h = lv_area_get_height(area_p);
     int32_t y2 = area_p->y2 >= lv_display_get_vertical_resolution(disp_refr) ?
@@ -671,6 +705,7 @@ static void refr_area_part(lv_layer_t * layer)
 {
     LV_PROFILER_BEGIN;
     disp_refr->refreshed_area = layer->_clip_area;
+    disp_refr->refr_stats.px_rendered += lv_area_get_size(&layer->_clip_area);
 
     /* In single buffered mode wait here until the buffer is freed.
      * Else we would draw into the buffer while it's still being transferred to the display*/
@@ -900,6 +935,10 @@ void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
         lv_result_t res = layer_get_area(layer, obj, layer_type, &layer_area_full, &obj_draw_size);
         if(res != LV_RESULT_OK) return;
 
+        if(layer_type == LV_LAYER_TYPE_TRANSFORM && lv_obj_get_layer_cache(obj)) {
+            if(refr_obj_from_layer_cache(layer, obj, opa) == LV_RESULT_OK) return;
+        }
+
         /*Simple layers can be subdivied into smaller layers*/
         uint32_t max_rgb_row_height = lv_area_get_height(&layer_area_full);
         uint32_t max_argb_row_height = lv_area_get_height(&layer_area_full);
@@ -931,34 +970,9 @@ void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
                                                           area_need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
             lv_obj_redraw(new_layer, obj);
 
-            lv_point_t pivot = {
-                .x = lv_obj_get_style_transform_pivot_x(obj, 0),
-                .y = lv_obj_get_style_transform_pivot_y(obj, 0)
-            };
-
-            if(LV_COORD_IS_PCT(pivot.x)) {
-                pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
-            }
-            if(LV_COORD_IS_PCT(pivot.y)) {
-                pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
-            }
-
             lv_draw_image_dsc_t layer_draw_dsc;
-            lv_draw_image_dsc_init(&layer_draw_dsc);
-            layer_draw_dsc.pivot.x = obj->coords.x1 + pivot.x - new_layer->buf_area.x1;
-            layer_draw_dsc.pivot.y = obj->coords.y1 + pivot.y - new_layer->buf_area.y1;
-
+            layer_draw_dsc_init(obj, &layer_draw_dsc, &new_layer->buf_area);
             layer_draw_dsc.opa = opa;
-            layer_draw_dsc.rotation = lv_obj_get_style_transform_rotation(obj, 0);
-            while(layer_draw_dsc.rotation > 3600) layer_draw_dsc.rotation -= 3600;
-            while(layer_draw_dsc.rotation < 0) layer_draw_dsc.rotation += 3600;
-            layer_draw_dsc.scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
-            layer_draw_dsc.scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
-            layer_draw_dsc.skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
-            layer_draw_dsc.skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
-            layer_draw_dsc.blend_mode = lv_obj_get_style_blend_mode(obj, 0);
-            layer_draw_dsc.antialias = disp_refr->antialiasing;
-            layer_draw_dsc.bitmap_mask_src = lv_obj_get_style_bitmap_mask_src(obj, 0);
             layer_draw_dsc.original_area = obj_draw_size;
             layer_draw_dsc.src = new_layer;
 
@@ -969,6 +983,233 @@ void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
     }
 }
 
+/**
+ * Initialize the descriptor to draw the transformed layer of an object
+ * @param obj       the object with a transformed layer
+ * @param dsc       the descriptor to initialize
+ * @param buf_area  area of the layer's buffer, the pivot is set relative to it
+ */
+static void layer_draw_dsc_init(lv_obj_t * obj, lv_draw_image_dsc_t * dsc, const lv_area_t * buf_area)
+{
+    lv_point_t pivot = {
+        .x = lv_obj_get_style_transform_pivot_x(obj, 0),
+        .y = lv_obj_get_style_transform_pivot_y(obj, 0)
+    };
+
+    if(LV_COORD_IS_PCT(pivot.x)) {
+        pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
+    }
+    if(LV_COORD_IS_PCT(pivot.y)) {
+        pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
+    }
+
+    lv_draw_image_dsc_init(dsc);
+    dsc->pivot.x = obj->coords.x1 + pivot.x - buf_area->x1;
+    dsc->pivot.y = obj->coords.y1 + pivot.y - buf_area->y1;
+
+    dsc->rotation = lv_obj_get_style_transform_rotation(obj, 0);
+    while(dsc->rotation > 3600) dsc->rotation -= 3600;
+    while(dsc->rotation < 0) dsc->rotation += 3600;
+    dsc->scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
+    dsc->scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
+    dsc->skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
+    dsc->skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
+    dsc->blend_mode = lv_obj_get_style_blend_mode(obj, 0);
+    dsc->antialias = disp_refr->antialiasing;
+    dsc->bitmap_mask_src = lv_obj_get_style_bitmap_mask_src(obj, 0);
+}
+
+/**
+ * Draw an object from its cached transformed layer.
+ * The invalidated part of the cache is redrawn first.
+ * @param layer     the layer to draw to
+ * @param obj       the object to draw, it has a transformed layer
+ * @param opa       the layered opacity of the object
+ * @return          LV_RESULT_OK: the object was drawn; LV_RESULT_INVALID: the cache can't be used
+ */
+static lv_result_t refr_obj_from_layer_cache(lv_layer_t * layer, lv_obj_t * obj, lv_opa_t opa)
+{
+    _lv_obj_spec_attr_t * spec_attr = obj->spec_attr;
+
+    int32_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_t obj_draw_size;
+    lv_obj_get_coords(obj, &obj_draw_size);
+    lv_area_increase(&obj_draw_size, ext_draw_size, ext_draw_size);
+
+    lv_draw_image_dsc_t tr_dsc;
+    layer_draw_dsc_init(obj, &tr_dsc, &obj_draw_size);
+    /*The mask is applied on the screen's area, it can't be cached*/
+    if(tr_dsc.bitmap_mask_src) return LV_RESULT_INVALID;
+
+    /*Rotating by right angles maps the pixels 1:1.
+     *Else keep a transparent margin around the object as on the normal layers, so that the edges
+     *are interpolated the same way.*/
+    bool right_angle = tr_dsc.scale_x == LV_SCALE_NONE && tr_dsc.scale_y == LV_SCALE_NONE &&
+                       tr_dsc.skew_x == 0 && tr_dsc.skew_y == 0 && tr_dsc.rotation % 900 == 0;
+    lv_area_t layer_area = obj_draw_size;
+    if(!right_angle) {
+        lv_area_increase(&layer_area, 5, 5);
+        tr_dsc.pivot.x += 5;
+        tr_dsc.pivot.y += 5;
+    }
+
+    /*Where the transformed object lands. 1 px larger to surely cover the rounding*/
+    lv_area_t cache_area;
+    _lv_image_buf_get_transformed_area(&cache_area, lv_area_get_width(&layer_area), lv_area_get_height(&layer_area),
+                                       tr_dsc.rotation, tr_dsc.scale_x, tr_dsc.scale_y, &tr_dsc.pivot);
+    lv_area_move(&cache_area, layer_area.x1 - obj->coords.x1, layer_area.y1 - obj->coords.y1);
+    lv_area_increase(&cache_area, 1, 1);
+
+    if(spec_attr->layer_cache == NULL || !_lv_area_is_equal(&cache_area, &spec_attr->layer_cache_area)) {
+        _lv_obj_layer_cache_free(obj);
+        spec_attr->layer_cache = lv_draw_buf_create(lv_area_get_width(&cache_area), lv_area_get_height(&cache_area),
+                                                    LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        if(spec_attr->layer_cache == NULL) {
+            LV_LOG_WARN("Couldn't allocate the layer cache, draw the layer without it");
+            return LV_RESULT_INVALID;
+        }
+        lv_draw_buf_clear(spec_attr->layer_cache, NULL);
+        spec_attr->layer_cache_area = cache_area;
+        spec_attr->layer_cache_dirty = obj_draw_size;
+        lv_area_move(&spec_attr->layer_cache_dirty, -obj->coords.x1, -obj->coords.y1);
+    }
+
+    lv_area_t dirty = spec_attr->layer_cache_dirty;
+    if(dirty.x1 <= dirty.x2) {
+        /*Clear it first as drawing the object might invalidate it again*/
+        lv_area_set(&spec_attr->layer_cache_dirty, 0, 0, -1, -1);
+        lv_area_move(&dirty, obj->coords.x1, obj->coords.y1);
+        if(layer_cache_update(obj, &layer_area, &tr_dsc, &dirty, right_angle) != LV_RESULT_OK) {
+            _lv_obj_layer_cache_free(obj);
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    lv_draw_image_dsc_t cache_dsc;
+    lv_draw_image_dsc_init(&cache_dsc);
+    cache_dsc.src = spec_attr->layer_cache;
+    cache_dsc.opa = opa;
+    cache_dsc.blend_mode = tr_dsc.blend_mode;
+
+    lv_area_t coords = cache_area;
+    lv_area_move(&coords, obj->coords.x1, obj->coords.y1);
+    lv_draw_image(layer, &cache_dsc, &coords);
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Render the dirty area of an object again and transform it into its layer cache
+ * @param obj           the object whose cache should be updated
+ * @param layer_area    the area of the object's layer
+ * @param tr_dsc        the transformation with pivot relative to `layer_area`
+ * @param dirty         the area to update in absolute coordinates
+ * @param right_angle   true: the transformation is a rotation by a multiple of 90 degrees
+ * @return              LV_RESULT_OK: the cache is updated; LV_RESULT_INVALID: out of memory
+ */
+static lv_result_t layer_cache_update(lv_obj_t * obj, const lv_area_t * layer_area,
+                                      const lv_draw_image_dsc_t * tr_dsc, const lv_area_t * dirty, bool right_angle)
+{
+    _lv_obj_spec_attr_t * spec_attr = obj->spec_attr;
+
+    lv_area_t dirty_clipped;
+    if(!_lv_area_intersect(&dirty_clipped, dirty, layer_area)) return LV_RESULT_OK;
+
+    lv_area_t cache_coords = spec_attr->layer_cache_area;
+    lv_area_move(&cache_coords, obj->coords.x1, obj->coords.y1);
+
+    /*With right angles only the dirty part changes.
+     *Interpolation would blend in the neighbors too so redraw everything in that case.*/
+    lv_area_t render_area;
+    lv_area_t cache_clip;
+    if(right_angle) {
+        /*Render a little larger to be sure all the mapped pixels are valid*/
+        render_area = dirty_clipped;
+        lv_area_increase(&render_area, 2, 2);
+        _lv_area_intersect(&render_area, &render_area, layer_area);
+
+        lv_point_t pivot = {
+            .x = tr_dsc->pivot.x + layer_area->x1 - dirty_clipped.x1,
+            .y = tr_dsc->pivot.y + layer_area->y1 - dirty_clipped.y1
+        };
+        _lv_image_buf_get_transformed_area(&cache_clip, lv_area_get_width(&dirty_clipped),
+                                           lv_area_get_height(&dirty_clipped),
+                                           tr_dsc->rotation, tr_dsc->scale_x, tr_dsc->scale_y, &pivot);
+        lv_area_move(&cache_clip, dirty_clipped.x1, dirty_clipped.y1);
+        lv_area_increase(&cache_clip, 1, 1);
+        if(!_lv_area_intersect(&cache_clip, &cache_clip, &cache_coords)) return LV_RESULT_OK;
+    }
+    else {
+        render_area = *layer_area;
+        cache_clip = cache_coords;
+    }
+
+    lv_draw_buf_t * obj_buf = lv_draw_buf_create(lv_area_get_width(&render_area), lv_area_get_height(&render_area),
+                                                 LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    if(obj_buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate the buffer to render the object");
+        return LV_RESULT_INVALID;
+    }
+    lv_draw_buf_clear(obj_buf, NULL);
+
+    lv_layer_t obj_layer;
+    lv_memzero(&obj_layer, sizeof(obj_layer));
+    obj_layer.draw_buf = obj_buf;
+    obj_layer.buf_area = render_area;
+    obj_layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    obj_layer._clip_area = render_area;
+    layer_render_sync(&obj_layer, obj, NULL, NULL);
+
+    lv_area_t clear_area = cache_clip;
+    lv_area_move(&clear_area, -cache_coords.x1, -cache_coords.y1);
+    lv_draw_buf_clear(spec_attr->layer_cache, &clear_area);
+
+    lv_layer_t cache_layer;
+    lv_memzero(&cache_layer, sizeof(cache_layer));
+    cache_layer.draw_buf = spec_attr->layer_cache;
+    cache_layer.buf_area = cache_coords;
+    cache_layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    cache_layer._clip_area = cache_clip;
+
+    lv_draw_image_dsc_t img_dsc = *tr_dsc;
+    img_dsc.src = obj_buf;
+    img_dsc.opa = LV_OPA_COVER;
+    img_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    img_dsc.pivot.x += layer_area->x1 - render_area.x1;
+    img_dsc.pivot.y += layer_area->y1 - render_area.y1;
+    layer_render_sync(&cache_layer, NULL, &img_dsc, &render_area);
+
+    lv_image_cache_drop(obj_buf);
+    lv_draw_buf_destroy(obj_buf);
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Draw an object or an image to a standalone layer and wait until it's rendered
+ * @param layer         the layer to draw to, it isn't part of the display's layers
+ * @param obj           the object to draw or NULL to draw an image
+ * @param img_dsc       the image to draw if `obj` is NULL
+ * @param img_coords    coordinates of the image
+ */
+static void layer_render_sync(lv_layer_t * layer, lv_obj_t * obj, const lv_draw_image_dsc_t * img_dsc,
+                              const lv_area_t * img_coords)
+{
+    /*Dispatch only this layer (and the layers created on it) while it's being rendered*/
+    lv_layer_t * layer_head_old = disp_refr->layer_head;
+    disp_refr->layer_head = layer;
+
+    if(obj) lv_obj_redraw(layer, obj);
+    else lv_draw_image(layer, img_dsc, img_coords);
+
+    while(layer->draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    disp_refr->layer_head = layer_head_old;
+}
+
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 {
     bool has_alpha = lv_color_format_has_alpha(disp->color_format);
@@ -1063,6 +1304,11 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
         .y2 = area->y2 + disp->offset_y
     };
 
+    uint32_t px_cnt = lv_area_get_size(area);
+    disp->refr_stats.flush_cnt++;
+    disp->refr_stats.px_flushed += px_cnt;
+    disp->refr_stats.flush_bytes += px_cnt * lv_color_format_get_size(disp->color_format);
+
     lv_display_send_event(disp, LV_EVENT_FLUSH_START, &offset_area);
     disp->flush_cb(disp, &offset_area, px_map);
     lv_display_send_event(disp, LV_EVENT_FLUSH_FINISH, &offset_area);
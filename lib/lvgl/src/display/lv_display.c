@@ -71,6 +71,7 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->antialiasing     = LV_COLOR_DEPTH > 8 ? 1 : 0;
     disp->dpi              = LV_DPI_DEF;
     disp->color_format = LV_COLOR_FORMAT_NATIVE;
+    disp->area_overhead_px = 1;
 
     disp->layer_head = lv_malloc_zeroed(sizeof(lv_layer_t));
     LV_ASSERT_MALLOC(disp->layer_head);
@@ -485,6 +486,22 @@ bool lv_display_get_antialiasing(lv_display_t * disp)
     return disp->antialiasing;
 }
 
+void lv_display_set_area_overhead(lv_display_t * disp, uint32_t px)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->area_overhead_px = px;
+}
+
+uint32_t lv_display_get_area_overhead(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->area_overhead_px;
+}
+
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp)
 {
     disp->flushing = 0;
@@ -878,6 +895,14 @@ lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp)
     return disp->refr_timer;
 }
 
+const lv_display_refr_stats_t * lv_display_get_refr_stats(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return NULL;
+
+    return &disp->refr_stats;
+}
+
 void lv_display_delete_refr_timer(lv_display_t * disp)
 {
     if(!disp) disp = lv_display_get_default();
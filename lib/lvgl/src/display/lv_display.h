@@ -78,6 +78,19 @@ typedef enum {
     LV_SCR_LOAD_ANIM_OUT_BOTTOM,
 } lv_screen_load_anim_t;
 
+/**
+ * Statistics of the last refresh of a display
+ */
+typedef struct {
+    uint32_t inv_area_cnt;      /**< Areas invalidated since the previous refresh*/
+    uint32_t area_cnt;          /**< Areas rendered after joining the invalidated areas*/
+    uint32_t flush_cnt;         /**< Calls of flush_cb (stripes in partial mode)*/
+    uint32_t px_invalidated;    /**< Pixels of the invalidated areas (overlaps counted multiple times)*/
+    uint32_t px_rendered;       /**< Pixels rendered by the draw units*/
+    uint32_t px_flushed;        /**< Pixels passed to flush_cb*/
+    uint32_t flush_bytes;       /**< Bytes passed to flush_cb*/
+} lv_display_refr_stats_t;
+
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
@@ -276,11 +289,14 @@ void lv_display_set_flush_wait_cb(lv_display_t * disp, lv_display_flush_wait_cb_
  * @param disp              pointer to a display
  * @param color_format      Possible values are
  *                          - LV_COLOR_FORMAT_RGB565
+ *                          - LV_COLOR_FORMAT_RGB565_SWAPPED
  *                          - LV_COLOR_FORMAT_RGB888
  *                          - LV_COLOR_FORMAT_XRGB888
  *                          - LV_COLOR_FORMAT_ARGB888
  *@note To change the endianness of the rendered image in case of RGB565 format
- *      (i.e. swap the 2 bytes) call `lv_draw_sw_rgb565_swap` in the flush_cb
+ *      (i.e. swap the 2 bytes) use LV_COLOR_FORMAT_RGB565_SWAPPED. The software renderer
+ *      then writes the swapped pixels directly and the flush_cb can send the buffer as it is.
+ *      Alternatively call `lv_draw_sw_rgb565_swap` in the flush_cb.
  */
 void lv_display_set_color_format(lv_display_t * disp, lv_color_format_t color_format);
 
@@ -305,6 +321,25 @@ void lv_display_set_antialiasing(lv_display_t * disp, bool en);
  */
 bool lv_display_get_antialiasing(lv_display_t * disp);
 
+/**
+ * Set the fixed cost of rendering one more area, expressed in pixels.
+ * Before rendering, two invalidated areas are joined if their bounding box has
+ * fewer pixels than the two areas together plus this overhead.
+ * With 1 (default) only overlapping areas and areas forming a rectangle are joined.
+ * Larger values join nearby areas too, which pays off if walking the object tree and
+ * calling flush_cb for an area is expensive compared to rendering and sending pixels.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param px        the overhead of an area in pixels
+ */
+void lv_display_set_area_overhead(lv_display_t * disp, uint32_t px);
+
+/**
+ * Get the fixed cost of rendering an area
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the overhead of an area in pixels
+ */
+uint32_t lv_display_get_area_overhead(lv_display_t * disp);
+
 //! @cond Doxygen_Suppress
 
 /**
@@ -524,6 +559,14 @@ bool lv_display_is_invalidation_enabled(lv_display_t * disp);
  */
 lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp);
 
+/**
+ * Get the statistics of the last refresh.
+ * They are cleared when a refresh starts, so read them e.g. in `LV_EVENT_REFR_READY`.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          pointer to the statistics (NULL on error)
+ */
+const lv_display_refr_stats_t * lv_display_get_refr_stats(lv_display_t * disp);
+
 /**
  * Delete screen refresher timer
  * @param disp      pointer to a display
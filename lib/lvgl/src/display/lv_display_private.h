@@ -95,6 +95,10 @@ struct _lv_display_t {
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint32_t inv_p;
     int32_t inv_en_cnt;
+    uint32_t area_overhead_px;  /**< Cost of rendering one more area in pixels, see `lv_display_set_area_overhead`*/
+
+    /** Statistics of the last refresh*/
+    lv_display_refr_stats_t refr_stats;
 
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
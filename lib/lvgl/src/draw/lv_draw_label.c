@@ -30,6 +30,10 @@
  **********************/
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_draw_label_lines_t * lines, uint32_t line_idx,
+                             uint32_t line_start, int32_t w);
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_draw_label_lines_t * lines, uint32_t line_idx,
+                              uint32_t line_start, uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -154,10 +158,20 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 
     lv_bidi_calculate_align(&align, &base_dir, dsc->text);
 
+    /*Use the stored line breaks only if they were calculated for this text and width*/
+    const lv_draw_label_lines_t * lines = dsc->lines;
+    if(lines && !lv_draw_label_lines_is_valid(lines, dsc->text, font, dsc->letter_space, lv_area_get_width(coords),
+                                              dsc->flag)) {
+        lines = NULL;
+    }
+
     if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
     }
+    else if(lines) {
+        w = lines->max_line_width;
+    }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
         lv_point_t p;
@@ -181,10 +195,11 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_idx       = 0;
     int32_t last_line_start = -1;
 
-    /*Check the hint to use the cached info*/
-    if(dsc->hint && y_ofs == 0 && coords->y1 < 0) {
+    /*Check the hint to use the cached info. With stored lines it's not required.*/
+    if(dsc->hint && lines == NULL && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(dsc->hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             dsc->hint->line_start = -1;
@@ -198,14 +213,14 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
         pos.y += dsc->hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL,
-                                                            dsc->flag);
+    uint32_t line_end = get_line_end(dsc, lines, line_idx, line_start, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_unit->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, lines, line_idx, line_start, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -220,14 +235,14 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -338,20 +353,19 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, lines, line_idx, line_start, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, lines, line_idx, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -366,10 +380,131 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+bool lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                int32_t letter_space, int32_t max_width, lv_text_flag_t flag)
+{
+    if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
+    if(lv_draw_label_lines_is_valid(lines, text, font, letter_space, max_width, flag)) return true;
+
+    lines->text = NULL;
+    if(text == NULL || font == NULL) return false;
+
+    uint32_t line_cnt = 0;
+    uint32_t line_start = 0;
+    int32_t max_line_width = 0;
+    while(1) {
+        /*Keep space for the closing item too*/
+        if(line_cnt + 1 >= lines->line_cap) {
+            uint32_t new_cap = lines->line_cap ? lines->line_cap * 2 : 4;
+            lv_draw_label_line_t * new_lines = lv_realloc(lines->lines, new_cap * sizeof(lv_draw_label_line_t));
+            LV_ASSERT_MALLOC(new_lines);
+            if(new_lines == NULL) return false;
+            lines->lines = new_lines;
+            lines->line_cap = new_cap;
+        }
+
+        if(text[line_start] == '\0') break;
+
+        uint32_t line_end = line_start + _lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL,
+                                                                flag);
+        int32_t line_width = lv_text_get_width(&text[line_start], line_end - line_start, font, letter_space);
+        lines->lines[line_cnt].start = line_start;
+        lines->lines[line_cnt].width = line_width;
+        max_line_width = LV_MAX(max_line_width, line_width);
+        line_cnt++;
+        line_start = line_end;
+    }
+
+    lines->lines[line_cnt].start = line_start;
+    lines->lines[line_cnt].width = 0;
+    lines->line_cnt = line_cnt;
+    lines->max_line_width = max_line_width;
+
+    lines->text = text;
+    lines->font = font;
+    lines->letter_space = letter_space;
+    lines->max_width = max_width;
+    lines->flag = flag;
+    return true;
+}
+
+bool lv_draw_label_lines_is_valid(const lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                  int32_t letter_space, int32_t max_width, lv_text_flag_t flag)
+{
+    if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
+
+    return lines->text != NULL && lines->text == text && lines->font == font &&
+           lines->letter_space == letter_space && lines->max_width == max_width && lines->flag == flag;
+}
+
+void lv_draw_label_lines_invalidate(lv_draw_label_lines_t * lines)
+{
+    lines->text = NULL;
+}
+
+void lv_draw_label_lines_free(lv_draw_label_lines_t * lines)
+{
+    lv_free(lines->lines);
+    lv_memzero(lines, sizeof(lv_draw_label_lines_t));
+}
+
+void lv_draw_label_lines_get_size(const lv_draw_label_lines_t * lines, int32_t line_space, lv_point_t * size_res)
+{
+    int32_t letter_height = lv_font_get_line_height(lines->font);
+    uint32_t text_end = lines->lines[lines->line_cnt].start;
+
+    size_res->x = lines->max_line_width;
+    size_res->y = (int32_t)lines->line_cnt * (letter_height + line_space);
+
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    if(text_end != 0 && (lines->text[text_end - 1] == '\n' || lines->text[text_end - 1] == '\r')) {
+        size_res->y += letter_height + line_space;
+    }
+
+    /*Correction with the last line space or set the height manually if the text is empty*/
+    if(size_res->y == 0) size_res->y = letter_height;
+    else size_res->y -= line_space;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get where the next line starts from the stored lines or by measuring the text
+ * @param dsc           the label draw descriptor
+ * @param lines         the valid stored lines of `dsc->text` or NULL
+ * @param line_idx      index of the line starting at `line_start`
+ * @param line_start    byte index of the line's start
+ * @param w             max width of the lines
+ * @return              byte index of the next line's start
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_draw_label_lines_t * lines, uint32_t line_idx,
+                             uint32_t line_start, int32_t w)
+{
+    if(lines) return line_idx < lines->line_cnt ? lines->lines[line_idx + 1].start : line_start;
+
+    return line_start + _lv_text_get_next_line(&dsc->text[line_start], dsc->font, dsc->letter_space, w, NULL,
+                                               dsc->flag);
+}
+
+/**
+ * Get the width of a line from the stored lines or by measuring the text
+ * @param dsc           the label draw descriptor
+ * @param lines         the valid stored lines of `dsc->text` or NULL
+ * @param line_idx      index of the line
+ * @param line_start    byte index of the line's start
+ * @param line_end      byte index of the next line's start
+ * @return              width of the line in px
+ */
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_draw_label_lines_t * lines, uint32_t line_idx,
+                              uint32_t line_start, uint32_t line_end)
+{
+    if(lines) return line_idx < lines->line_cnt ? lines->lines[line_idx].width : 0;
+
+    return lv_text_get_width(&dsc->text[line_start], line_end - line_start, dsc->font, dsc->letter_space);
+}
+
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
 {
@@ -432,8 +567,6 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
     dsc->g = &g;
     cb(draw_unit, dsc, NULL, NULL);
 
-    if(g.resolved_font && font->release_glyph) {
-        font->release_glyph(font, &g);
-    }
+    lv_font_glyph_release_draw_data(&g);
     LV_PROFILER_END;
 }
@@ -45,6 +45,29 @@ typedef struct _lv_draw_label_hint_t {
     int32_t coord_y;
 } lv_draw_label_hint_t;
 
+typedef struct {
+    uint32_t start;     /**< Byte index of the first character of the line*/
+    int32_t width;      /**< Width of the line in px*/
+} lv_draw_label_line_t;
+
+/** Store the line breaks and line widths of a text.
+ * Breaking the text into lines needs the width of all the characters,
+ * so it's calculated only once and used while the text and its parameters don't change.*/
+typedef struct _lv_draw_label_lines_t {
+    /** `line_cnt + 1` items. The last one is the end of the text with 0 width*/
+    lv_draw_label_line_t * lines;
+    uint32_t line_cnt;
+    uint32_t line_cap;          /**< Number of items allocated in `lines`*/
+    int32_t max_line_width;
+
+    /** The parameters the lines were calculated with. `text == NULL` means invalid lines.*/
+    const char * text;
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_width;
+    lv_text_flag_t flag;
+} lv_draw_label_lines_t;
+
 typedef struct {
     lv_draw_dsc_base_t base;
 
@@ -70,6 +93,8 @@ typedef struct {
      * 0: `text` is const and it's pointer will be valid during rendering.*/
     uint8_t text_local : 1;
     lv_draw_label_hint_t * hint;
+    /** Line breaks of `text` to use instead of measuring the text again. Ignored if calculated with other parameters.*/
+    const lv_draw_label_lines_t * lines;
 } lv_draw_label_dsc_t;
 
 typedef struct {
@@ -152,6 +177,53 @@ void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_character(lv_layer_t * layer, lv_draw_l
 void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_label_dsc_t * dsc,
                                       const lv_area_t * coords, lv_draw_glyph_cb_t cb);
 
+/**
+ * Break a text into lines and store the line breaks and line widths.
+ * Nothing happens if the lines were already calculated with the same parameters.
+ * @param lines         pointer to a line descriptor, initialized to zero before its first use
+ * @param text          the text
+ * @param font          font of the text
+ * @param letter_space  letter space
+ * @param max_width     break the lines to fit this width. Ignored with `LV_TEXT_FLAG_EXPAND`.
+ * @param flag          settings for the text from ::lv_text_flag_t
+ * @return              true: `lines` is valid; false: out of memory
+ */
+bool lv_draw_label_lines_update(lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                int32_t letter_space, int32_t max_width, lv_text_flag_t flag);
+
+/**
+ * Check if the lines were calculated with the given parameters
+ * @param lines         pointer to a line descriptor
+ * @param text          the text
+ * @param font          font of the text
+ * @param letter_space  letter space
+ * @param max_width     max width of the text
+ * @param flag          settings for the text from ::lv_text_flag_t
+ * @return              true: the lines can be used instead of measuring the text
+ */
+bool lv_draw_label_lines_is_valid(const lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                  int32_t letter_space, int32_t max_width, lv_text_flag_t flag);
+
+/**
+ * Mark the lines invalid, e.g. if the text was modified in place. The memory is kept for the next update.
+ * @param lines         pointer to a line descriptor
+ */
+void lv_draw_label_lines_invalidate(lv_draw_label_lines_t * lines);
+
+/**
+ * Free the memory of the lines
+ * @param lines         pointer to a line descriptor
+ */
+void lv_draw_label_lines_free(lv_draw_label_lines_t * lines);
+
+/**
+ * Get the size of the text from its lines. Gives the same result as `lv_text_get_size()`.
+ * @param lines         pointer to a valid line descriptor
+ * @param line_space    line space
+ * @param size_res      store the result here
+ */
+void lv_draw_label_lines_get_size(const lv_draw_label_lines_t * lines, int32_t line_space, lv_point_t * size_res);
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
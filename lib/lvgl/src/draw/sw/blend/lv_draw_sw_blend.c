@@ -8,6 +8,7 @@
  *********************/
 #include "../lv_draw_sw.h"
 #include "lv_draw_sw_blend_to_rgb565.h"
+#include "lv_draw_sw_blend_to_rgb565_swapped.h"
 #include "lv_draw_sw_blend_to_argb8888.h"
 #include "lv_draw_sw_blend_to_rgb888.h"
 
@@ -74,6 +75,9 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
             case LV_COLOR_FORMAT_RGB565:
                 lv_draw_sw_blend_color_to_rgb565(&fill_dsc);
                 break;
+            case LV_COLOR_FORMAT_RGB565_SWAPPED:
+                lv_draw_sw_blend_color_to_rgb565_swapped(&fill_dsc);
+                break;
             case LV_COLOR_FORMAT_ARGB8888:
                 lv_draw_sw_blend_color_to_argb8888(&fill_dsc);
                 break;
@@ -133,6 +137,9 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
             case LV_COLOR_FORMAT_RGB565A8:
                 lv_draw_sw_blend_image_to_rgb565(&image_dsc);
                 break;
+            case LV_COLOR_FORMAT_RGB565_SWAPPED:
+                lv_draw_sw_blend_image_to_rgb565_swapped(&image_dsc);
+                break;
             case LV_COLOR_FORMAT_ARGB8888:
                 lv_draw_sw_blend_image_to_argb8888(&image_dsc);
                 break;
@@ -0,0 +1,428 @@
+/**
+ * @file lv_draw_sw_blend_to_rgb565_swapped.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_to_rgb565_swapped.h"
+#if LV_USE_DRAW_SW
+
+#include "lv_draw_sw_blend.h"
+#include "../../../misc/lv_math.h"
+#include "../../../display/lv_display.h"
+#include "../../../core/lv_refr.h"
+#include "../../../misc/lv_color.h"
+#include "../../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ rgb565_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc,
+                                                           const uint8_t src_px_size);
+
+static void /* LV_ATTRIBUTE_FAST_MEM */ argb8888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_16_16_mix_swapped(uint16_t c1, uint16_t c2_swapped,
+                                                                               uint8_t mix);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_16_mix_swapped(const uint8_t * c1, uint16_t c2_swapped,
+                                                                               uint8_t mix);
+
+static inline uint16_t /* LV_ATTRIBUTE_FAST_MEM */ lv_color_24_to_16(const uint8_t * c);
+
+static inline bool /* LV_ATTRIBUTE_FAST_MEM */ blend_mode_apply(lv_blend_mode_t blend_mode, uint16_t src,
+                                                                 uint16_t dest, uint16_t * res);
+
+static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Fill an area with a color on a byte swapped RGB565 (big-endian) buffer.
+ * Works like `lv_draw_sw_blend_color_to_rgb565` but every pixel of dest_buf is stored with swapped bytes
+ * so the buffer can be sent to the display as it is.
+ * Supports normal fill, fill with opacity, fill with mask, and fill with mask and opacity.
+ * @param dsc       the fill descriptor
+ */
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565_swapped(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t color16_swapped = lv_color_swap_16(color16);
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+
+    int32_t x;
+    int32_t y;
+
+    /*Simple fill*/
+    if(mask == NULL && opa >= LV_OPA_MAX)  {
+        for(y = 0; y < h; y++) {
+            uint16_t * dest_end_final = dest_buf_u16 + w;
+            uint32_t * dest_end_mid = (uint32_t *)((uint16_t *) dest_buf_u16 + ((w - 1) & ~(0xF)));
+            if((lv_uintptr_t)&dest_buf_u16[0] & 0x3) {
+                dest_buf_u16[0] = color16_swapped;
+                dest_buf_u16++;
+            }
+
+            uint32_t c32 = (uint32_t)color16_swapped + ((uint32_t)color16_swapped << 16);
+            uint32_t * dest32 = (uint32_t *)dest_buf_u16;
+            while(dest32 < dest_end_mid) {
+                dest32[0] = c32;
+                dest32[1] = c32;
+                dest32[2] = c32;
+                dest32[3] = c32;
+                dest32[4] = c32;
+                dest32[5] = c32;
+                dest32[6] = c32;
+                dest32[7] = c32;
+                dest32 += 8;
+            }
+
+            dest_buf_u16 = (uint16_t *)dest32;
+
+            while(dest_buf_u16 < dest_end_final) {
+                *dest_buf_u16 = color16_swapped;
+                dest_buf_u16++;
+            }
+
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            dest_buf_u16 -= w;
+        }
+    }
+    /*Opacity only*/
+    else if(mask == NULL && opa < LV_OPA_MAX) {
+        /*Backgrounds are mostly uniform so remember the last result*/
+        uint16_t last_dest_color = dest_buf_u16[0] + 1; /*Set to value which is not equal to the first pixel*/
+        uint16_t last_res_color = 0;
+
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                if(dest_buf_u16[x] != last_dest_color) {
+                    last_dest_color = dest_buf_u16[x];
+                    last_res_color = lv_color_16_16_mix_swapped(color16, last_dest_color, opa);
+                }
+                dest_buf_u16[x] = last_res_color;
+            }
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        }
+    }
+    /*Masked with full opacity*/
+    else if(mask && opa >= LV_OPA_MAX) {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                if(mask[x] == LV_OPA_COVER) dest_buf_u16[x] = color16_swapped;
+                else if(mask[x] != LV_OPA_TRANSP) dest_buf_u16[x] = lv_color_16_16_mix_swapped(color16, dest_buf_u16[x], mask[x]);
+            }
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            mask += mask_stride;
+        }
+    }
+    /*Masked with opacity*/
+    else {
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                dest_buf_u16[x] = lv_color_16_16_mix_swapped(color16, dest_buf_u16[x], LV_OPA_MIX2(mask[x], opa));
+            }
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            mask += mask_stride;
+        }
+    }
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb565_swapped(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    switch(dsc->src_color_format) {
+        case LV_COLOR_FORMAT_RGB565:
+            rgb565_image_blend(dsc);
+            break;
+        case LV_COLOR_FORMAT_RGB888:
+            rgb888_image_blend(dsc, 3);
+            break;
+        case LV_COLOR_FORMAT_XRGB8888:
+            rgb888_image_blend(dsc, 4);
+            break;
+        case LV_COLOR_FORMAT_ARGB8888:
+            argb8888_image_blend(dsc);
+            break;
+        default:
+            LV_LOG_WARN("Not supported source color format");
+            break;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void LV_ATTRIBUTE_FAST_MEM rgb565_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t x;
+    int32_t y;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_u16[x] = lv_color_swap_16(src_buf_u16[x]);
+                }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+            }
+        }
+        else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_u16[x] = lv_color_16_16_mix_swapped(src_buf_u16[x], dest_buf_u16[x], opa);
+                }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+            }
+        }
+        else if(mask_buf && opa >= LV_OPA_MAX) {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_u16[x] = lv_color_16_16_mix_swapped(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
+                }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+                mask_buf += mask_stride;
+            }
+        }
+        else {
+            for(y = 0; y < h; y++) {
+                for(x = 0; x < w; x++) {
+                    dest_buf_u16[x] = lv_color_16_16_mix_swapped(src_buf_u16[x], dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
+                }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+                mask_buf += mask_stride;
+            }
+        }
+    }
+    else {
+        uint16_t res = 0;
+        for(y = 0; y < h; y++) {
+            for(x = 0; x < w; x++) {
+                /*Do not add or subtract pure black and do not multiply with pure white (considered as 1)*/
+                if(dsc->blend_mode == LV_BLEND_MODE_MULTIPLY ? src_buf_u16[x] == 0xffff : src_buf_u16[x] == 0x0000) continue;
+                if(!blend_mode_apply(dsc->blend_mode, src_buf_u16[x], lv_color_swap_16(dest_buf_u16[x]), &res)) return;
+
+                if(mask_buf == NULL) {
+                    dest_buf_u16[x] = lv_color_16_16_mix_swapped(res, dest_buf_u16[x], opa);
+                }
+                else {
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[x] = lv_color_16_16_mix_swapped(res, dest_buf_u16[x], mask_buf[x]);
+                    else dest_buf_u16[x] = lv_color_16_16_mix_swapped(res, dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
+                }
+            }
+
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            src_buf_u16 = drawbuf_next_row(src_buf_u16, src_stride);
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM rgb888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc, const uint8_t src_px_size)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                lv_opa_t mix;
+                if(mask_buf == NULL) mix = opa;
+                else if(opa >= LV_OPA_MAX) mix = mask_buf[dest_x];
+                else mix = LV_OPA_MIX2(mask_buf[dest_x], opa);
+                dest_buf_u16[dest_x] = lv_color_24_16_mix_swapped(&src_buf_u8[src_x], dest_buf_u16[dest_x], mix);
+            }
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            src_buf_u8 += src_stride;
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+    else {
+        uint16_t res = 0;
+        for(y = 0; y < h; y++) {
+            for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += src_px_size) {
+                if(!blend_mode_apply(dsc->blend_mode, lv_color_24_to_16(&src_buf_u8[src_x]),
+                                     lv_color_swap_16(dest_buf_u16[dest_x]), &res)) return;
+
+                if(mask_buf == NULL) {
+                    dest_buf_u16[dest_x] = lv_color_16_16_mix_swapped(res, dest_buf_u16[dest_x], opa);
+                }
+                else {
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_16_16_mix_swapped(res, dest_buf_u16[dest_x], mask_buf[dest_x]);
+                    else dest_buf_u16[dest_x] = lv_color_16_16_mix_swapped(res, dest_buf_u16[dest_x], LV_OPA_MIX2(mask_buf[dest_x], opa));
+                }
+            }
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            src_buf_u8 += src_stride;
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+}
+
+static void LV_ATTRIBUTE_FAST_MEM argb8888_image_blend(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    uint16_t res = 0;
+    for(y = 0; y < h; y++) {
+        for(dest_x = 0, src_x = 0; dest_x < w; dest_x++, src_x += 4) {
+            lv_opa_t mix;
+            if(mask_buf == NULL && opa >= LV_OPA_MAX) mix = src_buf_u8[src_x + 3];
+            else if(mask_buf == NULL) mix = LV_OPA_MIX2(src_buf_u8[src_x + 3], opa);
+            else if(opa >= LV_OPA_MAX) mix = LV_OPA_MIX2(src_buf_u8[src_x + 3], mask_buf[dest_x]);
+            else mix = LV_OPA_MIX3(src_buf_u8[src_x + 3], mask_buf[dest_x], opa);
+
+            if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+                dest_buf_u16[dest_x] = lv_color_24_16_mix_swapped(&src_buf_u8[src_x], dest_buf_u16[dest_x], mix);
+            }
+            else {
+                if(!blend_mode_apply(dsc->blend_mode, lv_color_24_to_16(&src_buf_u8[src_x]),
+                                     lv_color_swap_16(dest_buf_u16[dest_x]), &res)) return;
+                dest_buf_u16[dest_x] = lv_color_16_16_mix_swapped(res, dest_buf_u16[dest_x], mix);
+            }
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+        src_buf_u8 += src_stride;
+        if(mask_buf) mask_buf += mask_stride;
+    }
+}
+
+/**
+ * Mix a native RGB565 color onto a swapped background and return the result swapped
+ */
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_16_16_mix_swapped(uint16_t c1, uint16_t c2_swapped, uint8_t mix)
+{
+    if(mix == 0) return c2_swapped;
+    if(mix == 255) return lv_color_swap_16(c1);
+    return lv_color_swap_16(lv_color_16_16_mix(c1, lv_color_swap_16(c2_swapped), mix));
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_24_16_mix_swapped(const uint8_t * c1, uint16_t c2_swapped,
+                                                                         uint8_t mix)
+{
+    if(mix == 0) {
+        return c2_swapped;
+    }
+    else if(mix == 255) {
+        return lv_color_swap_16(lv_color_24_to_16(c1));
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+        uint16_t c2 = lv_color_swap_16(c2_swapped);
+
+        return lv_color_swap_16(((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+                                ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+                                (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8));
+    }
+}
+
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_24_to_16(const uint8_t * c)
+{
+    return ((c[2] & 0xF8) << 8) + ((c[1] & 0xFC) << 3) + ((c[0] & 0xF8) >> 3);
+}
+
+/**
+ * Apply a non-normal blend mode on two native RGB565 colors
+ * @return      false if the blend mode is not supported
+ */
+static inline bool LV_ATTRIBUTE_FAST_MEM blend_mode_apply(lv_blend_mode_t blend_mode, uint16_t src, uint16_t dest,
+                                                           uint16_t * res)
+{
+    lv_color16_t src_c16 = *(lv_color16_t *)&src;
+    lv_color16_t dest_c16 = *(lv_color16_t *)&dest;
+
+    switch(blend_mode) {
+        case LV_BLEND_MODE_ADDITIVE:
+            *res = (LV_MIN(dest_c16.red + src_c16.red, 31)) << 11;
+            *res += (LV_MIN(dest_c16.green + src_c16.green, 63)) << 5;
+            *res += LV_MIN(dest_c16.blue + src_c16.blue, 31);
+            return true;
+        case LV_BLEND_MODE_SUBTRACTIVE:
+            *res = (LV_MAX(dest_c16.red - src_c16.red, 0)) << 11;
+            *res += (LV_MAX(dest_c16.green - src_c16.green, 0)) << 5;
+            *res += LV_MAX(dest_c16.blue - src_c16.blue, 0);
+            return true;
+        case LV_BLEND_MODE_MULTIPLY:
+            *res = ((dest_c16.red * src_c16.red) >> 5) << 11;
+            *res += ((dest_c16.green * src_c16.green) >> 6) << 5;
+            *res += (dest_c16.blue * src_c16.blue) >> 5;
+            return true;
+        default:
+            LV_LOG_WARN("Not supported blend mode: %d", blend_mode);
+            return false;
+    }
+}
+
+static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif
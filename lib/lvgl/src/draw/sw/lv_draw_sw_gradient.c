@@ -11,6 +11,8 @@
 
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os.h"
+#include "../../core/lv_global.h"
+#include "../../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -25,11 +27,35 @@
     #define ALIGN(X)    (((X) + 3) & ~3)
 #endif
 
+#define grad_cache_p (LV_GLOBAL_DEFAULT()->sw_grad_cache)
+#define grad_cache_hit_cnt (LV_GLOBAL_DEFAULT()->sw_grad_cache_hit_cnt)
+#define grad_cache_miss_cnt (LV_GLOBAL_DEFAULT()->sw_grad_cache_miss_cnt)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_cache_slot_size_t slot;  /*The size of the gradient item in bytes*/
+
+    /*The key*/
+    lv_grad_dsc_t dsc;
+    int32_t size;
+
+    lv_grad_t * grad;
+} grad_cache_data_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-typedef lv_result_t (*op_cache_t)(lv_grad_t * c, void * ctx);
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t size);
+static size_t get_item_size(int32_t size);
+static void fill_item(lv_grad_t * item, const lv_grad_dsc_t * g);
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs);
+    static bool grad_cache_create_cb(grad_cache_data_t * data, void * user_data);
+    static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data);
+#endif
 
 /**********************
  *   STATIC VARIABLE
@@ -39,12 +65,16 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+static size_t get_item_size(int32_t size)
 {
-    int32_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
+    return ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+}
+
+static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t size)
+{
+    LV_UNUSED(g);
 
-    size_t req_size = ALIGN(sizeof(lv_grad_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
-    lv_grad_t * item  = lv_malloc(req_size);
+    lv_grad_t * item  = lv_malloc(get_item_size(size));
     LV_ASSERT_MALLOC(item);
     if(item == NULL) return NULL;
 
@@ -52,30 +82,150 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
     item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
     item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
     item->size = size;
+    item->cache_entry = NULL;
     return item;
 }
 
+static void fill_item(lv_grad_t * item, const lv_grad_dsc_t * g)
+{
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+}
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+
+static lv_cache_compare_res_t grad_cache_compare_cb(const grad_cache_data_t * lhs, const grad_cache_data_t * rhs)
+{
+    if(lhs->size != rhs->size) return lhs->size > rhs->size ? 1 : -1;
+    if(lhs->dsc.dir != rhs->dsc.dir) return lhs->dsc.dir > rhs->dsc.dir ? 1 : -1;
+    if(lhs->dsc.stops_count != rhs->dsc.stops_count) return lhs->dsc.stops_count > rhs->dsc.stops_count ? 1 : -1;
+
+    /*Compare only the used stops, the rest of the array can be anything*/
+    uint32_t i;
+    for(i = 0; i < lhs->dsc.stops_count; i++) {
+        const lv_gradient_stop_t * l = &lhs->dsc.stops[i];
+        const lv_gradient_stop_t * r = &rhs->dsc.stops[i];
+        uint32_t l_color = lv_color_to_u32(l->color);
+        uint32_t r_color = lv_color_to_u32(r->color);
+        if(l_color != r_color) return l_color > r_color ? 1 : -1;
+        if(l->opa != r->opa) return l->opa > r->opa ? 1 : -1;
+        if(l->frac != r->frac) return l->frac > r->frac ? 1 : -1;
+    }
+
+    return 0;
+}
+
+static bool grad_cache_create_cb(grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    data->grad = allocate_item(&data->dsc, data->size);
+    if(data->grad == NULL) return false;
+
+    fill_item(data->grad, &data->dsc);
+    return true;
+}
+
+static void grad_cache_free_cb(grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(data->grad);
+}
+
+#endif /*LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0*/
+
 /**********************
  *     FUNCTIONS
  **********************/
 
+void lv_gradient_cache_init(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    grad_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(grad_cache_data_t), LV_DRAW_SW_GRADIENT_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)grad_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)grad_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)grad_cache_free_cb,
+    });
+    grad_cache_hit_cnt = 0;
+    grad_cache_miss_cnt = 0;
+#endif
+}
+
+void lv_gradient_cache_deinit(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    if(grad_cache_p == NULL) return;
+    lv_cache_destroy(grad_cache_p, NULL);
+    grad_cache_p = NULL;
+#endif
+}
+
+void lv_gradient_cache_resize(uint32_t new_size)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    lv_cache_set_max_size(grad_cache_p, new_size, NULL);
+    lv_cache_reserve(grad_cache_p, 0, NULL);
+#else
+    LV_UNUSED(new_size);
+#endif
+}
+
+void lv_gradient_cache_get_stats(lv_gradient_cache_stats_t * stats)
+{
+    lv_memzero(stats, sizeof(lv_gradient_cache_stats_t));
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    stats->hit_cnt = grad_cache_hit_cnt;
+    stats->miss_cnt = grad_cache_miss_cnt;
+    stats->size = lv_cache_get_size(grad_cache_p, NULL);
+    stats->max_size = lv_cache_get_max_size(grad_cache_p, NULL);
+#endif
+}
+
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
+    int32_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
+
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
     /* Step 1: Search cache for the given key */
-    lv_grad_t * item = allocate_item(g, w, h);
+    grad_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.slot.size = get_item_size(size);
+    search_key.dsc = *g;
+    search_key.size = size;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(grad_cache_p, &search_key, NULL);
+    if(entry) {
+        grad_cache_hit_cnt++;
+    }
+    else {
+        /* Step 2: Calculate it and add to the cache if it fits */
+        grad_cache_miss_cnt++;
+        if(search_key.slot.size <= lv_cache_get_max_size(grad_cache_p, NULL)) {
+            entry = lv_cache_acquire_or_create(grad_cache_p, &search_key, NULL);
+        }
+    }
+
+    if(entry) {
+        grad_cache_data_t * data = lv_cache_entry_get_data(entry);
+        data->grad->cache_entry = entry;
+        return data->grad;
+    }
+#endif
+
+    /* Step 3: Not cached, so calculate a gradient just for this draw */
+    lv_grad_t * item = allocate_item(g, size);
     if(item == NULL) {
         LV_LOG_WARN("Failed to allocate item for the gradient");
         return item;
     }
 
-    /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
-    }
+    fill_item(item, g);
     return item;
 }
 
@@ -134,6 +284,13 @@ void LV_ATTRIBUTE_FAST_MEM lv_gradient_color_calculate(const lv_grad_dsc_t * dsc
 
 void lv_gradient_cleanup(lv_grad_t * grad)
 {
+#if LV_DRAW_SW_GRADIENT_CACHE_SIZE > 0
+    if(grad->cache_entry) {
+        lv_cache_release(grad_cache_p, grad->cache_entry, NULL);
+        return;
+    }
+#endif
+
     lv_free(grad);
 }
 
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 #include "../../misc/lv_color.h"
 #include "../../misc/lv_style.h"
+#include "../../misc/cache/lv_cache.h"
 
 #if LV_USE_DRAW_SW
 
@@ -34,8 +35,16 @@ typedef struct _lv_gradient_cache_t {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    lv_cache_entry_t * cache_entry;     /**< The entry of the gradient cache holding it or NULL if not cached*/
 } lv_grad_t;
 
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of gradients found in the cache*/
+    uint32_t miss_cnt;      /**< Number of gradients calculated again*/
+    uint32_t size;          /**< Size of the cached gradients in bytes*/
+    uint32_t max_size;      /**< Max. size of the cache in bytes*/
+} lv_gradient_cache_stats_t;
+
 /**********************
  *      PROTOTYPES
  **********************/
@@ -49,11 +58,41 @@ typedef struct _lv_gradient_cache_t {
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_gradient_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
                                                              int32_t frac, lv_grad_color_t * color_out, lv_opa_t * opa_out);
 
-/** Get a gradient cache from the given parameters */
+/**
+ * Create the gradient cache with `LV_DRAW_SW_GRADIENT_CACHE_SIZE` bytes
+ */
+void lv_gradient_cache_init(void);
+
+/**
+ * Free the gradient cache
+ */
+void lv_gradient_cache_deinit(void);
+
+/**
+ * Resize the gradient cache. The least recently used gradients are freed if they don't fit.
+ * @param new_size  the new size of the cache in bytes
+ */
+void lv_gradient_cache_resize(uint32_t new_size);
+
+/**
+ * Get the hit/miss counters and the memory usage of the gradient cache
+ * @param stats     store the statistics here. All zero if the cache is disabled.
+ */
+void lv_gradient_cache_get_stats(lv_gradient_cache_stats_t * stats);
+
+/**
+ * Get the color and opacity map of a gradient. It's taken from the cache if the same gradient
+ * (stops, direction and size) was already used, else it's calculated.
+ * @param gradient  the gradient descriptor
+ * @param w         width of the area to fill
+ * @param h         height of the area to fill
+ * @return          the gradient or NULL if there is no gradient.
+ *                  Release it with `lv_gradient_cleanup` after drawing.
+ */
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * gradient, int32_t w, int32_t h);
 
 /**
- * Clean up the gradient item after it was get with `lv_grad_get_from_cache`.
+ * Clean up the gradient item after it was get with `lv_gradient_get`.
  * @param grad      pointer to a gradient
  */
 void lv_gradient_cleanup(lv_grad_t * grad);
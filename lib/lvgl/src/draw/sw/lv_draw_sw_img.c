@@ -54,6 +54,12 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
                           const lv_image_decoder_dsc_t * decoder_dsc, lv_draw_image_sup_t * sup,
                           const lv_area_t * img_coords, const lv_area_t * clipped_img_area);
 
+static int32_t get_right_angle_rotation(const lv_draw_image_dsc_t * draw_dsc, lv_color_format_t cf);
+
+static void img_draw_right_angle(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                                 const lv_draw_buf_t * decoded, lv_draw_sw_blend_dsc_t * blend_dsc,
+                                 const lv_area_t * img_coords, int32_t rotation);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -253,6 +259,11 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
+    /*Rotating by 90, 180 or 270 degrees only reorders the pixels, no need for resampling*/
+    else if(transformed && !masked && draw_dsc->recolor_opa <= LV_OPA_MIN &&
+            get_right_angle_rotation(draw_dsc, cf) != 0) {
+        img_draw_right_angle(draw_unit, draw_dsc, decoded, &blend_dsc, img_coords, get_right_angle_rotation(draw_dsc, cf));
+    }
     /* check whether it is possible to accelerate the operation in synchronouse mode */
     else if(LV_RESULT_INVALID == LV_DRAW_SW_IMAGE(transformed,      /* whether require transform */
                                                   cf,               /* image format */
@@ -420,4 +431,125 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
     }
 }
 
+/**
+ * Tell whether the image is only rotated by a right angle
+ * @param draw_dsc      the image draw descriptor
+ * @param cf            color format of the decoded image
+ * @return              900, 1800 or 2700 if the rotation can be done by reordering the pixels, else 0
+ */
+static int32_t get_right_angle_rotation(const lv_draw_image_dsc_t * draw_dsc, lv_color_format_t cf)
+{
+    if(draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE) return 0;
+    if(draw_dsc->skew_x != 0 || draw_dsc->skew_y != 0) return 0;
+
+    if(cf != LV_COLOR_FORMAT_RGB565 && cf != LV_COLOR_FORMAT_RGB888 &&
+       cf != LV_COLOR_FORMAT_XRGB8888 && cf != LV_COLOR_FORMAT_ARGB8888) {
+        return 0;
+    }
+
+    int32_t rotation = draw_dsc->rotation % 3600;
+    if(rotation < 0) rotation += 3600;
+    if(rotation == 900 || rotation == 1800 || rotation == 2700) return rotation;
+    else return 0;
+}
+
+/**
+ * Draw an image rotated by 90, 180 or 270 degrees around the pivot.
+ * Only the part of the image which is on the clip area is rotated into a temporary buffer
+ * (in slices of MAX_BUF_SIZE) and blended as a normal image.
+ * @param draw_unit     pointer to a draw unit
+ * @param draw_dsc      the image draw descriptor
+ * @param decoded       the decoded image
+ * @param blend_dsc     blend descriptor with the opa, blend mode already set
+ * @param img_coords    the coordinates of the non-rotated image
+ * @param rotation      900, 1800 or 2700
+ */
+static void img_draw_right_angle(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                                 const lv_draw_buf_t * decoded, lv_draw_sw_blend_dsc_t * blend_dsc,
+                                 const lv_area_t * img_coords, int32_t rotation)
+{
+    int32_t w = lv_area_get_width(img_coords);
+    int32_t h = lv_area_get_height(img_coords);
+    int32_t px = draw_dsc->pivot.x;
+    int32_t py = draw_dsc->pivot.y;
+    lv_color_format_t cf = decoded->header.cf;
+    uint32_t px_size = lv_color_format_get_size(cf);
+
+    /*Where the rotated image lands. It's the same pixel mapping as the one of lv_draw_sw_transform,
+     *but exact as it doesn't depend on the rounding of the sine table*/
+    lv_area_t rot_area;
+    lv_display_rotation_t disp_rot;
+    if(rotation == 900) {
+        disp_rot = LV_DISPLAY_ROTATION_90;
+        rot_area.x1 = px + py - h + 1;
+        rot_area.y1 = py - px;
+        lv_area_set_width(&rot_area, h);
+        lv_area_set_height(&rot_area, w);
+    }
+    else if(rotation == 1800) {
+        disp_rot = LV_DISPLAY_ROTATION_180;
+        rot_area.x1 = 2 * px - w + 1;
+        rot_area.y1 = 2 * py - h + 1;
+        lv_area_set_width(&rot_area, w);
+        lv_area_set_height(&rot_area, h);
+    }
+    else {
+        disp_rot = LV_DISPLAY_ROTATION_270;
+        rot_area.x1 = px - py;
+        rot_area.y1 = px + py - w + 1;
+        lv_area_set_width(&rot_area, h);
+        lv_area_set_height(&rot_area, w);
+    }
+    lv_area_move(&rot_area, img_coords->x1, img_coords->y1);
+
+    lv_area_t clipped_area;
+    if(!_lv_area_intersect(&clipped_area, &rot_area, draw_unit->clip_area)) return;
+
+    int32_t blend_w = lv_area_get_width(&clipped_area);
+    uint32_t buf_stride = blend_w * px_size;
+    int32_t buf_h = MAX_BUF_SIZE / buf_stride;
+    if(buf_h < 1) buf_h = 1;
+    if(buf_h > lv_area_get_height(&clipped_area)) buf_h = lv_area_get_height(&clipped_area);
+    uint8_t * tmp_buf = lv_malloc(buf_stride * buf_h);
+    LV_ASSERT_MALLOC(tmp_buf);
+    if(tmp_buf == NULL) return;
+
+    lv_area_t blend_area = clipped_area;
+    blend_dsc->src_buf = tmp_buf;
+    blend_dsc->src_stride = buf_stride;
+    blend_dsc->src_color_format = cf;
+    blend_dsc->src_area = &blend_area;
+    blend_dsc->blend_area = &blend_area;
+
+    while(blend_area.y1 <= clipped_area.y2) {
+        blend_area.y2 = LV_MIN(blend_area.y1 + buf_h - 1, clipped_area.y2);
+
+        /*The rectangle of the source image which is rotated into `blend_area`*/
+        int32_t dx1 = blend_area.x1 - rot_area.x1;
+        int32_t dx2 = blend_area.x2 - rot_area.x1;
+        int32_t dy1 = blend_area.y1 - rot_area.y1;
+        int32_t dy2 = blend_area.y2 - rot_area.y1;
+        lv_area_t src_area;
+        if(disp_rot == LV_DISPLAY_ROTATION_90) {
+            lv_area_set(&src_area, dy1, h - 1 - dx2, dy2, h - 1 - dx1);
+        }
+        else if(disp_rot == LV_DISPLAY_ROTATION_180) {
+            lv_area_set(&src_area, w - 1 - dx2, h - 1 - dy2, w - 1 - dx1, h - 1 - dy1);
+        }
+        else {
+            lv_area_set(&src_area, w - 1 - dy2, dx1, w - 1 - dy1, dx2);
+        }
+
+        const uint8_t * src_buf = decoded->data + src_area.y1 * decoded->header.stride + src_area.x1 * px_size;
+        lv_draw_sw_rotate(src_buf, tmp_buf, lv_area_get_width(&src_area), lv_area_get_height(&src_area),
+                          decoded->header.stride, buf_stride, disp_rot, cf);
+
+        lv_draw_sw_blend(draw_unit, blend_dsc);
+
+        blend_area.y1 = blend_area.y2 + 1;
+    }
+
+    lv_free(tmp_buf);
+}
+
 #endif /*LV_USE_DRAW_SW*/
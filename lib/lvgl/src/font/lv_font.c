@@ -8,6 +8,7 @@
  *********************/
 
 #include "lv_font.h"
+#include "lv_font_fmt_txt.h"
 #include "../misc/lv_text.h"
 #include "../misc/lv_utils.h"
 #include "../misc/lv_log.h"
@@ -50,6 +51,21 @@ const void * lv_font_get_glyph_bitmap(lv_font_glyph_dsc_t * g_dsc, uint32_t lett
     return font_p->get_glyph_bitmap(g_dsc, letter, draw_buf);
 }
 
+void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_ASSERT_NULL(g_dsc);
+    const lv_font_t * font_p = g_dsc->resolved_font;
+    if(font_p == NULL) return;
+
+    if(font_p->release_glyph) {
+        font_p->release_glyph(font_p, g_dsc);
+    }
+    else if(g_dsc->entry && font_p->get_glyph_bitmap == lv_font_get_bitmap_fmt_txt) {
+        /*The built-in fonts are const and don't set `release_glyph`*/
+        lv_font_release_glyph_fmt_txt(font_p, g_dsc);
+    }
+}
+
 bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
                            uint32_t letter_next)
 {
@@ -64,6 +80,7 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
     const lv_font_t * f = font_p;
 
     dsc_out->resolved_font = NULL;
+    dsc_out->entry = NULL;
 
     while(f) {
         bool found = f->get_glyph_dsc(f, dsc_out, letter, f->kerning == LV_FONT_KERNING_NONE ? 0 : letter_next);
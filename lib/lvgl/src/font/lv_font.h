@@ -141,6 +141,13 @@ struct _lv_font_t {
 const void * lv_font_get_glyph_bitmap(lv_font_glyph_dsc_t * g_dsc, uint32_t letter,
                                       lv_draw_buf_t * draw_buf);
 
+/**
+ * Release the glyph data returned by `lv_font_get_glyph_bitmap` after it was drawn,
+ * e.g. to let the glyph cache evict it again.
+ * @param g_dsc         the glyph descriptor used to get the bitmap
+ */
+void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc);
+
 /**
  * Get the descriptor of a glyph
  * @param font          pointer to font
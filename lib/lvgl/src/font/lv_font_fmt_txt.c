@@ -22,6 +22,24 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    #define font_cache_head LV_GLOBAL_DEFAULT()->font_fmt_txt_cache
+    #define font_cache_mutex LV_GLOBAL_DEFAULT()->font_fmt_txt_cache_mutex
+    #define FONT_CACHE_MASK (LV_FONT_FMT_TXT_CACHE_SIZE - 1)
+    #if (LV_FONT_FMT_TXT_CACHE_SIZE & FONT_CACHE_MASK) != 0
+        #error "LV_FONT_FMT_TXT_CACHE_SIZE must be a power of 2"
+    #endif
+
+    /*Marks a not yet looked up letter in the Latin-1 table*/
+    #define LATIN1_GID_UNKNOWN  0xFFFF
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    #define glyph_cache_p LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache
+    #define glyph_cache_hit_cnt LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache_hit_cnt
+    #define glyph_cache_miss_cnt LV_GLOBAL_DEFAULT()->font_fmt_txt_glyph_cache_miss_cnt
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,11 +48,58 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+typedef struct {
+    uint32_t letter;        /*0: empty slot*/
+    uint16_t gid;
+} gid_cache_entry_t;
+
+typedef struct {
+    uint16_t gid_left;      /*0: empty slot*/
+    uint16_t gid_right;
+    int8_t value;
+} kern_cache_entry_t;
+
+/*Glyph id and kerning lookup cache of a font. Created on the first use of the font.*/
+struct _lv_font_fmt_txt_cache_t {
+    struct _lv_font_fmt_txt_cache_t * next;
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    const lv_font_fmt_txt_cmap_t * cmaps;       /*To recognize if `fdsc` was freed and reused for an other font*/
+    uint16_t latin1_gid[256];                   /*Glyph ids of U+0000..U+00FF*/
+    gid_cache_entry_t gid[LV_FONT_FMT_TXT_CACHE_SIZE];
+    kern_cache_entry_t * kern;                  /*Only for kern pairs, class based kerning is fast anyway*/
+};
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+typedef struct {
+    lv_cache_slot_size_t slot;  /*The size of the A8 bitmap in bytes*/
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    uint32_t gid;
+    lv_draw_buf_t * draw_buf;
+} glyph_cache_data_t;
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0*/
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
-static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static uint32_t get_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, lv_font_fmt_txt_cache_t * cache, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+static int8_t get_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, lv_font_fmt_txt_cache_t * cache,
+                             uint32_t gid_left, uint32_t gid_right);
+static int8_t find_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right);
+static lv_font_fmt_txt_cache_t * get_cache(const lv_font_fmt_txt_dsc_t * fdsc);
+static inline void cache_lock(void);
+static inline void cache_unlock(void);
+static bool decode_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         uint8_t * out);
+static void unpack_bits(const uint8_t * in, uint32_t bit_pos, uint8_t * out, int32_t len, uint8_t bpp);
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+    static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
+    static bool glyph_cache_create(void);
+#endif
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
 static int32_t kern_pair_16_compare(const void * ref, const void * element);
@@ -79,12 +144,14 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, uint32_t un
                                         lv_draw_buf_t * draw_buf)
 {
     const lv_font_t * font = g_dsc->resolved_font;
-    uint8_t * bitmap_out = draw_buf->data;
+    g_dsc->entry = NULL;
 
     if(unicode_letter == '\t') unicode_letter = ' ';
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    cache_lock();
+    uint32_t gid = get_glyph_dsc_id(fdsc, get_cache(fdsc), unicode_letter);
+    cache_unlock();
     if(!gid) return NULL;
 
     const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
@@ -92,80 +159,73 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, uint32_t un
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
-    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
-        const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
-        uint8_t * bitmap_out_tmp = bitmap_out;
-        int32_t i = 0;
-        int32_t x, y;
-        uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
-
-        if(fdsc->bpp == 1) {
-            for(y = 0; y < gdsc->box_h; y ++) {
-                for(x = 0; x < gdsc->box_w; x++, i++) {
-                    i = i & 0x7;
-                    if(i == 0) bitmap_out_tmp[x] = (*bitmap_in) & 0x80 ? 0xff : 0x00;
-                    else if(i == 1) bitmap_out_tmp[x] = (*bitmap_in) & 0x40 ? 0xff : 0x00;
-                    else if(i == 2) bitmap_out_tmp[x] = (*bitmap_in) & 0x20 ? 0xff : 0x00;
-                    else if(i == 3) bitmap_out_tmp[x] = (*bitmap_in) & 0x10 ? 0xff : 0x00;
-                    else if(i == 4) bitmap_out_tmp[x] = (*bitmap_in) & 0x08 ? 0xff : 0x00;
-                    else if(i == 5) bitmap_out_tmp[x] = (*bitmap_in) & 0x04 ? 0xff : 0x00;
-                    else if(i == 6) bitmap_out_tmp[x] = (*bitmap_in) & 0x02 ? 0xff : 0x00;
-                    else if(i == 7) {
-                        bitmap_out_tmp[x] = (*bitmap_in) & 0x01 ? 0xff : 0x00;
-                        bitmap_in++;
-                    }
-                }
-                bitmap_out_tmp += stride;
-            }
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache_p || glyph_cache_create()) {
+        glyph_cache_data_t search_key;
+        search_key.fdsc = fdsc;
+        search_key.gid = gid;
+        search_key.slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h +
+                               sizeof(lv_draw_buf_t);
+
+        lv_cache_entry_t * entry = lv_cache_acquire(glyph_cache_p, &search_key, NULL);
+        if(entry) {
+            glyph_cache_hit_cnt++;
         }
-        else if(fdsc->bpp == 2) {
-            for(y = 0; y < gdsc->box_h; y ++) {
-                for(x = 0; x < gdsc->box_w; x++, i++) {
-                    i = i & 0x3;
-                    if(i == 0) bitmap_out_tmp[x] = opa2_table[(*bitmap_in) >> 6];
-                    else if(i == 1) bitmap_out_tmp[x] = opa2_table[((*bitmap_in) >> 4) & 0x3];
-                    else if(i == 2) bitmap_out_tmp[x] = opa2_table[((*bitmap_in) >> 2) & 0x3];
-                    else if(i == 3) {
-                        bitmap_out_tmp[x] = opa2_table[((*bitmap_in) >> 0) & 0x3];
-                        bitmap_in++;
-                    }
-                }
-                bitmap_out_tmp += stride;
+        else {
+            glyph_cache_miss_cnt++;
+            /*Glyphs which can't fit into the cache are decoded into `draw_buf` for each draw*/
+            if(search_key.slot.size <= lv_cache_get_max_size(glyph_cache_p, NULL)) {
+                entry = lv_cache_acquire_or_create(glyph_cache_p, &search_key, (void *)gdsc);
             }
-
         }
-        else if(fdsc->bpp == 4) {
-            for(y = 0; y < gdsc->box_h; y ++) {
-                for(x = 0; x < gdsc->box_w; x++, i++) {
-                    i = i & 0x1;
-                    if(i == 0) {
-                        bitmap_out_tmp[x] = opa4_table[(*bitmap_in) >> 4];
-                    }
-                    else if(i == 1) {
-                        bitmap_out_tmp[x] = opa4_table[(*bitmap_in) & 0xF];
-                        bitmap_in++;
-                    }
-                }
-                bitmap_out_tmp += stride;
-            }
+
+        if(entry) {
+            g_dsc->entry = entry;
+            glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+            return data->draw_buf;
         }
-        return draw_buf;
     }
-    /*Handle compressed bitmap*/
-    else {
-#if LV_USE_FONT_COMPRESSED
-        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
-                   (uint8_t)fdsc->bpp, prefilter);
-        return draw_buf;
-#else /*!LV_USE_FONT_COMPRESSED*/
-        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0*/
+
+    if(!decode_glyph(fdsc, gdsc, draw_buf->data)) return NULL;
+    return draw_buf;
+}
+
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(g_dsc->entry == NULL) return;
+    lv_cache_release(glyph_cache_p, g_dsc->entry, NULL);
 #endif
-    }
+    g_dsc->entry = NULL;
+}
 
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
+void lv_font_fmt_txt_glyph_cache_resize(uint32_t new_size)
+{
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache_p == NULL && !glyph_cache_create()) return;
+    lv_cache_set_max_size(glyph_cache_p, new_size, NULL);
+    lv_cache_reserve(glyph_cache_p, 0, NULL);
+#else
+    LV_UNUSED(new_size);
+#endif
+}
+
+void lv_font_fmt_txt_glyph_cache_get_stats(lv_font_fmt_txt_glyph_cache_stats_t * stats)
+{
+    lv_memzero(stats, sizeof(lv_font_fmt_txt_glyph_cache_stats_t));
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    stats->hit_cnt = glyph_cache_hit_cnt;
+    stats->miss_cnt = glyph_cache_miss_cnt;
+    if(glyph_cache_p) {
+        stats->size = lv_cache_get_size(glyph_cache_p, NULL);
+        stats->max_size = lv_cache_get_max_size(glyph_cache_p, NULL);
+    }
+    else {
+        stats->max_size = LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE;
+    }
+#endif
 }
 
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
@@ -177,16 +237,23 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
         unicode_letter = ' ';
     }
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
+    /*The cache is shared by all fonts and is reordered on every lookup so keep it locked until the kerning is known*/
+    cache_lock();
+    lv_font_fmt_txt_cache_t * cache = get_cache(fdsc);
+    uint32_t gid = get_glyph_dsc_id(fdsc, cache, unicode_letter);
+    if(!gid) {
+        cache_unlock();
+        return false;
+    }
 
     int8_t kvalue = 0;
     if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        uint32_t gid_next = get_glyph_dsc_id(fdsc, cache, unicode_letter_next);
         if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
+            kvalue = get_kern_value(fdsc, cache, gid, gid_next);
         }
     }
+    cache_unlock();
 
     /*Put together a glyph dsc*/
     const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
@@ -212,16 +279,361 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font)
+{
+    if(font == NULL || font->dsc == NULL) return;
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    cache_lock();
+    lv_font_fmt_txt_cache_t ** next_p = &font_cache_head;
+    while(*next_p) {
+        lv_font_fmt_txt_cache_t * cache = *next_p;
+        if(cache->fdsc == font->dsc) {
+            *next_p = cache->next;
+            lv_free(cache->kern);
+            lv_free(cache);
+            break;
+        }
+        next_p = &cache->next;
+    }
+    cache_unlock();
+#endif
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    /*Dropping a font is rare, simply start with an empty glyph cache*/
+    if(glyph_cache_p) lv_cache_drop_all(glyph_cache_p, NULL);
+#endif
+
+    LV_UNUSED(font);
+}
+
+void _lv_font_fmt_txt_cache_init(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_mutex_init(&font_cache_mutex);
+#endif
+}
+
+void _lv_font_fmt_txt_cache_deinit(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    while(font_cache_head) {
+        lv_font_fmt_txt_cache_t * cache = font_cache_head;
+        font_cache_head = cache->next;
+        lv_free(cache->kern);
+        lv_free(cache);
+    }
+    lv_mutex_delete(&font_cache_mutex);
+#endif
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+    if(glyph_cache_p) {
+        lv_cache_destroy(glyph_cache_p, NULL);
+        glyph_cache_p = NULL;
+    }
+    glyph_cache_hit_cnt = 0;
+    glyph_cache_miss_cnt = 0;
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+/**
+ * Lock the glyph id and kerning caches. Glyph descriptors can be requested
+ * from the draw threads too, and every lookup reorders the shared list and writes the slots.
+ */
+static inline void cache_lock(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_mutex_lock(&font_cache_mutex);
+#endif
+}
+
+static inline void cache_unlock(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_mutex_unlock(&font_cache_mutex);
+#endif
+}
+
+/**
+ * Get the glyph id and kerning cache of a font. Create it on the first use.
+ * Must be called with `cache_lock()` held, the returned cache is valid until `cache_unlock()`.
+ * @param fdsc      the font descriptor
+ * @return          the cache or NULL if caching is disabled or out of memory
+ */
+static lv_font_fmt_txt_cache_t * get_cache(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    /*Usually the same font is used for many letters so keep the last used font at the head*/
+    lv_font_fmt_txt_cache_t * cache = font_cache_head;
+    lv_font_fmt_txt_cache_t * prev = NULL;
+    while(cache) {
+        if(cache->fdsc == fdsc) break;
+        prev = cache;
+        cache = cache->next;
+    }
+
+    if(cache && cache->cmaps != fdsc->cmaps) {
+        /*The descriptor was freed and allocated again for an other font without dropping the cache*/
+        if(prev) prev->next = cache->next;
+        else font_cache_head = cache->next;
+        lv_free(cache->kern);
+        lv_free(cache);
+        cache = NULL;
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+        if(glyph_cache_p) lv_cache_drop_all(glyph_cache_p, NULL);
+#endif
+    }
+
+    if(cache == NULL) {
+        cache = lv_malloc(sizeof(lv_font_fmt_txt_cache_t));
+        if(cache == NULL) return NULL;
+        cache->fdsc = fdsc;
+        cache->cmaps = fdsc->cmaps;
+        lv_memset(cache->latin1_gid, 0xFF, sizeof(cache->latin1_gid));
+        lv_memzero(cache->gid, sizeof(cache->gid));
+        cache->kern = NULL;
+        if(fdsc->kern_dsc && fdsc->kern_classes == 0) {
+            cache->kern = lv_malloc_zeroed(sizeof(kern_cache_entry_t) * LV_FONT_FMT_TXT_CACHE_SIZE);
+        }
+        cache->next = font_cache_head;
+        font_cache_head = cache;
+    }
+    else if(prev) {
+        prev->next = cache->next;
+        cache->next = font_cache_head;
+        font_cache_head = cache;
+    }
+
+    return cache;
+#else
+    LV_UNUSED(fdsc);
+    return NULL;
+#endif
+}
+
+/**
+ * Decode the bitmap of a glyph to A8
+ * @param fdsc      the font descriptor
+ * @param gdsc      the glyph descriptor
+ * @param out       store the result here, with `lv_draw_buf_width_to_stride(box_w, LV_COLOR_FORMAT_A8)` stride
+ * @return          false if the bitmap format is not supported
+ */
+static bool decode_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                         uint8_t * out)
+{
+    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
+        const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+        uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
+        uint8_t bpp = (uint8_t)fdsc->bpp;
+
+        if(bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) {
+            LV_LOG_WARN("%d bpp is not handled", bpp);
+            return false;
+        }
+
+        /*The rows are not padded in the font, so without stride padding the whole glyph is one run*/
+        if(bpp == 8) {
+            int32_t y;
+            for(y = 0; y < gdsc->box_h; y++) {
+                lv_memcpy(out, bitmap_in, gdsc->box_w);
+                bitmap_in += gdsc->box_w;
+                out += stride;
+            }
+        }
+        else if(stride == gdsc->box_w) {
+            unpack_bits(bitmap_in, 0, out, (int32_t)gdsc->box_w * gdsc->box_h, bpp);
+        }
+        else {
+            int32_t y;
+            for(y = 0; y < gdsc->box_h; y++) {
+                unpack_bits(bitmap_in, (uint32_t)y * gdsc->box_w * bpp, out, gdsc->box_w, bpp);
+                out += stride;
+            }
+        }
+        return true;
+    }
+    /*Handle compressed bitmap*/
+    else {
+#if LV_USE_FONT_COMPRESSED
+        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
+        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], out, gdsc->box_w, gdsc->box_h,
+                   (uint8_t)fdsc->bpp, prefilter);
+        return true;
+#else /*!LV_USE_FONT_COMPRESSED*/
+        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
+        return false;
+#endif
+    }
+}
+
+/**
+ * Store 4 opacity values. `px` has the first pixel in the lowest byte.
+ * The stores are independent of each other so the compiler can merge them where unaligned writes are allowed.
+ */
+static inline void store_4px(uint8_t * out, uint32_t px)
+{
+    out[0] = (uint8_t)px;
+    out[1] = (uint8_t)(px >> 8);
+    out[2] = (uint8_t)(px >> 16);
+    out[3] = (uint8_t)(px >> 24);
+}
+
+/**
+ * Convert 1, 2 or 4 bpp pixels to A8.
+ * The middle part is converted a whole input byte at a time, computing 4 pixels in one 32 bit word.
+ * @param in        the packed bitmap
+ * @param bit_pos   index of the first bit to convert in `in`
+ * @param out       store the A8 pixels here
+ * @param len       number of pixels to convert
+ * @param bpp       1, 2 or 4
+ */
+static void unpack_bits(const uint8_t * in, uint32_t bit_pos, uint8_t * out, int32_t len, uint8_t bpp)
+{
+    /*Spread the 4 bits of a nibble to the lowest bit of 4 bytes*/
+    static const uint32_t nibble_to_4px[16] = {
+        0x00000000, 0x01000000, 0x00010000, 0x01010000, 0x00000100, 0x01000100, 0x00010100, 0x01010100,
+        0x00000001, 0x01000001, 0x00010001, 0x01010001, 0x00000101, 0x01000101, 0x00010101, 0x01010101,
+    };
+
+    const uint8_t * opa_table = bpp == 4 ? opa4_table : opa2_table;
+    uint8_t px_mask = (1 << bpp) - 1;
+
+    in += bit_pos >> 3;
+    bit_pos &= 0x7;
+
+    /*Leading pixels until a byte boundary*/
+    while(bit_pos && len) {
+        uint8_t v = (*in >> (8 - bpp - bit_pos)) & px_mask;
+        *out = bpp == 1 ? (v ? 0xFF : 0x00) : opa_table[v];
+        out++;
+        len--;
+        bit_pos += bpp;
+        if(bit_pos == 8) {
+            bit_pos = 0;
+            in++;
+        }
+    }
+
+    /*Whole input bytes*/
+    if(bpp == 1) {
+        for(; len >= 8; len -= 8, out += 8, in++) {
+            store_4px(out, nibble_to_4px[*in >> 4] * 0xFF);
+            store_4px(out + 4, nibble_to_4px[*in & 0xF] * 0xFF);
+        }
+    }
+    else if(bpp == 2) {
+        for(; len >= 4; len -= 4, out += 4, in++) {
+            uint32_t b = *in;
+            store_4px(out, ((b >> 6) | ((b >> 4) & 0x3) << 8 | ((b >> 2) & 0x3) << 16 | (b & 0x3) << 24) * 85);
+        }
+    }
+    else {
+        for(; len >= 4; len -= 4, out += 4, in += 2) {
+            uint32_t b0 = in[0];
+            uint32_t b1 = in[1];
+            store_4px(out, ((b0 >> 4) | (b0 & 0xF) << 8 | (b1 >> 4) << 16 | (b1 & 0xF) << 24) * 17);
+        }
+    }
+
+    /*Trailing pixels*/
+    bit_pos = 0;
+    while(len) {
+        uint8_t v = (*in >> (8 - bpp - bit_pos)) & px_mask;
+        *out = bpp == 1 ? (v ? 0xFF : 0x00) : opa_table[v];
+        out++;
+        len--;
+        bit_pos += bpp;
+        if(bit_pos == 8) {
+            bit_pos = 0;
+            in++;
+        }
+    }
+}
+
+#if LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0
+
+static bool glyph_cache_create(void)
+{
+    glyph_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(glyph_cache_data_t), LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)glyph_cache_free_cb,
+    });
+    return glyph_cache_p != NULL;
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->fdsc != rhs->fdsc) {
+        return (lv_uintptr_t)lhs->fdsc > (lv_uintptr_t)rhs->fdsc ? 1 : -1;
+    }
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+    return 0;
+}
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data)
+{
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = user_data;
+    data->draw_buf = lv_draw_buf_create(gdsc->box_w, gdsc->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(data->draw_buf == NULL) return false;
+
+    if(!decode_glyph(data->fdsc, gdsc, data->draw_buf->data)) {
+        lv_draw_buf_destroy(data->draw_buf);
+        data->draw_buf = NULL;
+        return false;
+    }
+    return true;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_buf_destroy(data->draw_buf);
+}
+
+#endif /*LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE > 0*/
+
+static uint32_t get_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, lv_font_fmt_txt_cache_t * cache, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    if(cache) {
+        if(letter < 256) {
+            uint32_t gid = cache->latin1_gid[letter];
+            if(gid != LATIN1_GID_UNKNOWN) return gid;
+
+            gid = find_glyph_dsc_id(fdsc, letter);
+            if(gid < LATIN1_GID_UNKNOWN) cache->latin1_gid[letter] = (uint16_t)gid;
+            return gid;
+        }
+
+        gid_cache_entry_t * entry = &cache->gid[letter & FONT_CACHE_MASK];
+        if(entry->letter == letter) return entry->gid;
+
+        uint32_t gid = find_glyph_dsc_id(fdsc, letter);
+        if(gid <= UINT16_MAX) {
+            entry->letter = letter;
+            entry->gid = (uint16_t)gid;
+        }
+        return gid;
+    }
+#else
+    LV_UNUSED(cache);
+#endif
+
+    return find_glyph_dsc_id(fdsc, letter);
+}
 
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -265,10 +677,29 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
 }
 
-static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
+static int8_t get_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, lv_font_fmt_txt_cache_t * cache,
+                             uint32_t gid_left, uint32_t gid_right)
 {
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    /*Kern pairs need a binary search, cache the found values*/
+    if(cache && cache->kern && gid_left <= UINT16_MAX && gid_right <= UINT16_MAX) {
+        kern_cache_entry_t * entry = &cache->kern[(gid_left * 31 + gid_right) & FONT_CACHE_MASK];
+        if(entry->gid_left == gid_left && entry->gid_right == gid_right) return entry->value;
+
+        entry->gid_left = (uint16_t)gid_left;
+        entry->gid_right = (uint16_t)gid_right;
+        entry->value = find_kern_value(fdsc, gid_left, gid_right);
+        return entry->value;
+    }
+#else
+    LV_UNUSED(cache);
+#endif
 
+    return find_kern_value(fdsc, gid_left, gid_right);
+}
+
+static int8_t find_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right)
+{
     int8_t value = 0;
 
     if(fdsc->kern_classes == 0) {
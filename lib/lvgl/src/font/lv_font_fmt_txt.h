@@ -193,6 +193,16 @@ typedef struct {
     uint16_t bitmap_format  : 2;
 } lv_font_fmt_txt_dsc_t;
 
+/*Glyph id and kerning lookup cache of a font, see `LV_FONT_FMT_TXT_CACHE_SIZE`*/
+typedef struct _lv_font_fmt_txt_cache_t lv_font_fmt_txt_cache_t;
+
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of glyph bitmaps found in the cache*/
+    uint32_t miss_cnt;      /**< Number of glyph bitmaps decoded again*/
+    uint32_t size;          /**< Size of the cached bitmaps in bytes*/
+    uint32_t max_size;      /**< Max. size of the cache in bytes*/
+} lv_font_fmt_txt_glyph_cache_stats_t;
+
 #if LV_USE_FONT_COMPRESSED
 typedef enum {
     RLE_STATE_SINGLE = 0,
@@ -224,6 +234,15 @@ typedef struct {
 const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, uint32_t unicode_letter,
                                         lv_draw_buf_t * draw_buf);
 
+/**
+ * Release the glyph bitmap returned by `lv_font_get_bitmap_fmt_txt` if it's from the glyph cache.
+ * Can be used as `release_glyph` callback. It's also called by `lv_font_glyph_release_draw_data`
+ * for fonts without `release_glyph` callback.
+ * @param font      pointer to font
+ * @param g_dsc     the glyph descriptor used to get the bitmap
+ */
+void lv_font_release_glyph_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+
 /**
  * Used as `get_glyph_dsc` callback in lvgl's native font format if the font is uncompressed.
  * @param font pointer to font
@@ -236,6 +255,35 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, uint32_t un
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Free the glyph id and kerning cache of a font and the cached glyph bitmaps.
+ * Needs to be called before the `dsc` of a font created at run time is freed.
+ * @param font pointer to a font using `lv_font_fmt_txt_dsc_t`
+ */
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font);
+
+/**
+ * Initialize the lock of the glyph id and kerning caches. Called by `lv_init()`.
+ */
+void _lv_font_fmt_txt_cache_init(void);
+
+/**
+ * Free the glyph id, kerning and glyph bitmap caches of all fonts. Called by `lv_deinit()`.
+ */
+void _lv_font_fmt_txt_cache_deinit(void);
+
+/**
+ * Resize the glyph bitmap cache. The least recently used glyphs are freed if they don't fit.
+ * @param new_size  the new size of the cache in bytes
+ */
+void lv_font_fmt_txt_glyph_cache_resize(uint32_t new_size);
+
+/**
+ * Get the hit/miss counters and the memory usage of the glyph bitmap cache
+ * @param stats     store the statistics here. All zero if the cache is disabled.
+ */
+void lv_font_fmt_txt_glyph_cache_get_stats(lv_font_fmt_txt_glyph_cache_stats_t * stats);
+
 /**********************
  *      MACROS
  **********************/
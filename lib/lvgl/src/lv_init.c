@@ -9,6 +9,7 @@
 #include "core/lv_global.h"
 #include "core/lv_obj.h"
 #include "display/lv_display_private.h"
+#include "font/lv_font_fmt_txt.h"
 #include "indev/lv_indev_private.h"
 #include "layouts/lv_layout.h"
 #include "libs/bin_decoder/lv_bin_decoder.h"
@@ -193,6 +194,8 @@ void lv_init(void)
 
     _lv_obj_style_init();
 
+    _lv_font_fmt_txt_cache_init();
+
     /*Initialize the screen refresh system*/
     _lv_refr_init();
 
@@ -356,6 +359,8 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+    _lv_font_fmt_txt_cache_deinit();
+
     _lv_image_decoder_deinit();
 
     _lv_refr_deinit();
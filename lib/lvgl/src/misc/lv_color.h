@@ -76,6 +76,7 @@ typedef uint8_t lv_opa_t;
                                             (cf) == LV_COLOR_FORMAT_I8 ? 8 :        \
                                             (cf) == LV_COLOR_FORMAT_RGB565 ? 16 :   \
                                             (cf) == LV_COLOR_FORMAT_RGB565A8 ? 16 : \
+                                            (cf) == LV_COLOR_FORMAT_RGB565_SWAPPED ? 16 : \
                                             (cf) == LV_COLOR_FORMAT_ARGB8565 ? 24 : \
                                             (cf) == LV_COLOR_FORMAT_RGB888 ? 24 :   \
                                             (cf) == LV_COLOR_FORMAT_ARGB8888 ? 32 : \
@@ -130,6 +131,7 @@ enum _lv_color_format_t {
     LV_COLOR_FORMAT_RGB565            = 0x12,
     LV_COLOR_FORMAT_ARGB8565          = 0x13,   /**< Not supported by sw renderer yet. */
     LV_COLOR_FORMAT_RGB565A8          = 0x14    /**< Color array followed by Alpha array*/,
+    LV_COLOR_FORMAT_RGB565_SWAPPED    = 0x1B,   /**< RGB565 with swapped bytes (big-endian), as SPI displays expect it*/
 
     /*3 byte (+alpha) formats*/
     LV_COLOR_FORMAT_RGB888            = 0x0F,
@@ -365,6 +367,16 @@ static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_16_16_mix(uint16_t c1, uin
     return ret;
 }
 
+/**
+ * Swap the two bytes of an RGB565 color (little-endian <-> big-endian)
+ * @param c         an RGB565 color
+ * @return          `c` with swapped bytes
+ */
+static inline uint16_t LV_ATTRIBUTE_FAST_MEM lv_color_swap_16(uint16_t c)
+{
+    return (uint16_t)((c >> 8) | (c << 8));
+}
+
 /**
  * Mix white to a color
  * @param c     the base color
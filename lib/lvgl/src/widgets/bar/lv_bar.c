@@ -51,6 +51,8 @@ static void draw_indic(lv_event_t * e);
 static void lv_bar_set_value_with_anim(lv_obj_t * obj, int32_t new_value, int32_t * value_ptr,
                                        _lv_bar_anim_t * anim_info, lv_anim_enable_t en);
 static void lv_bar_init_anim(lv_obj_t * bar, _lv_bar_anim_t * bar_anim);
+static bool calc_indic_area(lv_obj_t * obj, lv_area_t * indic_area);
+static void invalidate_indic_change(lv_obj_t * obj, const lv_area_t * old_indic);
 static void lv_bar_anim(void * bar, int32_t value);
 static void lv_bar_anim_completed(lv_anim_t * a);
 
@@ -127,11 +129,13 @@ void lv_bar_set_range(lv_obj_t * obj, int32_t min, int32_t max)
 
     lv_bar_t * bar = (lv_bar_t *)obj;
 
-    bar->val_reversed = min > max;
+    bool val_reversed = min > max;
 
-    int32_t real_min = bar->val_reversed ? max : min;
-    int32_t real_max = bar->val_reversed ? min : max;
-    if(bar->min_value == real_min && bar->max_value == real_max) return;
+    int32_t real_min = val_reversed ? max : min;
+    int32_t real_max = val_reversed ? min : max;
+    if(bar->min_value == real_min && bar->max_value == real_max && bar->val_reversed == val_reversed) return;
+
+    bar->val_reversed = val_reversed;
 
     bar->max_value = real_max;
     bar->min_value = real_min;
@@ -156,6 +160,8 @@ void lv_bar_set_mode(lv_obj_t * obj, lv_bar_mode_t mode)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_bar_t * bar = (lv_bar_t *)obj;
 
+    if(bar->mode == mode) return;
+
     bar->mode = mode;
     if(bar->mode != LV_BAR_MODE_RANGE) {
         bar->start_value = bar->min_value;
@@ -258,13 +264,16 @@ static void lv_bar_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_anim_delete(&bar->start_value_anim, NULL);
 }
 
-static void draw_indic(lv_event_t * e)
+/**
+ * Calculate the area of the indicator from the current (or animated) values
+ * @param obj           pointer to a bar
+ * @param indic_area    store the indicator area here
+ * @return              true: the bar is horizontal; false: vertical
+ */
+static bool calc_indic_area(lv_obj_t * obj, lv_area_t * indic_area)
 {
-    lv_obj_t * obj = lv_event_get_current_target(e);
     lv_bar_t * bar = (lv_bar_t *)obj;
 
-    lv_layer_t * layer = lv_event_get_layer(e);
-
     lv_area_t bar_coords;
     lv_obj_get_coords(obj, &bar_coords);
 
@@ -290,23 +299,23 @@ static void draw_indic(lv_event_t * e)
     int32_t bg_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
 
     /*Respect padding and minimum width/height too*/
-    lv_area_copy(&bar->indic_area, &bar_coords);
-    bar->indic_area.x1 += bg_left;
-    bar->indic_area.x2 -= bg_right;
-    bar->indic_area.y1 += bg_top;
-    bar->indic_area.y2 -= bg_bottom;
-
-    if(hor && lv_area_get_height(&bar->indic_area) < LV_BAR_SIZE_MIN) {
-        bar->indic_area.y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
-        bar->indic_area.y2 = bar->indic_area.y1 + LV_BAR_SIZE_MIN;
+    lv_area_copy(indic_area, &bar_coords);
+    indic_area->x1 += bg_left;
+    indic_area->x2 -= bg_right;
+    indic_area->y1 += bg_top;
+    indic_area->y2 -= bg_bottom;
+
+    if(hor && lv_area_get_height(indic_area) < LV_BAR_SIZE_MIN) {
+        indic_area->y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
+        indic_area->y2 = indic_area->y1 + LV_BAR_SIZE_MIN;
     }
-    else if(!hor && lv_area_get_width(&bar->indic_area) < LV_BAR_SIZE_MIN) {
-        bar->indic_area.x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
-        bar->indic_area.x2 = bar->indic_area.x1 + LV_BAR_SIZE_MIN;
+    else if(!hor && lv_area_get_width(indic_area) < LV_BAR_SIZE_MIN) {
+        indic_area->x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
+        indic_area->x2 = indic_area->x1 + LV_BAR_SIZE_MIN;
     }
 
-    int32_t indic_max_w = lv_area_get_width(&bar->indic_area);
-    int32_t indic_max_h = lv_area_get_height(&bar->indic_area);
+    int32_t indic_max_w = lv_area_get_width(indic_area);
+    int32_t indic_max_h = lv_area_get_height(indic_area);
 
     /*Calculate the indicator length*/
     int32_t anim_length = hor ? indic_max_w : indic_max_h;
@@ -314,17 +323,14 @@ static void draw_indic(lv_event_t * e)
     int32_t anim_cur_value_x, anim_start_value_x;
 
     int32_t * axis1, * axis2;
-    int32_t (*indic_length_calc)(const lv_area_t * area);
 
     if(hor) {
-        axis1 = &bar->indic_area.x1;
-        axis2 = &bar->indic_area.x2;
-        indic_length_calc = lv_area_get_width;
+        axis1 = &indic_area->x1;
+        axis2 = &indic_area->x2;
     }
     else {
-        axis1 = &bar->indic_area.y1;
-        axis2 = &bar->indic_area.y2;
-        indic_length_calc = lv_area_get_height;
+        axis1 = &indic_area->y1;
+        axis2 = &indic_area->y2;
     }
 
     if(LV_BAR_IS_ANIMATING(bar->start_value_anim)) {
@@ -424,6 +430,35 @@ static void draw_indic(lv_event_t * e)
         }
     }
 
+    return hor;
+}
+
+static void draw_indic(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_bar_t * bar = (lv_bar_t *)obj;
+
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    bool hor = calc_indic_area(obj, &bar->indic_area);
+    bool sym = lv_bar_is_symmetrical(obj);
+
+    lv_area_t bar_coords;
+    lv_obj_get_coords(obj, &bar_coords);
+
+    int32_t transf_w = lv_obj_get_style_transform_width(obj, LV_PART_MAIN);
+    int32_t transf_h = lv_obj_get_style_transform_height(obj, LV_PART_MAIN);
+    lv_area_increase(&bar_coords, transf_w, transf_h);
+    int32_t barw = lv_area_get_width(&bar_coords);
+    int32_t barh = lv_area_get_height(&bar_coords);
+
+    int32_t bg_left = lv_obj_get_style_pad_left(obj,     LV_PART_MAIN);
+    int32_t bg_right = lv_obj_get_style_pad_right(obj,   LV_PART_MAIN);
+    int32_t bg_top = lv_obj_get_style_pad_top(obj,       LV_PART_MAIN);
+    int32_t bg_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
+
+    int32_t (*indic_length_calc)(const lv_area_t * area) = hor ? lv_area_get_width : lv_area_get_height;
+
     /*Do not draw a zero length indicator but at least call the draw task event*/
     if(!sym && indic_length_calc(&bar->indic_area) <= 1) {
         lv_obj_send_event(obj, LV_EVENT_DRAW_TASK_ADDED, NULL);
@@ -595,8 +630,12 @@ static void lv_bar_event(const lv_obj_class_t * class_p, lv_event_t * e)
 static void lv_bar_anim(void * var, int32_t value)
 {
     _lv_bar_anim_t * bar_anim = var;
+    if(bar_anim->anim_state == value) return;
+
+    lv_area_t old_indic;
+    calc_indic_area(bar_anim->bar, &old_indic);
     bar_anim->anim_state    = value;
-    lv_obj_invalidate(bar_anim->bar);
+    invalidate_indic_change(bar_anim->bar, &old_indic);
 }
 
 static void lv_bar_anim_completed(lv_anim_t * a)
@@ -605,22 +644,28 @@ static void lv_bar_anim_completed(lv_anim_t * a)
     lv_obj_t * obj = (lv_obj_t *)var->bar;
     lv_bar_t * bar = (lv_bar_t *)obj;
 
+    lv_area_t old_indic;
+    calc_indic_area(obj, &old_indic);
     var->anim_state = LV_BAR_ANIM_STATE_INV;
     if(var == &bar->cur_value_anim)
         bar->cur_value = var->anim_end;
     else if(var == &bar->start_value_anim)
         bar->start_value = var->anim_end;
-    lv_obj_invalidate(var->bar);
+    invalidate_indic_change(obj, &old_indic);
 }
 
 static void lv_bar_set_value_with_anim(lv_obj_t * obj, int32_t new_value, int32_t * value_ptr,
                                        _lv_bar_anim_t * anim_info, lv_anim_enable_t en)
 {
+    /*The indicator as it's drawn now, before the value and the animation state change*/
+    lv_area_t old_indic;
+    calc_indic_area(obj, &old_indic);
+
     if(en == LV_ANIM_OFF) {
         lv_anim_delete(anim_info, NULL);
         anim_info->anim_state = LV_BAR_ANIM_STATE_INV;
         *value_ptr = new_value;
-        lv_obj_invalidate((lv_obj_t *)obj);
+        invalidate_indic_change(obj, &old_indic);
 
         /*Stop the previous animation if it exists*/
         lv_anim_delete(anim_info, NULL);
@@ -642,6 +687,11 @@ static void lv_bar_set_value_with_anim(lv_obj_t * obj, int32_t new_value, int32_
         /*Stop the previous animation if it exists*/
         lv_anim_delete(anim_info, NULL);
 
+        /*Draw from the animation's start position. It's not the same as the old one
+         *if the previous animation was interrupted*/
+        anim_info->anim_state = LV_BAR_ANIM_STATE_START;
+        invalidate_indic_change(obj, &old_indic);
+
         lv_anim_t a;
         lv_anim_init(&a);
         lv_anim_set_var(&a, anim_info);
@@ -661,4 +711,76 @@ static void lv_bar_init_anim(lv_obj_t * obj, _lv_bar_anim_t * bar_anim)
     bar_anim->anim_state = LV_BAR_ANIM_STATE_INV;
 }
 
+/**
+ * Invalidate only the part of the bar where the indicator changed.
+ * Usually only one end of the indicator moves so a strip around the old and new end is enough.
+ * @param obj           pointer to a bar
+ * @param old_indic     the indicator area before the change
+ */
+static void invalidate_indic_change(lv_obj_t * obj, const lv_area_t * old_indic)
+{
+    /*Derived widgets (e.g. slider) draw other parts (e.g. the knob) depending on the value*/
+    if(lv_obj_get_class(obj) != &lv_bar_class) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t new_indic;
+    bool hor = calc_indic_area(obj, &new_indic);
+    if(_lv_area_is_equal(old_indic, &new_indic)) return;
+
+    /*The rounded ends, the border, shadow and outline are drawn around the moved end too*/
+    int32_t radius = lv_obj_get_style_radius(obj, LV_PART_INDICATOR);
+    int32_t border = lv_obj_get_style_border_width(obj, LV_PART_INDICATOR);
+    int32_t ext = lv_obj_calculate_ext_draw_size(obj, LV_PART_INDICATOR);
+    int32_t old_len = hor ? lv_area_get_width(old_indic) : lv_area_get_height(old_indic);
+    int32_t new_len = hor ? lv_area_get_width(&new_indic) : lv_area_get_height(&new_indic);
+    int32_t thickness = hor ? lv_area_get_height(&new_indic) : lv_area_get_width(&new_indic);
+    if(radius > thickness >> 1) radius = thickness >> 1;
+
+    /*A short indicator's radius depends on its length, so both ends change*/
+    if(radius > 0 && LV_MIN(old_len, new_len) <= 2 * radius) {
+        lv_area_t inv_area;
+        _lv_area_join(&inv_area, old_indic, &new_indic);
+        lv_area_increase(&inv_area, ext + border, ext + border);
+        lv_obj_invalidate_area(obj, &inv_area);
+        return;
+    }
+
+    int32_t margin = LV_MAX(radius, border) + ext + 1;
+    lv_area_t inv_area;
+    _lv_area_join(&inv_area, old_indic, &new_indic);
+    lv_area_increase(&inv_area, ext + border, ext + border);
+
+    /*Invalidate a strip around both ends if they have moved*/
+    if(hor) {
+        if(old_indic->x1 != new_indic.x1) {
+            lv_area_t end_area = inv_area;
+            end_area.x1 = LV_MIN(old_indic->x1, new_indic.x1) - margin;
+            end_area.x2 = LV_MAX(old_indic->x1, new_indic.x1) + margin;
+            lv_obj_invalidate_area(obj, &end_area);
+        }
+        if(old_indic->x2 != new_indic.x2) {
+            lv_area_t end_area = inv_area;
+            end_area.x1 = LV_MIN(old_indic->x2, new_indic.x2) - margin;
+            end_area.x2 = LV_MAX(old_indic->x2, new_indic.x2) + margin;
+            lv_obj_invalidate_area(obj, &end_area);
+        }
+    }
+    else {
+        if(old_indic->y1 != new_indic.y1) {
+            lv_area_t end_area = inv_area;
+            end_area.y1 = LV_MIN(old_indic->y1, new_indic.y1) - margin;
+            end_area.y2 = LV_MAX(old_indic->y1, new_indic.y1) + margin;
+            lv_obj_invalidate_area(obj, &end_area);
+        }
+        if(old_indic->y2 != new_indic.y2) {
+            lv_area_t end_area = inv_area;
+            end_area.y1 = LV_MIN(old_indic->y2, new_indic.y2) - margin;
+            end_area.y2 = LV_MAX(old_indic->y2, new_indic.y2) + margin;
+            lv_obj_invalidate_area(obj, &end_area);
+        }
+    }
+}
+
 #endif
@@ -55,6 +55,12 @@ static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords);
+static const lv_draw_label_lines_t * get_lines(lv_obj_t * obj, const lv_font_t * font, int32_t letter_space,
+                                               int32_t max_w, lv_text_flag_t flag);
+static uint32_t get_line_end(const lv_draw_label_lines_t * lines, uint32_t line_idx, const char * txt,
+                             uint32_t line_start, const lv_font_t * font, int32_t letter_space, int32_t max_w, lv_text_flag_t flag);
+static void get_text_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, int32_t letter_space,
+                          int32_t line_space, int32_t max_w, lv_text_flag_t flag);
 
 /**********************
  *  STATIC VARIABLES
@@ -291,16 +297,20 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
     lv_obj_get_content_coords(obj, &txt_coords);
     const int32_t max_w = lv_area_get_width(&txt_coords);
 
+    const lv_draw_label_lines_t * lines = get_lines((lv_obj_t *)obj, font, letter_space, max_w, flag);
+
     int32_t y = 0;
     uint32_t line_start = 0;
+    uint32_t line_idx = 0;
     uint32_t new_line_start = 0;
     while(txt[new_line_start] != '\0') {
-        new_line_start += _lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        new_line_start = get_line_end(lines, line_idx, txt, line_start, font, letter_space, max_w, flag);
         if(byte_id < new_line_start || txt[new_line_start] == '\0')
             break; /*The line of 'index' letter begins at 'line_start'*/
 
         y += letter_height + line_space;
         line_start = new_line_start;
+        line_idx++;
     }
 
     /*If the last character is line break then go to the next line*/
@@ -377,10 +387,12 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
     int32_t y = 0;
 
     lv_text_flag_t flag = get_label_flags(label);
+    const lv_draw_label_lines_t * lines = get_lines((lv_obj_t *)obj, font, letter_space, max_w, flag);
+    uint32_t line_idx = 0;
 
     /*Search the line of the index letter*/;
     while(txt[line_start] != '\0') {
-        new_line_start += _lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        new_line_start = get_line_end(lines, line_idx, txt, line_start, font, letter_space, max_w, flag);
 
         if(pos.y <= y + letter_height) {
             /*The line is found (stored in 'line_start')*/
@@ -394,6 +406,7 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
         y += letter_height + line_space;
 
         line_start = new_line_start;
+        line_idx++;
     }
 
     char * bidi_txt;
@@ -485,29 +498,32 @@ bool lv_label_is_char_under_pos(const lv_obj_t * obj, lv_point_t * pos)
     const int32_t letter_height    = lv_font_get_line_height(font);
 
     lv_text_flag_t flag = get_label_flags(label);
+    const lv_draw_label_lines_t * lines = get_lines((lv_obj_t *)obj, font, letter_space, max_w, flag);
+    uint32_t line_idx = 0;
 
     /*Search the line of the index letter*/
     int32_t y = 0;
     while(txt[line_start] != '\0') {
-        new_line_start += _lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        new_line_start = get_line_end(lines, line_idx, txt, line_start, font, letter_space, max_w, flag);
 
         if(pos->y <= y + letter_height) break; /*The line is found (stored in 'line_start')*/
         y += letter_height + line_space;
 
         line_start = new_line_start;
+        line_idx++;
     }
 
     /*Calculate the x coordinate*/
     const lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, label->text);
 
     int32_t x = 0;
-    if(align == LV_TEXT_ALIGN_CENTER) {
-        const int32_t line_w = lv_text_get_width(&txt[line_start], new_line_start - line_start, font, letter_space);
-        x += lv_area_get_width(&txt_coords) / 2 - line_w / 2;
-    }
-    else if(align == LV_TEXT_ALIGN_RIGHT) {
-        const int32_t line_w = lv_text_get_width(&txt[line_start], new_line_start - line_start, font, letter_space);
-        x += lv_area_get_width(&txt_coords) - line_w;
+    if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
+        int32_t line_w;
+        if(lines) line_w = line_idx < lines->line_cnt ? lines->lines[line_idx].width : 0;
+        else line_w = lv_text_get_width(&txt[line_start], new_line_start - line_start, font, letter_space);
+
+        if(align == LV_TEXT_ALIGN_CENTER) x += lv_area_get_width(&txt_coords) / 2 - line_w / 2;
+        else x += lv_area_get_width(&txt_coords) - line_w;
     }
 
     int32_t last_x = 0;
@@ -640,6 +656,10 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
 #endif
+
+#if LV_LABEL_LINE_CACHE
+    lv_memzero(&label->lines, sizeof(lv_draw_label_lines_t));
+#endif
     label->dot.tmp_ptr   = NULL;
     label->dot_tmp_alloc = 0;
 
@@ -658,6 +678,10 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_free(&label->lines);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -739,6 +763,10 @@ static void draw_main(lv_event_t * e)
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
 
+    /*Pass the line breaks to the draw task too. They are valid while the label is drawn.*/
+    label_draw_dsc.lines = get_lines(obj, label_draw_dsc.font, label_draw_dsc.letter_space, lv_area_get_width(&txt_coords),
+                                     flag);
+
     label_draw_dsc.sel_start = lv_label_get_text_selection_start(obj);
     label_draw_dsc.sel_end = lv_label_get_text_selection_end(obj);
     if(label_draw_dsc.sel_start != LV_DRAW_LABEL_NO_TXT_SEL && label_draw_dsc.sel_end != LV_DRAW_LABEL_NO_TXT_SEL) {
@@ -751,8 +779,8 @@ static void draw_main(lv_event_t * e)
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
        (label_draw_dsc.align == LV_TEXT_ALIGN_CENTER || label_draw_dsc.align == LV_TEXT_ALIGN_RIGHT)) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        get_text_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag);
         if(size.x > lv_area_get_width(&txt_coords)) {
             label_draw_dsc.align = LV_TEXT_ALIGN_LEFT;
         }
@@ -784,8 +812,8 @@ static void draw_main(lv_event_t * e)
 
     if(label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) {
         lv_point_t size;
-        lv_text_get_size(&size, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
-                         LV_COORD_MAX, flag);
+        get_text_size(obj, &size, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                      LV_COORD_MAX, flag);
 
         /*Draw the text again on label to the original to make a circular effect */
         if(size.x > lv_area_get_width(&txt_coords)) {
@@ -843,6 +871,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->text == NULL) return;
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
+#endif
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_invalidate(&label->lines); /*The text might be modified in place*/
 #endif
     label->invalid_size_cache = true;
 
@@ -857,7 +888,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     lv_point_t size;
     lv_text_flag_t flag = get_label_flags(label);
 
-    lv_text_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    get_text_size(obj, &size, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1109,6 +1140,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+#if LV_LABEL_LINE_CACHE
+                lv_draw_label_lines_invalidate(&label->lines);
+#endif
             }
         }
     }
@@ -1141,6 +1175,10 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_invalidate(&label->lines);
+#endif
 }
 
 /**
@@ -1274,4 +1312,49 @@ static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, con
     }
 }
 
+/**
+ * Get the line breaks of the label's text. They are calculated only if the text or the parameters have changed.
+ * @param obj           pointer to a label object
+ * @param font          font of the text
+ * @param letter_space  letter space
+ * @param max_w         max width of the lines
+ * @param flag          flags of the text
+ * @return              the lines of the text or NULL if the lines are not stored
+ */
+static const lv_draw_label_lines_t * get_lines(lv_obj_t * obj, const lv_font_t * font, int32_t letter_space,
+                                               int32_t max_w, lv_text_flag_t flag)
+{
+#if LV_LABEL_LINE_CACHE
+    lv_label_t * label = (lv_label_t *)obj;
+    if(!lv_draw_label_lines_update(&label->lines, label->text, font, letter_space, max_w, flag)) return NULL;
+    return &label->lines;
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(font);
+    LV_UNUSED(letter_space);
+    LV_UNUSED(max_w);
+    LV_UNUSED(flag);
+    return NULL;
+#endif
+}
+
+/* Get the start of the next line from `lines` if available or by measuring the text */
+static uint32_t get_line_end(const lv_draw_label_lines_t * lines, uint32_t line_idx, const char * txt,
+                             uint32_t line_start, const lv_font_t * font, int32_t letter_space, int32_t max_w, lv_text_flag_t flag)
+{
+    if(lines) return line_idx < lines->line_cnt ? lines->lines[line_idx + 1].start : line_start;
+
+    return line_start + _lv_text_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+}
+
+/* Same as `lv_text_get_size()` on the label's text but uses the stored lines */
+static void get_text_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, int32_t letter_space,
+                          int32_t line_space, int32_t max_w, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    const lv_draw_label_lines_t * lines = get_lines(obj, font, letter_space, max_w, flag);
+    if(lines) lv_draw_label_lines_get_size(lines, line_space, size_res);
+    else lv_text_get_size(size_res, label->text, font, letter_space, line_space, max_w, flag);
+}
+
 #endif
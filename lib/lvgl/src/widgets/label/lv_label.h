@@ -77,6 +77,10 @@ typedef struct {
     uint32_t sel_end;
 #endif
 
+#if LV_LABEL_LINE_CACHE
+    lv_draw_label_lines_t lines; /*Line breaks of the text, recalculated only if the text, style or width changes*/
+#endif
+
     lv_point_t size_cache; /*Text size cache*/
     lv_point_t offset; /*Text draw position offset*/
     lv_label_long_mode_t long_mode : 3; /*Determine what to do with the long texts*/
@@ -1,5 +1,8 @@
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_GRADIENT_CACHE_SIZE  (4 * 1024)
+#define LV_FONT_FMT_TXT_CACHE_SIZE      32
+#define LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE (16 * 1024)
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
 #define LV_LOG_PRINTF           1
@@ -44,6 +47,7 @@
 #define LV_USE_PERF_MONITOR         1
 #define LV_USE_MEM_MONITOR          1
 #define LV_LABEL_TEXT_SELECTION     1
+#define LV_LABEL_LINE_CACHE         1
 
 #define LV_USE_FLEX 1
 #define LV_USE_GRID 1
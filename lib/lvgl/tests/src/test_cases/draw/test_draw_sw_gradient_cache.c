@@ -0,0 +1,184 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_grad_dsc_t grad;
+
+void setUp(void)
+{
+    lv_memzero(&grad, sizeof(grad));
+    grad.dir = LV_GRAD_DIR_HOR;
+    grad.stops_count = 2;
+    grad.stops[0].color = lv_color_hex(0xff0000);
+    grad.stops[0].opa = LV_OPA_COVER;
+    grad.stops[0].frac = 0;
+    grad.stops[1].color = lv_color_hex(0x0000ff);
+    grad.stops[1].opa = LV_OPA_50;
+    grad.stops[1].frac = 255;
+
+    /*Start each test with an empty cache*/
+    lv_gradient_cache_resize(0);
+    lv_gradient_cache_resize(LV_DRAW_SW_GRADIENT_CACHE_SIZE);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void assert_gradient_valid(const lv_grad_t * g, int32_t size)
+{
+    TEST_ASSERT_NOT_NULL(g);
+    TEST_ASSERT_EQUAL_UINT32(size, g->size);
+
+    int32_t i;
+    for(i = 0; i < size; i++) {
+        lv_color_t color;
+        lv_opa_t opa;
+        lv_gradient_color_calculate(&grad, size, i, &color, &opa);
+        TEST_ASSERT_EQUAL_COLOR(color, g->color_map[i]);
+        TEST_ASSERT_EQUAL_UINT8(opa, g->opa_map[i]);
+    }
+}
+
+void test_gradient_cache_same_gradient_should_hit(void)
+{
+    lv_gradient_cache_stats_t before;
+    lv_gradient_cache_get_stats(&before);
+
+    lv_grad_t * g1 = lv_gradient_get(&grad, 100, 20);
+    assert_gradient_valid(g1, 100);
+    lv_gradient_cleanup(g1);
+
+    lv_grad_t * g2 = lv_gradient_get(&grad, 100, 50);   /*Only the width matters for horizontal gradients*/
+    TEST_ASSERT_EQUAL_PTR(g1, g2);
+    assert_gradient_valid(g2, 100);
+    lv_gradient_cleanup(g2);
+
+    lv_gradient_cache_stats_t after;
+    lv_gradient_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(1, after.miss_cnt - before.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, after.hit_cnt - before.hit_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(100 * (sizeof(lv_color_t) + sizeof(lv_opa_t)), after.size);
+    TEST_ASSERT_EQUAL_UINT32(LV_DRAW_SW_GRADIENT_CACHE_SIZE, after.max_size);
+}
+
+void test_gradient_cache_key_should_contain_stops_dir_and_size(void)
+{
+    lv_grad_t * g = lv_gradient_get(&grad, 100, 20);
+    lv_gradient_cleanup(g);
+
+    lv_gradient_cache_stats_t before;
+    lv_gradient_cache_get_stats(&before);
+
+    grad.stops[1].frac = 200;
+    g = lv_gradient_get(&grad, 100, 20);
+    assert_gradient_valid(g, 100);
+    lv_gradient_cleanup(g);
+
+    grad.stops[1].opa = LV_OPA_COVER;
+    g = lv_gradient_get(&grad, 100, 20);
+    assert_gradient_valid(g, 100);
+    lv_gradient_cleanup(g);
+
+    g = lv_gradient_get(&grad, 101, 20);
+    assert_gradient_valid(g, 101);
+    lv_gradient_cleanup(g);
+
+    grad.dir = LV_GRAD_DIR_VER;
+    g = lv_gradient_get(&grad, 101, 20);
+    assert_gradient_valid(g, 20);
+    lv_gradient_cleanup(g);
+
+    lv_gradient_cache_stats_t after;
+    lv_gradient_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(4, after.miss_cnt - before.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, after.hit_cnt - before.hit_cnt);
+}
+
+void test_gradient_cache_unused_stops_should_be_ignored(void)
+{
+    lv_grad_t * g = lv_gradient_get(&grad, 100, 20);
+    lv_gradient_cleanup(g);
+
+#if LV_GRADIENT_MAX_STOPS > 2
+    grad.stops[2].color = lv_color_hex(0x00ff00);
+    grad.stops[2].frac = 100;
+#endif
+
+    lv_gradient_cache_stats_t before;
+    lv_gradient_cache_get_stats(&before);
+    g = lv_gradient_get(&grad, 100, 20);
+    lv_gradient_cleanup(g);
+
+    lv_gradient_cache_stats_t after;
+    lv_gradient_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(1, after.hit_cnt - before.hit_cnt);
+}
+
+void test_gradient_cache_should_evict_the_least_recently_used(void)
+{
+    /*Each gradient uses a bit more than half of the cache*/
+    lv_gradient_cache_resize(600);
+
+    lv_grad_t * g = lv_gradient_get(&grad, 100, 20);
+    lv_gradient_cleanup(g);
+    g = lv_gradient_get(&grad, 101, 20);
+    lv_gradient_cleanup(g);
+
+    lv_gradient_cache_stats_t before;
+    lv_gradient_cache_get_stats(&before);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(600, before.size);
+
+    g = lv_gradient_get(&grad, 101, 20);
+    lv_gradient_cleanup(g);
+    g = lv_gradient_get(&grad, 100, 20);
+    assert_gradient_valid(g, 100);
+    lv_gradient_cleanup(g);
+
+    lv_gradient_cache_stats_t after;
+    lv_gradient_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(1, after.hit_cnt - before.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, after.miss_cnt - before.miss_cnt);
+}
+
+void test_gradient_cache_too_large_gradient_should_not_be_cached(void)
+{
+    int32_t size = LV_DRAW_SW_GRADIENT_CACHE_SIZE;
+    lv_grad_t * g = lv_gradient_get(&grad, size, 20);
+    assert_gradient_valid(g, size);
+    TEST_ASSERT_NULL(g->cache_entry);
+    lv_gradient_cleanup(g);
+
+    lv_gradient_cache_stats_t stats;
+    lv_gradient_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+}
+
+void test_gradient_cache_redraw_should_not_calculate_again(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 50);
+    lv_obj_center(obj);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0x0000ff), 0);
+    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, 0);
+    lv_refr_now(NULL);
+
+    lv_gradient_cache_stats_t before;
+    lv_gradient_cache_get_stats(&before);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_invalidate(obj);
+        lv_refr_now(NULL);
+    }
+
+    lv_gradient_cache_stats_t after;
+    lv_gradient_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(0, after.miss_cnt - before.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(5, after.hit_cnt - before.hit_cnt);
+}
+
+#endif
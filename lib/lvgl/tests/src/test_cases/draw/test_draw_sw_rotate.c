@@ -198,6 +198,29 @@ void test_rotate180_ARGB8888(void)
     TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
 }
 
+void test_rotate180_ARGB8888_dest_stride(void)
+{
+    uint32_t srcArray[3 * 2] = {
+        0x111A1B1C, 0x222A2B2C, 0x333A3B3C,
+        0x444A4B4C, 0x555A5B5C, 0x666A6B6C
+    };
+    /*The destination has one padding pixel at the end of each row*/
+    uint32_t dstArray[4 * 2] = {0};
+    uint32_t expectedArray[4 * 2] = {
+        0x666A6B6C, 0x555A5B5C, 0x444A4B4C, 0,
+        0x333A3B3C, 0x222A2B2C, 0x111A1B1C, 0
+    };
+
+    lv_draw_sw_rotate(srcArray, dstArray,
+                      3, 2,
+                      3 * sizeof(uint32_t),
+                      4 * sizeof(uint32_t),
+                      LV_DISPLAY_ROTATION_180,
+                      LV_COLOR_FORMAT_ARGB8888);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
+}
+
 void test_rotate270_ARGB8888(void)
 {
     uint32_t srcArray[3 * 2] = {
@@ -58,4 +58,60 @@ void test_update_layer_type_on_state_change(void)
 
 }
 
+/*Read a pixel of the active ARGB8888 frame buffer*/
+static uint32_t fb_get_px(int32_t x, int32_t y)
+{
+    lv_draw_buf_t * draw_buf = lv_display_get_buf_active(NULL);
+    const uint8_t * row = draw_buf->data + y * draw_buf->header.stride;
+    return ((const uint32_t *)row)[x];
+}
+
+void test_right_angle_rotation_is_exact(void)
+{
+    /*No radius and anti-aliasing, so it's the same on the layer and on the screen*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 100, 60);
+    lv_obj_set_pos(obj, 200, 150);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex3(0xf00), 0);
+    lv_obj_set_style_border_width(obj, 5, 0);
+    lv_obj_set_style_border_side(obj, LV_BORDER_SIDE_LEFT, 0);
+    lv_obj_set_style_border_color(obj, lv_color_hex3(0x00f), 0);
+    lv_obj_set_style_transform_pivot_x(obj, 50, 0);
+    lv_obj_set_style_transform_pivot_y(obj, 30, 0);
+
+    lv_obj_t * corner = lv_obj_create(obj);
+    lv_obj_remove_style_all(corner);
+    lv_obj_set_size(corner, 20, 10);
+    lv_obj_set_pos(corner, 5, 0);
+    lv_obj_set_style_bg_opa(corner, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(corner, lv_color_hex3(0x0f0), 0);
+    lv_refr_now(NULL);
+
+    static uint32_t src[60][100];
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < 60; y++) {
+        for(x = 0; x < 100; x++) {
+            src[y][x] = fb_get_px(200 + x, 150 + y);
+        }
+    }
+
+    int32_t rotation;
+    for(rotation = 900; rotation < 3600; rotation += 900) {
+        lv_obj_set_style_transform_rotation(obj, rotation, 0);
+        lv_refr_now(NULL);
+
+        for(y = 0; y < 60; y++) {
+            for(x = 0; x < 100; x++) {
+                /*Where (x;y) lands after rotating around (50;30)*/
+                int32_t rx = rotation == 900 ? 50 + 30 - y : rotation == 1800 ? 2 * 50 - x : 50 - 30 + y;
+                int32_t ry = rotation == 900 ? 30 - 50 + x : rotation == 1800 ? 2 * 30 - y : 50 + 30 - x;
+                TEST_ASSERT_EQUAL_HEX32(src[y][x], fb_get_px(200 + rx, 150 + ry));
+            }
+        }
+    }
+}
+
 #endif
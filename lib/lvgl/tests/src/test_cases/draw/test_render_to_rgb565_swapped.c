@@ -0,0 +1,57 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_XRGB8888);
+}
+
+/*The swapped bytes are swapped back before comparing so the RGB565 reference images are used*/
+void test_render_to_rgb565_swapped(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565_SWAPPED);
+
+    lv_opa_t opa_values[2] = {0xff, 0x80};
+    uint32_t opa;
+    for(opa = 0; opa < 2; opa++) {
+        uint32_t i;
+        for(i = 0; i < _LV_DEMO_RENDER_SCENE_NUM; i++) {
+            lv_demo_render(i, opa_values[opa]);
+
+            char buf[128];
+            lv_snprintf(buf, sizeof(buf), "draw/render/rgb565/demo_render_%s_opa_%d.png",
+                        lv_demo_render_get_scene_name(i), opa_values[opa]);
+            TEST_ASSERT_EQUAL_SCREENSHOT(buf);
+        }
+    }
+}
+
+/*A single pixel is stored big-endian in the draw buffer*/
+void test_render_to_rgb565_swapped_byte_order(void)
+{
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565_SWAPPED);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_clean(scr);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    lv_refr_now(NULL);
+
+    extern uint8_t * last_flushed_buf;
+    uint8_t * buf = lv_draw_buf_align(last_flushed_buf, LV_COLOR_FORMAT_RGB565_SWAPPED);
+    TEST_ASSERT_EQUAL_HEX8(0xf8, buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, buf[1]);
+
+    lv_obj_set_style_bg_color(scr, lv_color_white(), 0);
+}
+
+#endif
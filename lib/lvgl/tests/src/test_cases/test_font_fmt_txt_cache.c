@@ -0,0 +1,146 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*Montserrat 14 with kern pairs instead of kern classes*/
+static const uint8_t kern_pair_ids[] = {
+    34, 55,     /*A V*/
+    55, 34,     /*V A*/
+    55, 87,     /*V v*/
+};
+static const int8_t kern_pair_values[] = {-32, -16, 16};
+static const lv_font_fmt_txt_kern_pair_t kern_pairs = {
+    .glyph_ids = kern_pair_ids,
+    .values = kern_pair_values,
+    .pair_cnt = 3,
+    .glyph_ids_size = 0,
+};
+static lv_font_fmt_txt_dsc_t kern_pair_dsc;
+static lv_font_t kern_pair_font;
+
+void setUp(void)
+{
+    kern_pair_dsc = *(const lv_font_fmt_txt_dsc_t *)lv_font_montserrat_14.dsc;
+    kern_pair_dsc.kern_dsc = &kern_pairs;
+    kern_pair_dsc.kern_classes = 0;
+    kern_pair_font = lv_font_montserrat_14;
+    kern_pair_font.dsc = &kern_pair_dsc;
+}
+
+void tearDown(void)
+{
+    lv_font_fmt_txt_cache_drop(&kern_pair_font);
+}
+
+static bool get_dsc(const lv_font_t * font, uint32_t letter, uint32_t letter_next, lv_font_glyph_dsc_t * dsc)
+{
+    lv_memzero(dsc, sizeof(lv_font_glyph_dsc_t));
+    return lv_font_get_glyph_dsc_fmt_txt(font, dsc, letter, letter_next);
+}
+
+/*Compare with the result of an empty cache, i.e. with the result of the plain lookup*/
+static void assert_same_as_uncached(const lv_font_t * font, uint32_t letter, uint32_t letter_next)
+{
+    lv_font_glyph_dsc_t dsc;
+    bool found = get_dsc(font, letter, letter_next, &dsc);
+
+    lv_font_fmt_txt_cache_drop(font);
+    lv_font_glyph_dsc_t dsc_ref;
+    bool found_ref = get_dsc(font, letter, letter_next, &dsc_ref);
+
+    TEST_ASSERT_EQUAL(found_ref, found);
+    TEST_ASSERT_EQUAL_UINT16(dsc_ref.adv_w, dsc.adv_w);
+    TEST_ASSERT_EQUAL_UINT16(dsc_ref.box_w, dsc.box_w);
+    TEST_ASSERT_EQUAL_UINT16(dsc_ref.box_h, dsc.box_h);
+    TEST_ASSERT_EQUAL_INT16(dsc_ref.ofs_x, dsc.ofs_x);
+    TEST_ASSERT_EQUAL_INT16(dsc_ref.ofs_y, dsc.ofs_y);
+}
+
+void test_font_cache_latin1_should_match_the_cmaps(void)
+{
+    uint32_t letter;
+    /*Fill the cache first*/
+    for(letter = 1; letter < 256; letter++) {
+        lv_font_glyph_dsc_t dsc;
+        get_dsc(&lv_font_montserrat_14, letter, 0, &dsc);
+    }
+
+    for(letter = 1; letter < 256; letter++) {
+        assert_same_as_uncached(&lv_font_montserrat_14, letter, 0);
+    }
+
+    /*Not in the font*/
+    lv_font_glyph_dsc_t dsc;
+    TEST_ASSERT_FALSE(get_dsc(&lv_font_montserrat_14, 0x1F, 0, &dsc));
+    TEST_ASSERT_FALSE(get_dsc(&lv_font_montserrat_14, 0x1F, 0, &dsc));
+}
+
+void test_font_cache_symbols_should_match_the_cmaps(void)
+{
+    static const char * symbols[] = {
+        LV_SYMBOL_BATTERY_FULL, LV_SYMBOL_BATTERY_3, LV_SYMBOL_BATTERY_2, LV_SYMBOL_BATTERY_1,
+        LV_SYMBOL_BATTERY_EMPTY, LV_SYMBOL_WIFI, LV_SYMBOL_BLUETOOTH, LV_SYMBOL_GPS,
+        LV_SYMBOL_UP, LV_SYMBOL_DOWN, LV_SYMBOL_LEFT, LV_SYMBOL_RIGHT, LV_SYMBOL_CHARGE,
+    };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(symbols) / sizeof(symbols[0]); i++) {
+        uint32_t ofs = 0;
+        uint32_t letter = _lv_text_encoded_next(symbols[i], &ofs);
+        lv_font_glyph_dsc_t dsc;
+        TEST_ASSERT_TRUE(get_dsc(&lv_font_montserrat_14, letter, 0, &dsc));
+        TEST_ASSERT_TRUE(get_dsc(&lv_font_montserrat_14, letter, 0, &dsc));
+        assert_same_as_uncached(&lv_font_montserrat_14, letter, 0);
+    }
+}
+
+void test_font_cache_colliding_letters_should_not_be_mixed(void)
+{
+    /*These letters use the same slot of the hashed cache*/
+    uint32_t letters[] = {0x4E00, 0x4E00 + LV_FONT_FMT_TXT_CACHE_SIZE, 0x4E00 + 2 * LV_FONT_FMT_TXT_CACHE_SIZE, 0xF000};
+    lv_font_glyph_dsc_t dsc_ref[4];
+    bool found_ref[4];
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_font_fmt_txt_cache_drop(&lv_font_simsun_16_cjk);
+        found_ref[i] = get_dsc(&lv_font_simsun_16_cjk, letters[i], 0, &dsc_ref[i]);
+    }
+
+    uint32_t round;
+    for(round = 0; round < 3; round++) {
+        for(i = 0; i < 4; i++) {
+            lv_font_glyph_dsc_t dsc;
+            TEST_ASSERT_EQUAL(found_ref[i], get_dsc(&lv_font_simsun_16_cjk, letters[i], 0, &dsc));
+            TEST_ASSERT_EQUAL_UINT16(dsc_ref[i].adv_w, dsc.adv_w);
+            TEST_ASSERT_EQUAL_UINT16(dsc_ref[i].box_w, dsc.box_w);
+            TEST_ASSERT_EQUAL_INT16(dsc_ref[i].ofs_y, dsc.ofs_y);
+        }
+    }
+}
+
+void test_font_cache_kern_pairs_should_be_applied(void)
+{
+    int32_t w_a = lv_font_get_glyph_width(&kern_pair_font, 'A', 0);
+    int32_t w_v = lv_font_get_glyph_width(&kern_pair_font, 'V', 0);
+
+    /*Repeat to read the values from the cache too*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT32(w_a - 2, lv_font_get_glyph_width(&kern_pair_font, 'A', 'V'));
+        TEST_ASSERT_EQUAL_INT32(w_v - 1, lv_font_get_glyph_width(&kern_pair_font, 'V', 'A'));
+        TEST_ASSERT_EQUAL_INT32(w_v + 1, lv_font_get_glyph_width(&kern_pair_font, 'V', 'v'));
+        TEST_ASSERT_EQUAL_INT32(w_a, lv_font_get_glyph_width(&kern_pair_font, 'A', 'A'));
+    }
+
+    /*Check all the pairs of a text*/
+    const char * txt = "AVAvVAVvAbVVAAvv";
+    uint32_t j;
+    for(i = 0; txt[i + 1]; i++) {
+        for(j = 0; j < 2; j++) {
+            assert_same_as_uncached(&kern_pair_font, txt[i], txt[i + 1]);
+        }
+    }
+}
+
+#endif
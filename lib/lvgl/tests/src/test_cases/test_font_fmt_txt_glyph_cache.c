@@ -0,0 +1,190 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+LV_FONT_DECLARE(test_font_montserrat_ascii_1bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_2bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp_compressed)
+
+static lv_draw_buf_t * draw_buf;
+
+void setUp(void)
+{
+    /*Start each test with an empty cache*/
+    lv_font_fmt_txt_glyph_cache_resize(0);
+    lv_font_fmt_txt_glyph_cache_resize(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE);
+    draw_buf = lv_draw_buf_create(64, 64, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+}
+
+void tearDown(void)
+{
+    lv_draw_buf_destroy(draw_buf);
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Get the A8 bitmap of a letter. Copy it to `out` with `box_w` stride and release the glyph.*/
+static bool get_a8(const lv_font_t * font, uint32_t letter, uint8_t * out, lv_font_glyph_dsc_t * g)
+{
+    lv_font_get_glyph_dsc(font, g, letter, 0);
+    lv_draw_buf_t * buf = lv_draw_buf_reshape(draw_buf, LV_COLOR_FORMAT_A8, g->box_w, g->box_h, LV_STRIDE_AUTO);
+    const lv_draw_buf_t * res = lv_font_get_glyph_bitmap(g, letter, buf);
+    if(res == NULL) return false;
+
+    int32_t y;
+    for(y = 0; y < g->box_h; y++) {
+        lv_memcpy(out + y * g->box_w, res->data + y * res->header.stride, g->box_w);
+    }
+    lv_font_glyph_release_draw_data(g);
+    return true;
+}
+
+/*Unpack a plain glyph pixel by pixel as a reference*/
+static void unpack_ref(const lv_font_t * font, uint32_t letter, uint8_t * out)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    lv_font_glyph_dsc_t g;
+    lv_font_get_glyph_dsc(font, &g, letter, 0);
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[letter - 32 + 1];
+    const uint8_t * in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+    uint32_t bpp = fdsc->bpp;
+    uint32_t max = (1 << bpp) - 1;
+    uint32_t i;
+    for(i = 0; i < (uint32_t)g.box_w * g.box_h; i++) {
+        uint32_t bit = i * bpp;
+        uint32_t v = (in[bit / 8] >> (8 - bpp - bit % 8)) & max;
+        out[i] = (uint8_t)(v * 255 / max);
+    }
+}
+
+static void test_plain_font(const lv_font_t * font)
+{
+    static uint8_t a8[64 * 64];
+    static uint8_t ref[64 * 64];
+    uint32_t letter;
+    for(letter = 33; letter < 127; letter++) {
+        lv_font_glyph_dsc_t g;
+        TEST_ASSERT_TRUE(get_a8(font, letter, a8, &g));
+        unpack_ref(font, letter, ref);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, a8, g.box_w * g.box_h);
+
+        /*From the cache*/
+        lv_memzero(a8, sizeof(a8));
+        TEST_ASSERT_TRUE(get_a8(font, letter, a8, &g));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, a8, g.box_w * g.box_h);
+
+        /*Without cache*/
+        lv_font_fmt_txt_glyph_cache_resize(0);
+        lv_memzero(a8, sizeof(a8));
+        TEST_ASSERT_TRUE(get_a8(font, letter, a8, &g));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, a8, g.box_w * g.box_h);
+        lv_font_fmt_txt_glyph_cache_stats_t stats;
+        lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+        TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+        lv_font_fmt_txt_glyph_cache_resize(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE);
+    }
+}
+
+void test_glyph_cache_1bpp_should_match_the_font(void)
+{
+    test_plain_font(&test_font_montserrat_ascii_1bpp);
+}
+
+void test_glyph_cache_2bpp_should_match_the_font(void)
+{
+    test_plain_font(&test_font_montserrat_ascii_2bpp);
+}
+
+void test_glyph_cache_4bpp_should_match_the_font(void)
+{
+    test_plain_font(&test_font_montserrat_ascii_4bpp);
+}
+
+void test_glyph_cache_compressed_should_match_uncached(void)
+{
+    static uint8_t a8[64 * 64];
+    static uint8_t ref[64 * 64];
+    const lv_font_t * font = &test_font_montserrat_ascii_4bpp_compressed;
+    uint32_t letter;
+    for(letter = 33; letter < 127; letter++) {
+        lv_font_glyph_dsc_t g;
+        lv_font_fmt_txt_glyph_cache_resize(0);
+        TEST_ASSERT_TRUE(get_a8(font, letter, ref, &g));
+
+        lv_font_fmt_txt_glyph_cache_resize(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE);
+        TEST_ASSERT_TRUE(get_a8(font, letter, a8, &g));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, a8, g.box_w * g.box_h);
+        TEST_ASSERT_TRUE(get_a8(font, letter, a8, &g));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, a8, g.box_w * g.box_h);
+    }
+}
+
+void test_glyph_cache_redraw_should_only_hit(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "N/A Speed 100%");
+    lv_obj_center(label);
+    lv_refr_now(NULL);
+
+    lv_font_fmt_txt_glyph_cache_stats_t before;
+    lv_font_fmt_txt_glyph_cache_get_stats(&before);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, before.size);
+
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+
+    lv_font_fmt_txt_glyph_cache_stats_t after;
+    lv_font_fmt_txt_glyph_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(before.miss_cnt, after.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(12, after.hit_cnt - before.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(before.size, after.size);
+
+    /*All the glyphs are released after drawing so they can be evicted*/
+    lv_font_fmt_txt_glyph_cache_resize(0);
+    lv_font_fmt_txt_glyph_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(0, after.size);
+}
+
+void test_glyph_cache_should_evict_the_least_recently_used(void)
+{
+    static uint8_t a8[64 * 64];
+    const lv_font_t * font = &test_font_montserrat_ascii_4bpp;
+    lv_font_glyph_dsc_t g;
+
+    /*Fits only 'A' and 'B'*/
+    get_a8(font, 'A', a8, &g);
+    get_a8(font, 'B', a8, &g);
+    lv_font_fmt_txt_glyph_cache_stats_t stats;
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    lv_font_fmt_txt_glyph_cache_resize(stats.size);
+
+    get_a8(font, 'A', a8, &g);      /*'B' is the least recently used now*/
+    get_a8(font, 'C', a8, &g);      /*Evicts 'B' first*/
+
+    lv_font_fmt_txt_glyph_cache_stats_t before;
+    lv_font_fmt_txt_glyph_cache_get_stats(&before);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(before.max_size, before.size);
+
+    get_a8(font, 'C', a8, &g);
+    get_a8(font, 'B', a8, &g);
+
+    lv_font_fmt_txt_glyph_cache_stats_t after;
+    lv_font_fmt_txt_glyph_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(1, after.hit_cnt - before.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, after.miss_cnt - before.miss_cnt);
+}
+
+void test_glyph_cache_too_large_glyph_should_not_be_cached(void)
+{
+    static uint8_t a8[64 * 64];
+    lv_font_glyph_dsc_t g;
+    lv_font_fmt_txt_glyph_cache_resize(16);
+    TEST_ASSERT_TRUE(get_a8(&test_font_montserrat_ascii_4bpp, 'W', a8, &g));
+
+    lv_font_fmt_txt_glyph_cache_stats_t stats;
+    lv_font_fmt_txt_glyph_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+}
+
+#endif
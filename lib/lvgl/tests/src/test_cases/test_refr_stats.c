@@ -0,0 +1,153 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "../../src/display/lv_display_private.h"
+
+#define DISP_HOR_RES    320
+#define DISP_VER_RES    240
+#define BUF_SIZE        (DISP_HOR_RES * DISP_VER_RES / 10 * 2)
+
+static lv_display_t * disp;
+static lv_display_t * disp_prev;
+static uint8_t buf[BUF_SIZE + LV_DRAW_BUF_ALIGN];
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(d);
+}
+
+/*Invalidate the areas and refresh the display*/
+static const lv_display_refr_stats_t * refr_areas(const lv_area_t * areas, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        _lv_inv_area(disp, &areas[i]);
+    }
+    lv_refr_now(disp);
+    return lv_display_get_refr_stats(disp);
+}
+
+void setUp(void)
+{
+    disp_prev = lv_display_get_default();
+    disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
+    lv_display_set_default(disp);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_RGB565), NULL, BUF_SIZE,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_refr_now(disp);
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+    lv_display_set_default(disp_prev);
+}
+
+void test_refr_stats_full_screen(void)
+{
+    lv_area_t area = {0, 0, DISP_HOR_RES - 1, DISP_VER_RES - 1};
+    const lv_display_refr_stats_t * stats = refr_areas(&area, 1);
+
+    uint32_t rows = BUF_SIZE / lv_draw_buf_width_to_stride(DISP_HOR_RES, LV_COLOR_FORMAT_RGB565);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32((DISP_VER_RES + rows - 1) / rows, stats->flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(DISP_HOR_RES * DISP_VER_RES, stats->px_invalidated);
+    TEST_ASSERT_EQUAL_UINT32(DISP_HOR_RES * DISP_VER_RES, stats->px_rendered);
+    TEST_ASSERT_EQUAL_UINT32(DISP_HOR_RES * DISP_VER_RES, stats->px_flushed);
+    TEST_ASSERT_EQUAL_UINT32(DISP_HOR_RES * DISP_VER_RES * 2, stats->flush_bytes);
+}
+
+/*The stripe height depends on the width of the area: a narrow area fits into a single tall stripe*/
+void test_refr_stats_narrow_area_is_one_stripe(void)
+{
+    lv_area_t area = {100, 10, 129, 209};
+    const lv_display_refr_stats_t * stats = refr_areas(&area, 1);
+
+    TEST_ASSERT_EQUAL_UINT32(1, stats->flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(30 * 200, stats->px_flushed);
+}
+
+void test_refr_stats_touching_areas_are_coalesced(void)
+{
+    lv_area_t areas[3] = {
+        {10, 10, 39, 59},
+        {10, 60, 39, 109},      /*Below the first*/
+        {40, 10, 59, 109},      /*Right to both*/
+    };
+    const lv_display_refr_stats_t * stats = refr_areas(areas, 3);
+
+    TEST_ASSERT_EQUAL_UINT32(3, stats->inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(50 * 100, stats->px_invalidated);
+    TEST_ASSERT_EQUAL_UINT32(50 * 100, stats->px_rendered);
+}
+
+void test_refr_stats_not_aligned_areas_are_kept(void)
+{
+    lv_area_t areas[2] = {
+        {10, 10, 39, 109},
+        {20, 110, 49, 209},     /*Below the first but shifted*/
+    };
+    const lv_display_refr_stats_t * stats = refr_areas(areas, 2);
+
+    TEST_ASSERT_EQUAL_UINT32(2, stats->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, stats->flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * 30 * 100, stats->px_rendered);
+}
+
+void test_refr_stats_overlapping_areas(void)
+{
+    lv_area_t areas[2] = {
+        {10, 10, 109, 59},
+        {50, 10, 149, 59},      /*Overlaps the first*/
+    };
+    const lv_display_refr_stats_t * stats = refr_areas(areas, 2);
+
+    TEST_ASSERT_EQUAL_UINT32(2, stats->inv_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * 100 * 50, stats->px_invalidated);
+    TEST_ASSERT_EQUAL_UINT32(140 * 50, stats->px_rendered);
+    TEST_ASSERT_EQUAL_UINT32(140 * 50, stats->px_flushed);
+}
+
+void test_refr_stats_area_overhead_joins_nearby_areas(void)
+{
+    lv_area_t areas[2] = {
+        {10, 10, 29, 29},
+        {40, 10, 59, 29},       /*10 px gap to the first*/
+    };
+    const lv_display_refr_stats_t * stats = refr_areas(areas, 2);
+    TEST_ASSERT_EQUAL_UINT32(2, stats->area_cnt);
+
+    /*The gap costs 200 px*/
+    lv_display_set_area_overhead(disp, 201);
+    stats = refr_areas(areas, 2);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(50 * 20, stats->px_rendered);
+}
+
+void test_refr_stats_overflow_keeps_clusters(void)
+{
+    /*Small areas in two distant corners, more than what fits into the invalidation buffer*/
+    lv_area_t areas[LV_INV_BUF_SIZE + 8];
+    uint32_t i;
+    for(i = 0; i < LV_INV_BUF_SIZE + 8; i++) {
+        int32_t x = (i % 2 ? DISP_HOR_RES - 50 : 0) + (i / 2) % 5 * 10;
+        int32_t y = (i % 2 ? DISP_VER_RES - 40 : 0) + (i / 2) / 5 * 10;
+        lv_area_set(&areas[i], x, y, x + 4, y + 4);
+    }
+    const lv_display_refr_stats_t * stats = refr_areas(areas, LV_INV_BUF_SIZE + 8);
+
+    /*Instead of the whole screen only the corners are redrawn*/
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_SIZE, stats->inv_area_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * 50 * 40, stats->px_rendered);
+}
+
+#endif
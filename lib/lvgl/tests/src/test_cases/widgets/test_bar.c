@@ -399,4 +399,173 @@ void test_bar_render_corner(void)
     render_test_screen_create(true, LV_GRAD_DIR_VER, "widgets/bar_corner_6.png");
 }
 
+static uint32_t draw_cnt;
+
+static void draw_cnt_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+static lv_obj_t * redraw_test_bar_create(int32_t rotation)
+{
+    /*The render tests leave a flex layout on the screen*/
+    lv_obj_clean(g_active_screen);
+    lv_obj_set_layout(g_active_screen, LV_LAYOUT_NONE);
+
+    lv_obj_t * bar = lv_bar_create(g_active_screen);
+    lv_obj_set_size(bar, 200, 20);
+    lv_obj_center(bar);
+    lv_obj_set_style_transform_pivot_x(bar, 100, 0);
+    lv_obj_set_style_transform_pivot_y(bar, 10, 0);
+    lv_obj_set_style_transform_rotation(bar, rotation, 0);
+    lv_bar_set_range(bar, 0, 255);
+    lv_bar_set_value(bar, 100, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    draw_cnt = 0;
+    lv_obj_add_event_cb(bar, draw_cnt_event_cb, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+    return bar;
+}
+
+/*Redraw the whole screen and check that the partial redraws have rendered the same*/
+static void assert_same_as_full_redraw(void)
+{
+    static uint8_t fb_copy[800 * 480 * 4];
+    lv_draw_buf_t * draw_buf = lv_display_get_buf_active(NULL);
+    uint32_t size = draw_buf->header.stride * draw_buf->header.h;
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(fb_copy), size);
+
+    lv_memcpy(fb_copy, draw_buf->data, size);
+    lv_obj_invalidate(g_active_screen);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(fb_copy, draw_buf->data, size);
+}
+
+void test_bar_unchanged_values_should_not_redraw(void)
+{
+    lv_obj_t * bar = redraw_test_bar_create(0);
+
+    lv_bar_set_range(bar, 0, 255);
+    lv_bar_set_value(bar, 100, LV_ANIM_ON);
+    lv_bar_set_value(bar, 100, LV_ANIM_OFF);
+    lv_bar_set_mode(bar, LV_BAR_MODE_NORMAL);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(0, draw_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_refr_stats(NULL)->inv_area_cnt);
+}
+
+void test_bar_reversed_range_should_redraw(void)
+{
+    lv_obj_t * bar = redraw_test_bar_create(0);
+
+    lv_bar_set_range(bar, 255, 0);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    assert_same_as_full_redraw();
+}
+
+static void value_change_should_redraw_only_the_delta(int32_t rotation)
+{
+    lv_obj_t * bar = redraw_test_bar_create(rotation);
+    uint32_t bar_size = lv_area_get_size(&bar->coords);
+
+    lv_bar_set_value(bar, 110, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(bar_size / 2, lv_display_get_refr_stats(NULL)->px_invalidated);
+    assert_same_as_full_redraw();
+
+    lv_bar_set_value(bar, 95, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_LESS_THAN_UINT32(bar_size / 2, lv_display_get_refr_stats(NULL)->px_invalidated);
+    assert_same_as_full_redraw();
+}
+
+void test_bar_value_change_should_redraw_only_the_delta(void)
+{
+    value_change_should_redraw_only_the_delta(0);
+}
+
+void test_bar_rotated_value_change_should_redraw_only_the_delta(void)
+{
+    value_change_should_redraw_only_the_delta(900);
+    value_change_should_redraw_only_the_delta(2700);
+}
+
+void test_bar_animation_should_redraw_only_the_delta(void)
+{
+    lv_obj_t * bar = redraw_test_bar_create(2700);
+    uint32_t bar_size = lv_area_get_size(&bar->coords);
+    lv_obj_set_style_anim_duration(bar, 200, 0);
+    lv_refr_now(NULL);
+
+    lv_bar_set_value(bar, 130, LV_ANIM_ON);
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_tick_inc(25);
+        lv_anim_refr_now();
+        lv_refr_now(NULL);
+        TEST_ASSERT_LESS_THAN_UINT32(bar_size / 2, lv_display_get_refr_stats(NULL)->px_invalidated);
+        assert_same_as_full_redraw();
+
+        /*Retarget the running animation*/
+        if(i == 3) lv_bar_set_value(bar, 30, LV_ANIM_ON);
+    }
+
+    TEST_ASSERT_EQUAL_INT32(30, lv_bar_get_value(bar));
+    assert_same_as_full_redraw();
+}
+
+/*Render the bar without the layer cache and check that the cached layer looked the same*/
+static void assert_same_as_not_cached(lv_obj_t * bar)
+{
+    static uint8_t fb_copy[800 * 480 * 4];
+    lv_draw_buf_t * draw_buf = lv_display_get_buf_active(NULL);
+    uint32_t size = draw_buf->header.stride * draw_buf->header.h;
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(fb_copy), size);
+
+    lv_memcpy(fb_copy, draw_buf->data, size);
+    lv_obj_set_layer_cache(bar, false);
+    lv_obj_invalidate(g_active_screen);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(fb_copy, draw_buf->data, size);
+
+    lv_obj_set_layer_cache(bar, true);
+    lv_refr_now(NULL);
+    draw_cnt = 0;
+}
+
+static void layer_cache_should_redraw_only_on_change(int32_t rotation)
+{
+    lv_obj_t * bar = redraw_test_bar_create(rotation);
+    lv_obj_set_layer_cache(bar, true);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lv_obj_get_layer_cache(bar));
+    assert_same_as_not_cached(bar);
+
+    /*Only the screen changes, the bar is blended from the cache*/
+    lv_obj_set_style_bg_color(g_active_screen, lv_palette_main(LV_PALETTE_GREY), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, draw_cnt);
+    assert_same_as_not_cached(bar);
+
+    lv_bar_set_value(bar, 110, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    assert_same_as_not_cached(bar);
+
+    lv_obj_remove_local_style_prop(g_active_screen, LV_STYLE_BG_COLOR, 0);
+}
+
+void test_bar_layer_cache_should_redraw_only_on_change(void)
+{
+    layer_cache_should_redraw_only_on_change(900);
+    layer_cache_should_redraw_only_on_change(1800);
+    layer_cache_should_redraw_only_on_change(2700);
+    layer_cache_should_redraw_only_on_change(300);
+}
+
 #endif
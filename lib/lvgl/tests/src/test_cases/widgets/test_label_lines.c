@@ -0,0 +1,183 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static const char * texts[] = {
+    "",
+    "\n",
+    "A",
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Cras malesuada ultrices magna in rutrum.",
+    "Lorem ipsum dolor sit amet,\nconsectetur adipiscing elit.\nCras malesuada ultrices magna in rutrum.\n",
+    "Windows\r\nline\r\nends\r\n",
+    "Loooooooooooooooooooooooooooooooooooooong word",
+};
+
+static lv_obj_t * label;
+
+void setUp(void)
+{
+    label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, 150);
+    lv_label_set_text(label, texts[3]);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void assert_lines_match_text(const lv_draw_label_lines_t * lines, const char * text, const lv_font_t * font,
+                                    int32_t letter_space, int32_t max_width, lv_text_flag_t flag)
+{
+    if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
+
+    uint32_t line_start = 0;
+    uint32_t i = 0;
+    while(text[line_start] != '\0') {
+        uint32_t line_end = line_start + _lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+        TEST_ASSERT_LESS_THAN_UINT32(lines->line_cnt, i);
+        TEST_ASSERT_EQUAL_UINT32(line_start, lines->lines[i].start);
+        TEST_ASSERT_EQUAL_INT32(lv_text_get_width(&text[line_start], line_end - line_start, font, letter_space),
+                                lines->lines[i].width);
+        line_start = line_end;
+        i++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(i, lines->line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(line_start, lines->lines[i].start);
+}
+
+void test_label_lines_should_match_the_text(void)
+{
+    static const int32_t widths[] = {LV_COORD_MAX, 150, 30, 1};
+    static const lv_text_flag_t flags[] = {LV_TEXT_FLAG_NONE, LV_TEXT_FLAG_EXPAND, LV_TEXT_FLAG_FIT};
+    lv_draw_label_lines_t lines;
+    lv_memzero(&lines, sizeof(lines));
+
+    uint32_t t, w, f;
+    for(t = 0; t < sizeof(texts) / sizeof(texts[0]); t++) {
+        for(w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+            for(f = 0; f < sizeof(flags) / sizeof(flags[0]); f++) {
+                TEST_ASSERT_TRUE(lv_draw_label_lines_update(&lines, texts[t], &lv_font_montserrat_14, 2, widths[w], flags[f]));
+                assert_lines_match_text(&lines, texts[t], &lv_font_montserrat_14, 2, widths[w], flags[f]);
+
+                lv_point_t size_ref;
+                lv_point_t size;
+                lv_text_get_size(&size_ref, texts[t], &lv_font_montserrat_14, 2, 5, widths[w], flags[f]);
+                lv_draw_label_lines_get_size(&lines, 5, &size);
+                TEST_ASSERT_EQUAL_INT32(size_ref.x, size.x);
+                TEST_ASSERT_EQUAL_INT32(size_ref.y, size.y);
+            }
+        }
+    }
+
+    lv_draw_label_lines_free(&lines);
+    TEST_ASSERT_NULL(lines.lines);
+}
+
+#if LV_LABEL_LINE_CACHE
+
+/*Mark the stored lines to see if they are calculated again*/
+static void mark_lines(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    TEST_ASSERT_NOT_NULL(l->lines.text);
+    l->lines.max_line_width = -1;
+}
+
+static bool lines_are_marked(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    return l->lines.max_line_width == -1;
+}
+
+void test_label_lines_should_be_reused_by_draw_and_hit_test(void)
+{
+    lv_refr_now(NULL);
+    mark_lines();
+
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+
+    lv_point_t pos;
+    lv_label_get_letter_pos(label, 60, &pos);
+    lv_point_t p = {20, 20};
+    lv_label_get_letter_on(label, &p, false);
+    lv_label_is_char_under_pos(label, &p);
+
+    TEST_ASSERT_TRUE(lines_are_marked());
+}
+
+void test_label_lines_should_be_recalculated_on_change(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+
+    lv_refr_now(NULL);
+    mark_lines();
+    lv_label_set_text(label, texts[4]);
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(lines_are_marked());
+    assert_lines_match_text(&l->lines, l->text, &lv_font_montserrat_14, 0, 150, LV_TEXT_FLAG_NONE);
+
+    mark_lines();
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_20, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(lines_are_marked());
+    assert_lines_match_text(&l->lines, l->text, &lv_font_montserrat_20, 0, 150, LV_TEXT_FLAG_NONE);
+
+    mark_lines();
+    lv_obj_set_width(label, 100);
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(lines_are_marked());
+    assert_lines_match_text(&l->lines, l->text, &lv_font_montserrat_20, 0, 100, LV_TEXT_FLAG_NONE);
+
+    mark_lines();
+    lv_obj_set_style_text_letter_space(label, 3, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(lines_are_marked());
+    assert_lines_match_text(&l->lines, l->text, &lv_font_montserrat_20, 3, 100, LV_TEXT_FLAG_NONE);
+}
+
+void test_label_lines_should_follow_in_place_edits(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    lv_refr_now(NULL);
+
+    lv_label_ins_text(label, 5, " sit amet sit amet");
+    lv_refr_now(NULL);
+    assert_lines_match_text(&l->lines, l->text, &lv_font_montserrat_14, 0, 150, LV_TEXT_FLAG_NONE);
+
+    lv_label_cut_text(label, 0, 40);
+    lv_refr_now(NULL);
+    assert_lines_match_text(&l->lines, l->text, &lv_font_montserrat_14, 0, 150, LV_TEXT_FLAG_NONE);
+
+    /*The text is shortened with dots in place*/
+    lv_obj_set_height(label, 40);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+    lv_refr_now(NULL);
+    assert_lines_match_text(&l->lines, l->text, &lv_font_montserrat_14, 0, 150, LV_TEXT_FLAG_NONE);
+
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_refr_now(NULL);
+    assert_lines_match_text(&l->lines, l->text, &lv_font_montserrat_14, 0, 150, LV_TEXT_FLAG_NONE);
+}
+
+void test_label_lines_scroll_mode_should_not_wrap(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    lv_label_set_long_mode(label, LV_LABEL_LONG_SCROLL_CIRCULAR);
+    lv_refr_now(NULL);
+    mark_lines();
+
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(lines_are_marked());
+
+    lv_label_set_text(label, texts[3]);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, l->lines.line_cnt);
+}
+
+#endif /*LV_LABEL_LINE_CACHE*/
+
+#endif
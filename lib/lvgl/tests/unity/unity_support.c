@@ -368,13 +368,15 @@ static void png_release(png_image_t * p)
 static void buf_to_xrgb8888(const uint8_t * buf_in, uint8_t * buf_out, lv_color_format_t cf_in)
 {
     uint32_t stride = lv_draw_buf_width_to_stride(800, cf_in);
-    if(cf_in == LV_COLOR_FORMAT_RGB565) {
+    if(cf_in == LV_COLOR_FORMAT_RGB565 || cf_in == LV_COLOR_FORMAT_RGB565_SWAPPED) {
         uint32_t y;
         for(y = 0; y < 480; y++) {
 
             uint32_t x;
             for(x = 0; x < 800; x++) {
-                const lv_color16_t * c16 = (const lv_color16_t *)&buf_in[x * 2];
+                uint16_t px = *(const uint16_t *)&buf_in[x * 2];
+                if(cf_in == LV_COLOR_FORMAT_RGB565_SWAPPED) px = lv_color_swap_16(px);
+                const lv_color16_t * c16 = (const lv_color16_t *)&px;
 
                 buf_out[x * 4 + 3] = 0xff;
                 buf_out[x * 4 + 2] = (c16->blue * 2106) >> 8;  /*To make it rounded*/
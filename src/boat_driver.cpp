@@ -3,6 +3,11 @@
 // ============================================================================
 #include <esp_now.h>
 #include <WiFi.h>
+#include <BoatControl.h>
+#include <BoatLog.h>
+#include <BoatLink.h>
+#include <LinkMonitor.h>
+#include <ControlMailbox.h>
 
 // ============================================================================
 // Definicje stałych i zmiennych globalnych
@@ -22,90 +27,108 @@ const int PWM_RESOLUTION = 8;      // Rozdzielczość PWM (8 bitów, wartości 0
 const int PWM_CHANNEL_ENA = 0;     // Kanał PWM dla pinu ENA
 const int PWM_CHANNEL_ENB = 1;     // Kanał PWM dla pinu ENB
 const int MIN_PWM = 50;            // Minimalna wartość PWM, aby silniki ruszyły
-const int SMOOTHING_STEP = 10;     // Maksymalna zmiana prędkości na iterację (soft start/end)
-const int UPDATE_INTERVAL = 80;    // Interwał aktualizacji prędkości w ms
+const int UPDATE_INTERVAL = 80;    // Okres pętli sterowania w ms
 
-// Struktura danych do odbierania przez ESP-NOW
-// Użyto atrybutu packed, aby zapewnić spójny rozmiar struktury
-typedef struct __attribute__((packed)) struct_message {
-    uint8_t up;     // Prędkość do przodu (0-255)
-    uint8_t down;   // Prędkość do tyłu (0-255)
-    uint8_t left;   // Skręt w lewo (0-255)
-    uint8_t right;  // Skręt w prawo (0-255)
-    bool trigger;   // Stan przycisku wyzwalającego (true/false)
-} struct_message;
+// Krzywe sterowania (MotorMixer)
+const int MOTOR_SLEW_RATE = 125;   // Maksymalna zmiana prędkości w jednostkach/s (soft start/end, 0 -> 255 w ok. 2 s)
+const int MOTOR_DEADBAND = 0;      // Martwa strefa osi (joystick ma już własną w kontrolerze)
+const int MOTOR_EXPO = 0;          // Krzywa expo w % (0 = liniowa)
 
-// Zmienna przechowująca odebrane dane
-struct_message receivedData;
+// Pomiar napięcia akumulatora (ADC1 - ADC2 jest zajęte przez Wi-Fi)
+const int BATTERY_PIN = 34;                // Wejście z dzielnika napięcia
+const uint32_t BATTERY_DIVIDER_RATIO = 4;  // Dzielnik 30k/10k - dopasować do układu
 
-// Bieżące prędkości silników dla mechanizmu soft start/end
-int currentSpeed1 = 0; // Bieżąca prędkość silnika lewego
-int currentSpeed2 = 0; // Bieżąca prędkość silnika prawego
+// Parametry zadania pętli sterowania (FreeRTOS)
+const uint32_t CONTROL_TASK_STACK = 4096; // Rozmiar stosu zadania w bajtach
+const UBaseType_t CONTROL_TASK_PRIORITY = 5; // Priorytet poniżej zadania Wi-Fi
+const BaseType_t CONTROL_TASK_CORE = 1;   // Rdzeń aplikacji (Wi-Fi pracuje na rdzeniu 0)
 
-// Oczekiwany rozmiar struktury danych (4 * uint8_t + 1 * bool = 5 bajtów)
-const size_t EXPECTED_SIZE = 5;
+// Ostatnia komenda z ESP-NOW przekazywana z callbacku do pętli sterowania
+ControlMailbox<struct_message> commandMailbox;
+
+// Kontrola kolejności i opóźnienia ramek (używana tylko w callbacku ESP-NOW)
+const uint32_t LINK_STALE_MS = 200;          // Maksymalne opóźnienie ramki ponad najlepsze zaobserwowane
+const uint32_t LINK_STATS_INTERVAL = 5000;   // Okres wypisywania statystyk łącza w ms
+LinkReceiver linkReceiver(LINK_STALE_MS);
+
+// Failsafe: po LINK_TIMEOUT_MS (BoatLink.h) bez poprawnej ramki silniki zwalniają do zera
+LinkMonitor linkMonitor(LINK_TIMEOUT_MS);
+
+// Telemetria do kontrolera: jedna ramka co LINK_TELEMETRY_SAMPLES okresów (400 ms)
+LinkTelemetryBatch telemetryBatch;
+uint16_t telemetrySeq = 0;
+uint8_t controllerAddress[6];            // Adres kontrolera z pierwszej przyjętej ramki
+std::atomic<bool> controllerKnown(false);
+bool controllerPeerAdded = false;
+
+/**
+ * Parametry miksera silników na podstawie stałych konfiguracyjnych
+ * @return Konfiguracja dla BoatControl
+ */
+MotorMixerConfig motorMixerConfig() {
+    MotorMixerConfig config;
+    config.deadband = MOTOR_DEADBAND;
+    config.expo = MOTOR_EXPO;
+    config.slewRate = MOTOR_SLEW_RATE;
+    config.periodMs = UPDATE_INTERVAL;
+    config.minPwm = MIN_PWM;
+    return config;
+}
+
+// Mieszanie i wygładzanie prędkości (soft start/end), wywoływane co UPDATE_INTERVAL
+BoatControl boatControl(motorMixerConfig());
 
 // ============================================================================
 // Funkcje debugujące
 // ============================================================================
 
 /**
- * Wyświetla rozmiar struktury danych (aktywne w trybie DEBUG)
+ * Wyświetla rozmiary ramek protokołu (aktywne w trybie DEBUG)
  */
 #ifdef DEBUG
 void debugStructSize() {
-    Serial.print("Rozmiar struktury struct_message: ");
-    Serial.println(sizeof(struct_message));
-    Serial.print("Oczekiwany rozmiar: ");
-    Serial.println(EXPECTED_SIZE);
+    Serial.print("Wersja protokołu: ");
+    Serial.println(LINK_VERSION);
+    Serial.print("Rozmiar ramki CONTROL: ");
+    Serial.println(LINK_CONTROL_FRAME_SIZE);
+    Serial.print("Rozmiar ramki KEEPALIVE: ");
+    Serial.println(LINK_KEEPALIVE_FRAME_SIZE);
 }
 #endif
 
+/**
+ * Wyświetla liczniki jakości łącza
+ * @param stats Liczniki z odbiornika ramek
+ * @param link Statystyki nadzoru łącza
+ */
+void debugLinkStats(const LinkCounters& stats, const LinkStats& link) {
+    BOAT_LOG_INFO("Łącze: przyjęte = %lu, utracone = %lu, przestawione = %lu, spóźnione = %lu, bez komendy = %lu, restarty = %lu",
+                  (unsigned long)stats.accepted, (unsigned long)stats.dropped, (unsigned long)stats.reordered,
+                  (unsigned long)stats.stale, (unsigned long)stats.desynced, (unsigned long)stats.resyncs);
+    BOAT_LOG_INFO("Łącze: pakiety/s = %lu, ostatni pakiet = %lu ms, najdłuższa przerwa = %lu ms",
+                  (unsigned long)link.packetRate, (unsigned long)link.lastSeenAgeMs, (unsigned long)link.longestGapMs);
+    const uint32_t* gaps = link.gapHistogram;
+    BOAT_LOG_INFO("Łącze: przerwy <50/<100/<200/<500/<1000/>=1000 ms = %lu/%lu/%lu/%lu/%lu/%lu",
+                  (unsigned long)gaps[0], (unsigned long)gaps[1], (unsigned long)gaps[2],
+                  (unsigned long)gaps[3], (unsigned long)gaps[4], (unsigned long)gaps[5]);
+}
+
 /**
  * Wyświetla wartości prędkości dla debugowania
- * @param baseSpeed Prędkość bazowa
- * @param turnAdjust Korekta skrętu
  * @param targetSpeed1 Docelowa prędkość silnika lewego
  * @param currentSpeed1 Bieżąca prędkość silnika lewego
  * @param targetSpeed2 Docelowa prędkość silnika prawego
  * @param currentSpeed2 Bieżąca prędkość silnika prawego
  */
-void debugMotorSpeeds(int baseSpeed, int turnAdjust, int targetSpeed1, int currentSpeed1, int targetSpeed2, int currentSpeed2) {
-    Serial.print("baseSpeed: ");
-    Serial.print(baseSpeed);
-    Serial.print(", turnAdjust: ");
-    Serial.print(turnAdjust);
-    Serial.print(", targetSpeed1: ");
-    Serial.print(targetSpeed1);
-    Serial.print(", currentSpeed1: ");
-    Serial.print(currentSpeed1);
-    Serial.print(", targetSpeed2: ");
-    Serial.print(targetSpeed2);
-    Serial.print(", currentSpeed2: ");
-    Serial.println(currentSpeed2);
+void debugMotorSpeeds(int targetSpeed1, int currentSpeed1, int targetSpeed2, int currentSpeed2) {
+    BOAT_LOG_TRACE("targetSpeed1: %d, currentSpeed1: %d, targetSpeed2: %d, currentSpeed2: %d",
+                   targetSpeed1, currentSpeed1, targetSpeed2, currentSpeed2);
 }
 
 // ============================================================================
 // Funkcje sterowania silnikami
 // ============================================================================
 
-/**
- * Wygładza prędkość silnika (soft start/end)
- * @param currentSpeed Bieżąca prędkość silnika
- * @param targetSpeed Docelowa prędkość silnika
- * @return Zaktualizowana prędkość po kroku wygładzania
- */
-int smoothSpeed(int currentSpeed, int targetSpeed) {
-    if (currentSpeed < targetSpeed) {
-        // Soft start: zwiększ prędkość o maksymalnie SMOOTHING_STEP
-        return min(currentSpeed + SMOOTHING_STEP, targetSpeed);
-    } else if (currentSpeed > targetSpeed) {
-        // Soft end: zmniejsz prędkość o maksymalnie SMOOTHING_STEP
-        return max(currentSpeed - SMOOTHING_STEP, targetSpeed);
-    }
-    return currentSpeed;
-}
-
 /**
  * Ustawia prędkość i kierunek dla silnika
  * @param channel Kanał PWM (ENA lub ENB)
@@ -114,11 +137,8 @@ int smoothSpeed(int currentSpeed, int targetSpeed) {
  * @param speed Prędkość silnika (-255 do 255)
  */
 void setMotor(int channel, int in1, int in2, int speed) {
-    // Skalowanie prędkości z uwzględnieniem minimalnego progu PWM
-    int absSpeed = abs(speed);
-    if (absSpeed > 0) {
-        absSpeed = map(absSpeed, 0, 255, MIN_PWM, 255); // Skalowanie od MIN_PWM do 255
-    }
+    // Skalowanie prędkości od MIN_PWM do 255 (tablica liczona raz w mikserze)
+    int pwm = boatControl.mixer().pwm(speed);
 
     // Ustawienie kierunku silnika
     if (speed > 0) {
@@ -133,7 +153,7 @@ void setMotor(int channel, int in1, int in2, int speed) {
     }
 
     // Ustawienie prędkości przez PWM
-    ledcWrite(channel, absSpeed);
+    ledcWrite(channel, pwm);
 }
 
 // ============================================================================
@@ -141,72 +161,158 @@ void setMotor(int channel, int in1, int in2, int speed) {
 // ============================================================================
 
 /**
- * Przetwarza odebrane dane i steruje silnikami
+ * Callback wywoływany po odebraniu danych przez ESP-NOW
+ * Działa w zadaniu Wi-Fi, więc jedynie publikuje komendę dla pętli sterowania
+ * @param mac_addr Adres MAC nadajnika
+ * @param data Wskaźnik na odebrane dane
+ * @param len Długość odebranych danych
+ */
+void OnDataRecv(const uint8_t* mac_addr, const uint8_t* data, int len) {
+    // Sprawdzenie wersji, długości i sumy kontrolnej ramki
+    LinkFrame frame;
+    LinkDecodeResult result = linkDecode(data, len, frame);
+    if (result != LINK_OK) {
+        BOAT_LOG_WARN("Odrzucono ramkę (kod %d), długość: %d", (int)result, len);
+        return;
+    }
+
+    // Ramki powtórzone, przestawione i spóźnione nie świadczą o działającym łączu
+    LinkVerdict verdict = linkReceiver.accept(frame, millis());
+    if (verdict == LINK_DUPLICATE || verdict == LINK_STALE) return;
+
+    // LINK_DESYNC (KEEPALIVE po utraconej ramce CONTROL) też potwierdza łącze - do
+    // odświeżenia pełnej ramki obowiązuje poprzednia komenda, failsafe się nie włącza
+    linkMonitor.notePacket(millis());
+
+    // Zapamiętanie adresu kontrolera dla telemetrii (dodawany w zadaniu sterowania)
+    if (!controllerKnown.load(std::memory_order_relaxed)) {
+        memcpy(controllerAddress, mac_addr, sizeof(controllerAddress));
+        controllerKnown.store(true, std::memory_order_release);
+    }
+
+    // KEEPALIVE potwierdza bieżącą komendę - nie ma czego przekazywać
+    if (verdict == LINK_ACCEPTED && frame.type == LINK_FRAME_CONTROL) {
+        commandMailbox.push(frame.command);
+    }
+}
+
+// ============================================================================
+// Pętla sterowania
+// ============================================================================
+
+/**
+ * Wyświetla odebrane dane w monitorze szeregowym
  * @param msg Odebrana struktura danych z wartościami up, down, left, right, trigger
  */
-void handleReceivedData(const struct_message& msg) {
-    // Wyświetlanie odebranych danych w monitorze szeregowym
-    Serial.print("Odebrano: up = ");
-    Serial.print(msg.up);
-    Serial.print(", down = ");
-    Serial.print(msg.down);
-    Serial.print(", left = ");
-    Serial.print(msg.left);
-    Serial.print(", right = ");
-    Serial.print(msg.right);
-    Serial.print(", trigger = ");
-    Serial.println(msg.trigger ? "true" : "false");
-
-    if (msg.trigger) {
-        // Zatrzymanie silników, gdy trigger jest aktywny
-        currentSpeed1 = 0;
-        currentSpeed2 = 0;
-        setMotor(PWM_CHANNEL_ENA, IN1_PIN, IN2_PIN, currentSpeed1);
-        setMotor(PWM_CHANNEL_ENB, IN3_PIN, IN4_PIN, currentSpeed2);
-    } else {
-        // Obliczenie prędkości bazowej (różnica między ruchem do przodu a do tyłu)
-        int baseSpeed = msg.up - msg.down;
-        baseSpeed = constrain(baseSpeed, -255, 255); // Ograniczenie do zakresu -255 do 255
-
-        // Obliczenie korekty skrętu (różnica między right a left)
-        int turnAdjust = ((int)msg.right - (int)msg.left) / 2;
-        turnAdjust = constrain(turnAdjust, -255, 255); // Ograniczenie do zakresu -255 do 255
-
-        // Obliczenie docelowych prędkości dla silników
-        int targetSpeed1 = baseSpeed + turnAdjust; // Silnik lewy
-        targetSpeed1 = constrain(targetSpeed1, -255, 255);
-        int targetSpeed2 = baseSpeed - turnAdjust; // Silnik prawy
-        targetSpeed2 = constrain(targetSpeed2, -255, 255);
-
-        // Wygładzanie prędkości dla soft start/end
-        currentSpeed1 = smoothSpeed(currentSpeed1, targetSpeed1);
-        currentSpeed2 = smoothSpeed(currentSpeed2, targetSpeed2);
-
-        // Ustawienie prędkości i kierunku dla silników
-        setMotor(PWM_CHANNEL_ENA, IN1_PIN, IN2_PIN, currentSpeed1);
-        setMotor(PWM_CHANNEL_ENB, IN3_PIN, IN4_PIN, currentSpeed2);
-
-        // Debugowanie prędkości silników
-        debugMotorSpeeds(baseSpeed, turnAdjust, targetSpeed1, currentSpeed1, targetSpeed2, currentSpeed2);
+void printReceivedData(const struct_message& msg) {
+    BOAT_LOG_TRACE("Odebrano: up = %u, down = %u, left = %u, right = %u, trigger = %s",
+                   msg.up, msg.down, msg.left, msg.right, msg.trigger ? "true" : "false");
+}
+
+/**
+ * Odczytuje napięcie akumulatora
+ * @return Napięcie w mV
+ */
+uint16_t readBatteryMillivolts() {
+    return (uint16_t)(analogReadMilliVolts(BATTERY_PIN) * BATTERY_DIVIDER_RATIO);
+}
+
+/**
+ * Wysyła zebraną paczkę telemetrii do kontrolera
+ * @param telemetry Paczka z LINK_TELEMETRY_SAMPLES okresów
+ */
+void sendTelemetry(LinkTelemetry& telemetry) {
+    if (!controllerKnown.load(std::memory_order_acquire)) return;
+    if (!controllerPeerAdded) {
+        esp_now_peer_info_t peerInfo = {};
+        memcpy(peerInfo.peer_addr, controllerAddress, sizeof(controllerAddress));
+        peerInfo.channel = 0;
+        peerInfo.encrypt = false;
+        if (esp_now_add_peer(&peerInfo) != ESP_OK) {
+            BOAT_LOG_ERROR("Błąd dodawania kontrolera do ESP-NOW");
+            return;
+        }
+        controllerPeerAdded = true;
     }
+
+    // Uzupełnienie paczki stanem łącza i akumulatora
+    const LinkCounters& counters = linkReceiver.stats();
+    telemetry.accepted = counters.accepted;
+    telemetry.dropped = counters.dropped;
+    telemetry.stale = counters.stale;
+    telemetry.flags = boatControl.linkLost() ? LINK_TELEMETRY_FAILSAFE : 0;
+    telemetry.batteryMv = readBatteryMillivolts();
+
+    uint8_t frame[LINK_TELEMETRY_FRAME_SIZE];
+    size_t len = linkEncodeTelemetry(frame, telemetrySeq++, millis(), telemetry);
+    esp_now_send(controllerAddress, frame, len);
 }
 
+// Stan pętli sterowania przenoszony między okresami
+uint32_t periodsSinceStats = 0; // Okresy od ostatnich statystyk łącza
+uint32_t lastWakeUs = 0;        // Początek poprzedniego okresu (telemetria)
+
 /**
- * Callback wywoływany po odebraniu danych przez ESP-NOW
- * @param mac_addr Adres MAC nadajnika
- * @param data Wskaźnik na odebrane dane
- * @param len Długość odebranych danych
+ * Jeden okres pętli sterowania
+ * Pobiera najnowszą komendę, wygładza prędkości i ustawia PWM silników,
+ * dzięki czemu tempo soft start/end nie zależy od odstępów między pakietami.
+ * Pilnuje też łącza: bez pakietów przez LINK_TIMEOUT_MS włącza failsafe.
  */
-void OnDataRecv(const uint8_t* mac_addr, const uint8_t* data, int len) {
-    // Sprawdzenie zgodności rozmiaru odebranych danych
-    if (len == sizeof(struct_message)) {
-        memcpy(&receivedData, data, sizeof(receivedData));
-        handleReceivedData(receivedData);
-    } else {
-        Serial.print("Błąd: Niezgodność rozmiaru danych. Oczekiwano: ");
-        Serial.print(sizeof(struct_message));
-        Serial.print(", Odebrano: ");
-        Serial.println(len);
+void controlStep() {
+    uint32_t wakeUs = micros();
+    struct_message msg;
+    if (commandMailbox.take(msg)) {
+        printReceivedData(msg);
+        boatControl.setCommand(msg);
+    }
+
+    // Watchdog utraty łącza
+    bool lost = linkMonitor.isLost(millis());
+    if (lost != boatControl.linkLost()) {
+        if (lost) {
+            BOAT_LOG_WARN("Failsafe: brak łącza, zatrzymywanie silników");
+        } else {
+            BOAT_LOG_INFO("Failsafe: łącze przywrócone");
+        }
+        boatControl.setLinkLost(lost);
+    }
+
+    int previousSpeed1 = boatControl.currentSpeed1();
+    int previousSpeed2 = boatControl.currentSpeed2();
+    MotorSpeeds speeds = boatControl.step();
+
+    // Ustawienie prędkości i kierunku dla silników
+    setMotor(PWM_CHANNEL_ENA, IN1_PIN, IN2_PIN, speeds.currentSpeed1);
+    setMotor(PWM_CHANNEL_ENB, IN3_PIN, IN4_PIN, speeds.currentSpeed2);
+
+    // Debugowanie prędkości silników tylko podczas rampy
+    if (speeds.currentSpeed1 != previousSpeed1 || speeds.currentSpeed2 != previousSpeed2) {
+        debugMotorSpeeds(speeds.targetSpeed1, speeds.currentSpeed1, speeds.targetSpeed2, speeds.currentSpeed2);
+    }
+
+    // Telemetria: czas wykonania pętli bez samej wysyłki
+    if (telemetryBatch.add(speeds.targetSpeed1, speeds.targetSpeed2, speeds.currentSpeed1, speeds.currentSpeed2,
+                           micros() - wakeUs, wakeUs - lastWakeUs)) {
+        sendTelemetry(telemetryBatch.telemetry());
+    }
+    lastWakeUs = wakeUs;
+
+    // Okresowe statystyki łącza
+    if (++periodsSinceStats * UPDATE_INTERVAL >= LINK_STATS_INTERVAL) {
+        periodsSinceStats = 0;
+        debugLinkStats(linkReceiver.stats(), linkMonitor.stats(millis()));
+    }
+}
+
+/**
+ * Zadanie pętli sterowania o stałym okresie UPDATE_INTERVAL
+ */
+void controlTask(void*) {
+    TickType_t lastWake = xTaskGetTickCount();
+    lastWakeUs = micros();
+    for (;;) {
+        controlStep();
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(UPDATE_INTERVAL));
     }
 }
 
@@ -218,8 +324,9 @@ void OnDataRecv(const uint8_t* mac_addr, const uint8_t* data, int len) {
  * Inicjalizacja programu
  */
 void setup() {
-    // Inicjalizacja komunikacji szeregowej
+    // Inicjalizacja komunikacji szeregowej i zadania wypisującego logi
     Serial.begin(115200);
+    boatLogBegin(Serial);
 
     // Konfiguracja pinów sterownika DRI0041 jako wyjścia
     pinMode(IN1_PIN, OUTPUT);
@@ -227,6 +334,9 @@ void setup() {
     pinMode(IN3_PIN, OUTPUT);
     pinMode(IN4_PIN, OUTPUT);
 
+    // Wejście pomiaru napięcia akumulatora
+    pinMode(BATTERY_PIN, INPUT);
+
     // Konfiguracja kanałów PWM dla pinów ENA i ENB
     ledcSetup(PWM_CHANNEL_ENA, PWM_FREQ, PWM_RESOLUTION);
     ledcSetup(PWM_CHANNEL_ENB, PWM_FREQ, PWM_RESOLUTION);
@@ -242,6 +352,10 @@ void setup() {
         while (1); // Zatrzymanie programu w przypadku błędu
     }
 
+    // Uruchomienie pętli sterowania przed rejestracją callbacku odbioru
+    xTaskCreatePinnedToCore(controlTask, "control", CONTROL_TASK_STACK, nullptr,
+                            CONTROL_TASK_PRIORITY, nullptr, CONTROL_TASK_CORE);
+
     // Rejestracja callbacku dla odbierania danych
     esp_now_register_recv_cb(OnDataRecv);
 
@@ -251,13 +365,13 @@ void setup() {
     #endif
 
     // Potwierdzenie gotowości odbiornika
-    Serial.println("Odbiornik gotowy");
+    BOAT_LOG_INFO("Odbiornik gotowy");
 }
 
 /**
  * Główna pętla programu
  */
 void loop() {
-    // Opóźnienie dla stabilności i aktualizacji wygładzania prędkości
+    // Sterowanie odbywa się w controlTask - pętla Arduino jedynie oddaje czas procesora
     delay(UPDATE_INTERVAL);
 }
\ No newline at end of file
@@ -6,12 +6,17 @@
 #include <ui_helpers.h>
 #include <Arduino.h>
 #include <TFT_eSPI.h>
-#include <XPT2046_Touchscreen.h>
 #include <SPI.h>
 #include <Wire.h>
 #include <NintendoExtensionCtrl.h>
 #include <esp_now.h>
 #include <WiFi.h>
+#include <BoatLink.h>
+#include <BoatLog.h>
+#include <ControlMailbox.h>
+#include <DisplayFlush.h>
+#include <TouchSampler.h>
+#include <TouchCalibration.h>
 #include "lvgl.h"
 
 // ============================================================================
@@ -20,7 +25,8 @@
 static const uint16_t SCREEN_WIDTH  = 320;    // Szerokość ekranu TFT
 static const uint16_t SCREEN_HEIGHT = 240;    // Wysokość ekranu TFT
 static const uint16_t SCREENBUFFER_SIZE_PIXELS = SCREEN_WIDTH * SCREEN_HEIGHT / 10; // Bufor LVGL (1/10 ekranu)
-static lv_color_t screen_buffer[SCREENBUFFER_SIZE_PIXELS]; // Bufor ekranu dla LVGL
+static uint16_t screen_buffer_1[SCREENBUFFER_SIZE_PIXELS]; // Bufory RGB565 dla LVGL: jeden rysowany,
+static uint16_t screen_buffer_2[SCREENBUFFER_SIZE_PIXELS]; // drugi wysyłany przez DMA
 
 const int JOY_MIN_X = 0, JOY_MAX_X = 255, JOY_MIN_Y = 0, JOY_MAX_Y = 255; // Zakresy joysticka
 const int JOY_DEADZONE_LOW = 1, JOY_DEADZONE_HIGH = 1; // Martwa strefa joysticka
@@ -28,34 +34,73 @@ const int JOY_CENTER = 128; // Środek zakresu joysticka
 
 static int progress_value = 0; // Postęp ładowania
 static bool is_loading = true, was_connected = false; // Statusy ładowania i połączenia
-static int joy_x = 0, joy_y = 0; // Odczyty joysticka
-static bool trigger = false; // Stan przycisku Z
 static lv_obj_t* popup = nullptr; // Popup na ekranie
 
-static lv_timer_t *bar_timer = nullptr, *connection_timer = nullptr; // Timery LVGL
+static lv_timer_t *bar_timer = nullptr, *input_timer = nullptr, *telemetry_timer = nullptr; // Timery LVGL
 
-// Struktura do przesyłania danych przez ESP-NOW
-typedef struct __attribute__((packed)) {
+// Zadanie odczytu Nunchuka i wysyłki ESP-NOW (FreeRTOS), niezależne od renderowania LVGL
+static const uint32_t INPUT_PERIOD_MS = 40;        // Okres próbkowania joysticka (25 Hz)
+static const uint32_t INPUT_TASK_STACK = 4096;     // Rozmiar stosu zadania w bajtach
+static const UBaseType_t INPUT_TASK_PRIORITY = 2;  // Powyżej pętli Arduino (LVGL)
+static const BaseType_t INPUT_TASK_CORE = 1;       // Rdzeń aplikacji
+static const UBaseType_t TOUCH_TASK_PRIORITY = 3;  // Krótkie paczki SPI, przed odczytem Nunchuka
+
+// Próbka wejścia publikowana przez zadanie odczytu dla interfejsu
+typedef struct {
     uint8_t up;
     uint8_t down;
     uint8_t left;
     uint8_t right;
     bool trigger;
-} struct_message;
+    bool connected;
+} input_sample_t;
+
+static ControlMailbox<input_sample_t> input_mailbox; // Ostatnia próbka dla wątku LVGL
+
+// Wartości dla interfejsu (obserwatory LVGL aktualizują paski i ekrany)
+static lv_subject_t speed_up_subject, speed_down_subject, speed_left_subject, speed_right_subject;
+static lv_subject_t trigger_subject, connected_subject;
 
-struct_message data; // Dane do wysyłki
+// Nadawca ramek ESP-NOW: komenda przy zmianie, KEEPALIVE co 100 ms, pełna ramka co 200 ms
+static LinkSender link_sender(LINK_KEEPALIVE_MS, LINK_REFRESH_MS);
 uint8_t receiverAddress[] = {0xA8, 0x48, 0xFA, 0x6B, 0xB4, 0xAC}; // Adres odbiorcy ESP-NOW
 
+// Telemetria z łodzi (callback ESP-NOW -> wątek LVGL)
+static const uint32_t TELEMETRY_TIMEOUT_MS = 2000;  // Brak telemetrii dłużej = "N/A"
+static const uint16_t TELEMETRY_CHART_POINTS = 60;  // Historia wykresu (60 okresów = 4.8 s)
+static LinkReceiver telemetry_receiver(500);
+static ControlMailbox<LinkTelemetry> telemetry_mailbox;
+static uint32_t last_telemetry_ms = 0;
+static bool has_telemetry = false;
+static lv_obj_t *telemetry_chart = nullptr, *telemetry_label = nullptr;
+static lv_chart_series_t *speed1_series = nullptr, *speed2_series = nullptr;
+
 // Obiekty sprzętowe
 TFT_eSPI tft = TFT_eSPI(SCREEN_WIDTH, SCREEN_HEIGHT); // Ekran TFT
+DisplayFlush display_flush(tft); // Wysyłka pasków LVGL przez DMA
 #define TOUCH_IRQ_PIN  36
 #define TOUCH_MOSI_PIN 32
 #define TOUCH_MISO_PIN 39
 #define TOUCH_CLK_PIN  25
 #define TOUCH_CS_PIN   33
 SPIClass touch_spi(VSPI); // SPI dla dotyku
-XPT2046_Touchscreen touch_screen(TOUCH_CS_PIN, TOUCH_IRQ_PIN); // Sterownik dotyku
-uint16_t touch_min_x = 400, touch_max_x = 3600, touch_min_y = 300, touch_max_y = 3700; // Kalibracja dotyku
+TouchSampler touch_sampler(touch_spi, TOUCH_CS_PIN, TOUCH_IRQ_PIN); // Próbkowanie dotyku w tle (XPT2046)
+static lv_indev_t* touch_input = nullptr; // Wskaźnik LVGL w trybie zdarzeń
+TouchCalibration touch_calibration; // Surowy odczyt -> piksele (zapisana w NVS)
+
+// Kalibracja z trzech celów (10% od krawędzi, nie na jednej prostej)
+static const TouchPoint CALIBRATION_TARGETS[3] = {
+    {SCREEN_WIDTH / 10, SCREEN_HEIGHT / 10},
+    {SCREEN_WIDTH * 9 / 10, SCREEN_HEIGHT / 2},
+    {SCREEN_WIDTH / 2, SCREEN_HEIGHT * 9 / 10},
+};
+// Odczyty tych celów przy dawnym zakresie 400-3600 i 300-3700 - do czasu pierwszej kalibracji
+static const TouchPoint DEFAULT_CALIBRATION_RAW[3] = {{711, 627}, {3279, 1993}, {1995, 3359}};
+static const uint16_t CALIBRATION_TARGET_SIZE = 20;
+static int calibration_step = -1;          // Numer celu (0-2) lub -1, gdy kalibracja nie trwa
+static TouchPoint calibration_raw[3];      // Uśrednione odczyty kolejnych celów
+static int32_t calibration_sum_x = 0, calibration_sum_y = 0, calibration_count = 0;
+static lv_obj_t *calibration_screen = nullptr, *calibration_target = nullptr;
 
 #define NUNCHUK_SDA_PIN 22
 #define NUNCHUK_SCL_PIN 27
@@ -65,39 +110,107 @@ Nunchuk nunchuk; // Kontroler Nunchuk
 // Funkcje pomocnicze LVGL
 // ============================================================================
 
-// Funkcja logowania LVGL do Serial
-void log_print(lv_log_level_t, const char* buf) {
-    Serial.println(buf);
-    Serial.flush();
+// Funkcja logowania LVGL do bufora logów (poziomy LVGL mają tę samą numerację)
+void log_print(lv_log_level_t level, const char* buf) {
+    boatLogWrite(level < BOAT_LOG_LEVEL_COUNT ? level : BOAT_LOG_LEVEL_INFO, "%s", buf);
+}
+
+// ============================================================================
+// Kalibracja dotyku
+// ============================================================================
+
+// Pokazuje cel calibration_step na ekranie kalibracji
+static void show_calibration_target() {
+    const TouchPoint& target = CALIBRATION_TARGETS[calibration_step];
+    lv_obj_set_pos(calibration_target, target.x - CALIBRATION_TARGET_SIZE / 2, target.y - CALIBRATION_TARGET_SIZE / 2);
+    calibration_sum_x = calibration_sum_y = calibration_count = 0;
 }
 
-// Funkcja odświeżania ekranu LVGL (flush)
-void my_display_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* pixelmap) {
-    uint32_t width  = area->x2 - area->x1 + 1;
-    uint32_t height = area->y2 - area->y1 + 1;
-    tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, width, height);
-    tft.pushColors((uint16_t*)pixelmap, width * height, true);
-    tft.endWrite();
-    lv_disp_flush_ready(disp);
+// Ekran z celami na warstwie nad interfejsem; dotyk trafia tylko do kalibracji
+void start_touch_calibration() {
+    if (calibration_screen == nullptr) {
+        calibration_screen = lv_obj_create(lv_layer_top());
+        lv_obj_remove_style_all(calibration_screen);
+        lv_obj_set_size(calibration_screen, SCREEN_WIDTH, SCREEN_HEIGHT);
+        lv_obj_set_style_bg_color(calibration_screen, lv_color_hex(0x000000), LV_PART_MAIN);
+        lv_obj_set_style_bg_opa(calibration_screen, LV_OPA_COVER, LV_PART_MAIN);
+
+        lv_obj_t* label = lv_label_create(calibration_screen);
+        lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+        lv_label_set_text(label, "Touch the targets");
+        lv_obj_center(label);
+
+        calibration_target = lv_obj_create(calibration_screen);
+        lv_obj_remove_style_all(calibration_target);
+        lv_obj_set_size(calibration_target, CALIBRATION_TARGET_SIZE, CALIBRATION_TARGET_SIZE);
+        lv_obj_set_style_radius(calibration_target, LV_RADIUS_CIRCLE, LV_PART_MAIN);
+        lv_obj_set_style_border_color(calibration_target, lv_color_hex(0xE90000), LV_PART_MAIN);
+        lv_obj_set_style_border_width(calibration_target, 3, LV_PART_MAIN);
+    }
+    calibration_step = 0;
+    show_calibration_target();
 }
 
-// Odczyt dotyku dla LVGL
-void my_touch_read(lv_indev_t*, lv_indev_data_t* data) {
-    if (touch_screen.touched()) {
-        TS_Point point = touch_screen.getPoint();
-        touch_min_x = min(touch_min_x, (uint16_t)point.x);
-        touch_max_x = max(touch_max_x, (uint16_t)point.x);
-        touch_min_y = min(touch_min_y, (uint16_t)point.y);
-        touch_max_y = max(touch_max_y, (uint16_t)point.y);
-        data->point.x = map(point.x, touch_min_x, touch_max_x, 1, SCREEN_WIDTH);
-        data->point.y = map(point.y, touch_min_y, touch_max_y, 1, SCREEN_HEIGHT);
+// Zbiera odczyty celu; puszczenie zamyka cel, po trzecim liczy i zapisuje kalibrację
+static void calibration_touch(const TouchEvent& event) {
+    if (event.pressed) {
+        calibration_sum_x += event.x;
+        calibration_sum_y += event.y;
+        calibration_count++;
+        return;
+    }
+    if (calibration_count == 0) return;
+    calibration_raw[calibration_step] = {calibration_sum_x / calibration_count, calibration_sum_y / calibration_count};
+    if (++calibration_step < 3) {
+        show_calibration_target();
+        return;
+    }
+
+    TouchCalibration calibration;
+    if (!calibration.compute(CALIBRATION_TARGETS, calibration_raw, SCREEN_WIDTH, SCREEN_HEIGHT)) {
+        BOAT_LOG_WARN("Touch calibration failed, try again");
+        calibration_step = 0;
+        show_calibration_target();
+        return;
+    }
+    touch_calibration = calibration;
+    if (!touch_calibration.save()) BOAT_LOG_WARN("Failed to save touch calibration");
+    BOAT_LOG_INFO("Touch calibration saved");
+    calibration_step = -1;
+    lv_obj_delete_async(calibration_screen); // Wywołanie z odczytu wskaźnika - usunięcie po jego zakończeniu
+    calibration_screen = calibration_target = nullptr;
+}
+
+// Odczyt dotyku dla LVGL: jedno zdarzenie z kolejki zadania próbkowania (bez SPI)
+void my_touch_read(lv_indev_t* indev, lv_indev_data_t* data) {
+    TouchEvent point;
+    if (!touch_sampler.read(point)) {
+        data->state = lv_indev_get_state(indev); // Brak nowych zdarzeń - stan bez zmian
+        return;
+    }
+    if (calibration_step >= 0) {
+        calibration_touch(point); // Interfejs nie dostaje dotyku w trakcie kalibracji
+        data->state = LV_INDEV_STATE_REL;
+        return;
+    }
+    if (point.pressed) {
+        int32_t x, y;
+        touch_calibration.apply(point.x, point.y, x, y);
+        data->point.x = x;
+        data->point.y = y;
         data->state = LV_INDEV_STATE_PR;
     } else {
         data->state = LV_INDEV_STATE_REL;
     }
 }
 
+// Przekazuje zdarzenia dotyku do LVGL zaraz po ich pojawieniu się, a nie co okres odświeżania
+static void process_touch_events() {
+    for (size_t i = 0; i < TouchSampler::QUEUE_SIZE && touch_sampler.available(); i++) {
+        lv_indev_read(touch_input); // Gdy wejście jest wyłączone, zdarzenie czeka w kolejce
+    }
+}
+
 // Funkcja zwracająca tick dla LVGL
 static uint32_t my_tick_get_cb(void) {
     return millis();
@@ -109,8 +222,19 @@ static uint32_t my_tick_get_cb(void) {
 
 // Callback po wysłaniu pakietu ESP-NOW
 void OnDataSent(const uint8_t*, esp_now_send_status_t status) {
-    Serial.print("Last Packet Send Status: ");
-    Serial.println(status == ESP_NOW_SEND_SUCCESS ? "Delivery Success" : "Delivery Fail");
+    if (status == ESP_NOW_SEND_SUCCESS) {
+        BOAT_LOG_TRACE("Last Packet Send Status: Delivery Success");
+    } else {
+        BOAT_LOG_WARN("Last Packet Send Status: Delivery Fail");
+    }
+}
+
+// Callback odbioru telemetrii z łodzi
+void OnDataRecv(const uint8_t*, const uint8_t* data, int len) {
+    LinkFrame frame;
+    if (linkDecode(data, len, frame) != LINK_OK || frame.type != LINK_FRAME_TELEMETRY) return;
+    if (telemetry_receiver.accept(frame, millis()) != LINK_ACCEPTED) return;
+    telemetry_mailbox.push(frame.telemetry);
 }
 
 // ============================================================================
@@ -126,100 +250,44 @@ static void loading_screen(lv_timer_t*) {
         lv_timer_del(bar_timer);
         bar_timer = nullptr;
         is_loading = false;
-        bool is_connected = nunchuk.connect();
+        bool is_connected = lv_subject_get_int(&connected_subject);
         was_connected = is_connected;
         if (is_connected) {
-            Serial.println("Loading complete, Nunchuk connected, switching to ui_Menu");
+            BOAT_LOG_INFO("Loading complete, Nunchuk connected, switching to ui_Menu");
             _ui_screen_change(&ui_Menu, LV_SCR_LOAD_ANIM_FADE_IN, 200, 0, &ui_Menu_screen_init);
         } else {
-            Serial.println("Loading complete, Nunchuk disconnected, switching to ui_Connect");
+            BOAT_LOG_INFO("Loading complete, Nunchuk disconnected, switching to ui_Connect");
             _ui_screen_change(&ui_Connect, LV_SCR_LOAD_ANIM_MOVE_LEFT, 200, 0, &ui_Connect_screen_init);
             unplugged_Animation(ui_Unplugged, 0);
         }
     }
 }
 
-// Sprawdzanie połączenia z kontrolerem
-static void check_connection(lv_timer_t*) {
+// Obserwator połączenia z kontrolerem - przełącza ekrany po zmianie stanu
+static void connection_observer_cb(lv_observer_t*, lv_subject_t* subject) {
     if (is_loading) return;
-    bool is_connected = nunchuk.connect();
+    bool is_connected = lv_subject_get_int(subject);
     if (is_connected && !was_connected) {
-        Serial.println("Nunchuk connected, switching to ui_Menu");
+        BOAT_LOG_INFO("Nunchuk connected, switching to ui_Menu");
         _ui_screen_change(&ui_Menu, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 200, 0, &ui_Menu_screen_init);
         unplugged_Animation(ui_Unplugged, 0);
     } else if (!is_connected && was_connected) {
-        Serial.println("Nunchuk disconnected, switching to ui_Connect");
+        BOAT_LOG_INFO("Nunchuk disconnected, switching to ui_Connect");
+        lv_label_set_text(ui_BatteryText, "N/A");
         _ui_screen_change(&ui_Connect, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 200, 0, &ui_Connect_screen_init);
         unplugged_Animation(ui_Unplugged, 0);
     }
     was_connected = is_connected;
 }
 
-// Aktualizacja pasków prędkości i wysyłka danych przez ESP-NOW
-static void update_speed_values(lv_timer_t*) {
-    if (!nunchuk.connect()) {
-        lv_label_set_text(ui_BatteryText, "N/A");
-        lv_bar_set_value(ui_SpeedBarUp, 0, LV_ANIM_ON);
-        lv_bar_set_value(ui_SpeedBarDown, 0, LV_ANIM_ON);
-        lv_bar_set_value(ui_SpeedBarLeft, 0, LV_ANIM_ON);
-        lv_bar_set_value(ui_SpeedBarRight, 0, LV_ANIM_ON);
-        return;
-    }
-    nunchuk.update();
-    joy_x = nunchuk.joyX();
-    joy_y = nunchuk.joyY();
-    trigger = nunchuk.buttonZ();
-    Serial.printf("Raw joyX: %d\nRaw joyY: %d\nTrigger: %s\n", joy_x, joy_y, trigger ? "Pressed" : "Released");
-
-    // Mapowanie wartości joysticka na zakres 0-255 z uwzględnieniem martwej strefy
-    uint8_t up_value = 0, down_value = 0, left_value = 0, right_value = 0;
-    // Oś Y: up i down
-    if (joy_y > JOY_CENTER + JOY_DEADZONE_HIGH) {
-        up_value = map(joy_y, JOY_CENTER + JOY_DEADZONE_HIGH, JOY_MAX_Y, 0, 255);
-        down_value = 0;
-    } else if (joy_y < JOY_CENTER - JOY_DEADZONE_LOW) {
-        down_value = map(joy_y, JOY_CENTER - JOY_DEADZONE_LOW, JOY_MIN_Y, 0, 255);
-        up_value = 0;
-    } else {
-        up_value = 0;
-        down_value = 0;
-    }
-
-    // Oś X: left i right
-    if (joy_x > JOY_CENTER + JOY_DEADZONE_HIGH) {
-        right_value = map(joy_x, JOY_CENTER + JOY_DEADZONE_HIGH, JOY_MAX_X, 0, 255);
-        left_value = 0;
-    } else if (joy_x < JOY_CENTER - JOY_DEADZONE_LOW) {
-        left_value = map(joy_x, JOY_CENTER - JOY_DEADZONE_LOW, JOY_MIN_X, 0, 255);
-        right_value = 0;
-    } else {
-        left_value = 0;
-        right_value = 0;
-    }
-
-    // Ustawienie zakresu pasków prędkości na 0-255
-    lv_bar_set_range(ui_SpeedBarUp, 0, 255);
-    lv_bar_set_range(ui_SpeedBarDown, 0, 255);
-    lv_bar_set_range(ui_SpeedBarLeft, 0, 255);
-    lv_bar_set_range(ui_SpeedBarRight, 0, 255);
+// Obserwator wartości prędkości - ustawia powiązany pasek
+static void speed_bar_observer_cb(lv_observer_t* observer, lv_subject_t* subject) {
+    lv_bar_set_value(lv_observer_get_target_obj(observer), lv_subject_get_int(subject), LV_ANIM_ON);
+}
 
-    // Aktualizacja pasków prędkości
-    lv_bar_set_value(ui_SpeedBarUp, up_value, LV_ANIM_ON);
-    lv_bar_set_value(ui_SpeedBarDown, down_value, LV_ANIM_ON);
-    lv_bar_set_value(ui_SpeedBarLeft, left_value, LV_ANIM_ON);
-    lv_bar_set_value(ui_SpeedBarRight, right_value, LV_ANIM_ON);
-
-    // Wysyłanie danych przez ESP-NOW
-    data.up = up_value;
-    data.down = down_value;
-    data.left = left_value;
-    data.right = right_value;
-    data.trigger = trigger;
-    esp_err_t result = esp_now_send(receiverAddress, (uint8_t*)&data, sizeof(data));
-    Serial.println(result == ESP_OK ? "Sent with success" : "Error sending the data");
-
-    // Obsługa popupu po naciśnięciu triggera
-    if (trigger && lv_scr_act() == ui_Menu && !popup) {
+// Obserwator triggera - popup po naciśnięciu przycisku Z
+static void trigger_observer_cb(lv_observer_t*, lv_subject_t* subject) {
+    if (lv_subject_get_int(subject) && lv_scr_act() == ui_Menu && !popup) {
         popup = lv_obj_create(ui_Control);
         lv_obj_set_size(popup, 200, 100);
         lv_obj_align(popup, LV_ALIGN_CENTER, 0, 0);
@@ -236,11 +304,151 @@ static void update_speed_values(lv_timer_t*) {
     }
 }
 
+// Ustawienie wartości tylko przy zmianie, aby nie powiadamiać obserwatorów bez potrzeby
+static void publish_int(lv_subject_t* subject, int32_t value) {
+    if (lv_subject_get_int(subject) != value) lv_subject_set_int(subject, value);
+}
+
+// Przekazanie ostatniej próbki z zadania odczytu do interfejsu (wątek LVGL)
+static void apply_input_sample(lv_timer_t*) {
+    input_sample_t sample;
+    if (!input_mailbox.take(sample)) return;
+    publish_int(&speed_up_subject, sample.up);
+    publish_int(&speed_down_subject, sample.down);
+    publish_int(&speed_left_subject, sample.left);
+    publish_int(&speed_right_subject, sample.right);
+    publish_int(&trigger_subject, sample.trigger);
+    publish_int(&connected_subject, sample.connected);
+}
+
+// Wykres prędkości silników i statystyki łodzi na karcie Extras
+static void create_telemetry_view() {
+    telemetry_chart = lv_chart_create(ui_Extras);
+    lv_obj_set_size(telemetry_chart, 230, 150);
+    lv_obj_align(telemetry_chart, LV_ALIGN_TOP_MID, 0, 0);
+    lv_chart_set_type(telemetry_chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_update_mode(telemetry_chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_point_count(telemetry_chart, TELEMETRY_CHART_POINTS);
+    lv_chart_set_range(telemetry_chart, LV_CHART_AXIS_PRIMARY_Y, -255, 255);
+    lv_chart_set_div_line_count(telemetry_chart, 3, 0);
+    lv_obj_set_style_size(telemetry_chart, 0, 0, LV_PART_INDICATOR);
+    lv_obj_set_style_bg_color(telemetry_chart, lv_color_hex(0x000000), LV_PART_MAIN);
+    speed1_series = lv_chart_add_series(telemetry_chart, lv_color_hex(0xE90000), LV_CHART_AXIS_PRIMARY_Y);
+    speed2_series = lv_chart_add_series(telemetry_chart, lv_color_hex(0xB9B700), LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_all_value(telemetry_chart, speed1_series, LV_CHART_POINT_NONE);
+    lv_chart_set_all_value(telemetry_chart, speed2_series, LV_CHART_POINT_NONE);
+
+    telemetry_label = lv_label_create(ui_Extras);
+    lv_obj_align(telemetry_label, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+    lv_obj_set_style_text_color(telemetry_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    lv_obj_set_style_text_font(telemetry_label, &lv_font_montserrat_10, LV_PART_MAIN);
+    lv_label_set_text(telemetry_label, "No telemetry");
+}
+
+// Przekazanie telemetrii z łodzi do interfejsu (wątek LVGL)
+static void apply_telemetry(lv_timer_t*) {
+    LinkTelemetry telemetry;
+    if (!telemetry_mailbox.take(telemetry)) {
+        if (has_telemetry && millis() - last_telemetry_ms > TELEMETRY_TIMEOUT_MS) {
+            has_telemetry = false;
+            lv_label_set_text(ui_BatteryText, "N/A");
+            lv_label_set_text(telemetry_label, "No telemetry");
+        }
+        return;
+    }
+    has_telemetry = true;
+    last_telemetry_ms = millis();
+
+    lv_label_set_text_fmt(ui_BatteryText, "%u.%uV", telemetry.batteryMv / 1000, telemetry.batteryMv % 1000 / 100);
+    for (uint8_t i = 0; i < telemetry.sampleCount; i++) {
+        lv_chart_set_next_value(telemetry_chart, speed1_series, telemetry.speed1[i]);
+        lv_chart_set_next_value(telemetry_chart, speed2_series, telemetry.speed2[i]);
+    }
+    const LinkCounters& downlink = telemetry_receiver.stats();
+    lv_label_set_text_fmt(telemetry_label,
+                          "Target L/R: %d/%d%s\nLoop: %u us busy, %lu us period\nLost cmd: %lu  stale: %lu  telemetry: %lu",
+                          telemetry.targetSpeed1, telemetry.targetSpeed2,
+                          (telemetry.flags & LINK_TELEMETRY_FAILSAFE) ? "  FAILSAFE" : "",
+                          telemetry.loopBusyMaxUs, (unsigned long)telemetry.loopPeriodMaxUs,
+                          (unsigned long)telemetry.dropped, (unsigned long)telemetry.stale,
+                          (unsigned long)downlink.dropped);
+}
+
+// ============================================================================
+// Zadanie odczytu kontrolera i wysyłki danych
+// ============================================================================
+
+// Mapowanie osi joysticka na dwa kierunki 0-255 z uwzględnieniem martwej strefy
+static void map_axis(int value, int min_value, int max_value, uint8_t& positive, uint8_t& negative) {
+    positive = 0;
+    negative = 0;
+    if (value > JOY_CENTER + JOY_DEADZONE_HIGH) {
+        positive = map(value, JOY_CENTER + JOY_DEADZONE_HIGH, max_value, 0, 255);
+    } else if (value < JOY_CENTER - JOY_DEADZONE_LOW) {
+        negative = map(value, JOY_CENTER - JOY_DEADZONE_LOW, min_value, 0, 255);
+    }
+}
+
+// Odczyt Nunchuka; w czasie konwersji danych procesor wraca do pętli LVGL
+static bool read_nunchuk() {
+    if (nunchuk.beginUpdate()) {
+        UpdateStatus status;
+        while ((status = nunchuk.pollUpdate()) == UpdateStatus::Pending) {
+            vTaskDelay(1);
+        }
+        return status == UpdateStatus::Ready;
+    }
+    // Brak połączenia: poll() sprawdza kontroler i ponawia connect() co jakiś czas
+    return nunchuk.poll();
+}
+
+// Jeden okres zadania odczytu: próbka Nunchuka, wysyłka ESP-NOW i publikacja dla interfejsu
+static void input_step() {
+    input_sample_t sample = {};
+    bool has_sample = read_nunchuk();
+    if (has_sample) {
+        int joy_x = nunchuk.joyX();
+        int joy_y = nunchuk.joyY();
+        bool trigger = nunchuk.buttonZ();
+        BOAT_LOG_TRACE("Raw joyX: %d, joyY: %d, Trigger: %s", joy_x, joy_y, trigger ? "Pressed" : "Released");
+
+        map_axis(joy_y, JOY_MIN_Y, JOY_MAX_Y, sample.up, sample.down);     // Oś Y: up i down
+        map_axis(joy_x, JOY_MIN_X, JOY_MAX_X, sample.right, sample.left);  // Oś X: right i left
+        sample.trigger = trigger;
+
+        // Wysyłanie danych przez ESP-NOW (niezmieniona komenda jako krótki KEEPALIVE lub wcale)
+        struct_message command = {sample.up, sample.down, sample.left, sample.right, sample.trigger};
+        uint8_t frame[LINK_CONTROL_FRAME_SIZE];
+        size_t frame_len = link_sender.encode(frame, command, millis());
+        if (frame_len > 0) {
+            esp_err_t result = esp_now_send(receiverAddress, frame, frame_len);
+            if (result == ESP_OK) {
+                BOAT_LOG_TRACE("Sent with success");
+            } else {
+                BOAT_LOG_WARN("Error sending the data (%d)", (int)result);
+            }
+        }
+    }
+    // Nieudany odczyt przy aktywnym połączeniu nie zeruje pasków
+    sample.connected = nunchuk.isConnected();
+    if (has_sample || !sample.connected) input_mailbox.push(sample);
+}
+
+// Zadanie próbkowania joysticka i wysyłki pakietów ESP-NOW o stałym okresie INPUT_PERIOD_MS
+static void input_task(void*) {
+    TickType_t last_wake = xTaskGetTickCount();
+    for (;;) {
+        input_step();
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(INPUT_PERIOD_MS));
+    }
+}
+
 // ============================================================================
 // Funkcja inicjalizacyjna programu
 // ============================================================================
 void setup() {
     Serial.begin(115200);
+    boatLogBegin(Serial);
     Serial.printf("LVGL Library Version: %d.%d.%d\n", lv_version_major(), lv_version_minor(), lv_version_patch());
 
     // Inicjalizacja ESP-NOW
@@ -250,6 +458,7 @@ void setup() {
         return;
     }
     esp_now_register_send_cb(OnDataSent);
+    esp_now_register_recv_cb(OnDataRecv);
 
     // Dodanie odbiorcy ESP-NOW
     esp_now_peer_info_t peerInfo = {};
@@ -277,8 +486,12 @@ void setup() {
 
     // Inicjalizacja dotyku
     touch_spi.begin(TOUCH_CLK_PIN, TOUCH_MISO_PIN, TOUCH_MOSI_PIN, TOUCH_CS_PIN);
-    touch_screen.begin(touch_spi);
-    touch_screen.setRotation(1);
+    touch_sampler.begin();
+    bool touch_calibrated = touch_calibration.load(SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (!touch_calibrated) {
+        touch_calibration.compute(CALIBRATION_TARGETS, DEFAULT_CALIBRATION_RAW, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+    bool touch_held = digitalRead(TOUCH_IRQ_PIN) == LOW; // Palec na ekranie przy starcie = nowa kalibracja
 
     // Inicjalizacja LVGL
     lv_init();
@@ -286,12 +499,15 @@ void setup() {
 
     static lv_disp_t* display;
     display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
-    lv_display_set_buffers(display, screen_buffer, nullptr, SCREENBUFFER_SIZE_PIXELS * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
-    lv_display_set_flush_cb(display, my_display_flush);
+    if (!display_flush.begin(display, screen_buffer_1, screen_buffer_2, sizeof(screen_buffer_1))) {
+        Serial.println("Failed to initialize display DMA");
+        return;
+    }
 
-    lv_indev_t* touch_input = lv_indev_create();
+    touch_input = lv_indev_create();
     lv_indev_set_type(touch_input, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(touch_input, my_touch_read);
+    lv_indev_set_mode(touch_input, LV_INDEV_MODE_EVENT); // Odczyt tylko w process_touch_events()
 
     lv_tick_set_cb(my_tick_get_cb);
 
@@ -299,17 +515,57 @@ void setup() {
     ui_init();
     lv_timer_handler();
 
-    bar_timer = lv_timer_create(loading_screen, 100, nullptr);         // Timer ładowania
-    connection_timer = lv_timer_create(check_connection, 500, nullptr); // Timer sprawdzania połączenia
-    lv_timer_t* speed_timer = lv_timer_create(update_speed_values, 100, nullptr); // Timer pasków prędkości
+    // Ustawienie zakresu pasków prędkości na 0-255
+    lv_bar_set_range(ui_SpeedBarUp, 0, 255);
+    lv_bar_set_range(ui_SpeedBarDown, 0, 255);
+    lv_bar_set_range(ui_SpeedBarLeft, 0, 255);
+    lv_bar_set_range(ui_SpeedBarRight, 0, 255);
+
+    // Obrócone paski trzymają gotową warstwę (~11 KB każdy), odświeżenie tła ich nie renderuje
+    lv_obj_set_layer_cache(ui_SpeedBarUp, true);
+    lv_obj_set_layer_cache(ui_SpeedBarDown, true);
+    lv_obj_set_layer_cache(ui_SpeedBarLeft, true);
+
+    // Telemetria łodzi: napięcie w ui_BatteryText, wykres na karcie Extras
+    lv_label_set_text(ui_BatteryText, "N/A");
+    create_telemetry_view();
+
+    // Kalibracja dotyku przy pierwszym uruchomieniu lub na żądanie
+    if (!touch_calibrated || touch_held) start_touch_calibration();
+
+    // Powiązanie wartości z zadania odczytu z elementami interfejsu
+    lv_subject_init_int(&speed_up_subject, 0);
+    lv_subject_init_int(&speed_down_subject, 0);
+    lv_subject_init_int(&speed_left_subject, 0);
+    lv_subject_init_int(&speed_right_subject, 0);
+    lv_subject_init_int(&trigger_subject, 0);
+    lv_subject_init_int(&connected_subject, was_connected);
+    lv_subject_add_observer_obj(&speed_up_subject, speed_bar_observer_cb, ui_SpeedBarUp, nullptr);
+    lv_subject_add_observer_obj(&speed_down_subject, speed_bar_observer_cb, ui_SpeedBarDown, nullptr);
+    lv_subject_add_observer_obj(&speed_left_subject, speed_bar_observer_cb, ui_SpeedBarLeft, nullptr);
+    lv_subject_add_observer_obj(&speed_right_subject, speed_bar_observer_cb, ui_SpeedBarRight, nullptr);
+    lv_subject_add_observer(&trigger_subject, trigger_observer_cb, nullptr);
+    lv_subject_add_observer(&connected_subject, connection_observer_cb, nullptr);
+
+    bar_timer = lv_timer_create(loading_screen, 100, nullptr);          // Timer ładowania
+    input_timer = lv_timer_create(apply_input_sample, 20, nullptr);     // Timer przekazania próbek do UI
+    telemetry_timer = lv_timer_create(apply_telemetry, 100, nullptr);   // Timer telemetrii łodzi
+
+    // Od tego momentu tylko zadanie odczytu korzysta z Nunchuka i ESP-NOW
+    xTaskCreatePinnedToCore(input_task, "input", INPUT_TASK_STACK, nullptr,
+                            INPUT_TASK_PRIORITY, nullptr, INPUT_TASK_CORE);
+    if (!touch_sampler.start(TOUCH_TASK_PRIORITY, INPUT_TASK_CORE)) {
+        BOAT_LOG_ERROR("Failed to start touch task");
+    }
 
-    Serial.println("Setup done");
+    BOAT_LOG_INFO("Setup done");
 }
 
 // ============================================================================
 // Główna pętla programu
 // ============================================================================
 void loop() {
+    process_touch_events(); // Zdarzenia dotyku zebrane w tle
     lv_timer_handler(); // Obsługa timerów LVGL
     delay(5);           // Krótka pauza dla stabilności
 }
\ No newline at end of file
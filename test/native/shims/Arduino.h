@@ -0,0 +1,259 @@
+// ============================================================================
+// Minimalna nakładka Arduino do testów na komputerze (env:native)
+// ============================================================================
+#ifndef ARDUINO_SHIM_H
+#define ARDUINO_SHIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+// Wersja rdzenia Arduino, której wymagają biblioteki (np. XPT2046_Touchscreen)
+#define ARDUINO 10819
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+using std::min;
+using std::max;
+
+#define IRAM_ATTR
+
+// --- Wirtualny zegar: delay() przesuwa czas zamiast czekać ---
+namespace ArduinoShim {
+    inline unsigned long clockMicros = 0;
+
+    inline void advanceMicros(unsigned long us) { clockMicros += us; }
+    inline void advanceMillis(unsigned long ms) { clockMicros += ms * 1000UL; }
+    inline void resetClock() { clockMicros = 0; }
+}
+
+inline unsigned long micros() { return ArduinoShim::clockMicros; }
+inline unsigned long millis() { return ArduinoShim::clockMicros / 1000UL; }
+inline void delay(unsigned long ms) { ArduinoShim::advanceMillis(ms); }
+inline void delayMicroseconds(unsigned int us) { ArduinoShim::advanceMicros(us); }
+
+// --- Funkcje pomocnicze Arduino ---
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L low, H high) {
+    return x < (T)low ? (T)low : (x > (T)high ? (T)high : x);
+}
+
+inline long random(long low, long high) {
+    return high > low ? low + rand() % (high - low) : low;
+}
+inline long random(long high) { return random(0, high); }
+
+inline char* ltoa(long value, char* buffer, int base) {
+    if (base == 10) snprintf(buffer, 24, "%ld", value);
+    else if (base == 16) snprintf(buffer, 24, "%lx", (unsigned long)value);
+    else snprintf(buffer, 24, "%lo", (unsigned long)value);
+    return buffer;
+}
+
+inline void yield() {}
+
+// --- Dane w pamięci programu: na ESP32 zwykły odczyt z flash mapowanej w pamięci ---
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) ArduinoShim::readDword(addr)
+
+// Jak w rdzeniu ESP32 wynik to unsigned long - TFT_eSPI czyta tak wskaźniki
+namespace ArduinoShim {
+    inline unsigned long readDword(const void* addr) {
+        unsigned long value;
+        memcpy(&value, addr, sizeof(value));
+        return value;
+    }
+}
+
+// --- String: łączenie, porównanie i c_str(), czyli tyle, ile używają biblioteki ---
+class String : public std::string {
+public:
+    using std::string::string;
+    String() {}
+    String(const std::string& str) : std::string(str) {}
+
+    void toCharArray(char* buffer, unsigned int size) const {
+        if (size == 0) return;
+        size_t n = std::min((size_t)size - 1, length());
+        memcpy(buffer, data(), n);
+        buffer[n] = '\0';
+    }
+};
+
+// --- GPIO, PWM (LEDC) i ADC: stan zapisywany do sprawdzenia w testach ---
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+namespace ArduinoShim {
+    const int PIN_COUNT = 40;
+    const int LEDC_CHANNELS = 16;
+
+    struct LedcChannel {
+        int pin = -1;
+        uint32_t duty = 0;
+        uint32_t writes = 0;
+        unsigned long changedAtUs = 0; // Czas ostatniej zmiany wypełnienia
+    };
+
+    inline uint8_t pinModes[PIN_COUNT];
+    inline uint8_t pinLevels[PIN_COUNT];
+    inline uint32_t analogMillivolts[PIN_COUNT]; // Napięcie podawane na wejścia ADC
+    inline LedcChannel ledc[LEDC_CHANNELS];
+
+    inline void resetPins() {
+        memset(pinModes, 0, sizeof(pinModes));
+        memset(pinLevels, 0, sizeof(pinLevels));
+        memset(analogMillivolts, 0, sizeof(analogMillivolts));
+        for (LedcChannel& channel : ledc) channel = LedcChannel();
+    }
+}
+
+inline void pinMode(uint8_t pin, uint8_t mode) { ArduinoShim::pinModes[pin] = mode; }
+inline void digitalWrite(uint8_t pin, uint8_t level) { ArduinoShim::pinLevels[pin] = level ? HIGH : LOW; }
+inline int digitalRead(uint8_t pin) { return ArduinoShim::pinLevels[pin]; }
+inline uint32_t analogReadMilliVolts(uint8_t pin) { return ArduinoShim::analogMillivolts[pin]; }
+
+// --- Przerwania GPIO: test wywołuje zapamiętaną procedurę przez fireInterrupt() ---
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+namespace ArduinoShim {
+    inline void (*interruptHandlers[PIN_COUNT])(void);
+    inline void (*interruptArgHandlers[PIN_COUNT])(void*);
+    inline void* interruptArgs[PIN_COUNT];
+
+    inline void fireInterrupt(uint8_t pin) {
+        if (interruptHandlers[pin]) interruptHandlers[pin]();
+        if (interruptArgHandlers[pin]) interruptArgHandlers[pin](interruptArgs[pin]);
+    }
+}
+
+inline int digitalPinToInterrupt(uint8_t pin) { return pin < ArduinoShim::PIN_COUNT ? pin : -1; }
+inline uint32_t digitalPinToBitMask(uint8_t pin) { return 1UL << (pin & 31); }
+inline void attachInterrupt(uint8_t pin, void (*handler)(void), int) { ArduinoShim::interruptHandlers[pin] = handler; }
+inline void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int) {
+    ArduinoShim::interruptArgHandlers[pin] = handler;
+    ArduinoShim::interruptArgs[pin] = arg;
+}
+inline void detachInterrupt(uint8_t pin) {
+    ArduinoShim::interruptHandlers[pin] = nullptr;
+    ArduinoShim::interruptArgHandlers[pin] = nullptr;
+}
+
+inline double ledcSetup(uint8_t, double freq, uint8_t) { return freq; }
+inline void ledcAttachPin(uint8_t pin, uint8_t channel) { ArduinoShim::ledc[channel].pin = pin; }
+inline void ledcWrite(uint8_t channel, uint32_t duty) {
+    ArduinoShim::LedcChannel& state = ArduinoShim::ledc[channel];
+    if (state.duty != duty) state.changedAtUs = ArduinoShim::clockMicros;
+    state.duty = duty;
+    state.writes++;
+}
+
+// --- Print: formatowanie jak w Arduino, zapis bajt po bajcie przez write() ---
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual int availableForWrite() { return 0; }
+
+    size_t write(const char* str) {
+        size_t n = 0;
+        while (*str) n += write((uint8_t)*str++);
+        return n;
+    }
+
+    size_t print(const char* str) { return write(str); }
+    size_t print(const std::string& str) { return write(str.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned long value, int base = DEC) { return printNumber(value, base); }
+    size_t print(long value, int base = DEC) {
+        if (base == DEC && value < 0) return print('-') + printNumber((unsigned long)-value, base);
+        return printNumber((unsigned long)value, base);
+    }
+    size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(int value, int base = DEC) { return print((long)value, base); }
+    size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(double value, int digits = 2) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+        return write(buffer);
+    }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(T value) { return print(value) + println(); }
+    template <typename T>
+    size_t println(T value, int format) { return print(value, format) + println(); }
+
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+    size_t printNumber(unsigned long value, int base) {
+        char buffer[8 * sizeof(long) + 1];
+        char* str = &buffer[sizeof(buffer) - 1];
+        *str = '\0';
+        if (base < 2) base = 10;
+        do {
+            char digit = value % base;
+            *--str = digit < 10 ? digit + '0' : digit + 'A' - 10;
+            value /= base;
+        } while (value);
+        return write(str);
+    }
+};
+
+#include <stdarg.h>
+inline int Print::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    write(buffer);
+    return len;
+}
+
+// --- Serial: zlicza wysłane bajty zamiast blokować UART ---
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    void flush() {}
+    size_t write(uint8_t) override { return ++bytesWritten, 1; }
+    int availableForWrite() override { return 128; } // Pusta kolejka FIFO nadajnika UART
+    using Print::write;
+
+    unsigned long bytesWritten = 0;
+};
+
+inline HardwareSerial Serial;
+
+// Jak w rdzeniu ESP32: Arduino.h udostępnia API FreeRTOS
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#endif
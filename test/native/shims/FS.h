@@ -0,0 +1,105 @@
+// ============================================================================
+// Atrapa systemu plików Arduino (fs::FS, fs::File) do testów na komputerze
+// Pliki leżą w pamięci; liczniki wywołań read() i seek() pokazują, ile
+// operacji na SPIFFS lub karcie SD wykonałby kod na ESP32.
+// ============================================================================
+#ifndef FS_SHIM_H
+#define FS_SHIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Arduino.h"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+typedef std::map<std::string, std::vector<uint8_t>> FileMap;
+
+// Liczniki operacji na wszystkich plikach
+struct FileStats {
+    unsigned long reads = 0;     // Wywołania read() (pojedynczy bajt lub blok)
+    unsigned long bytesRead = 0;
+    unsigned long seeks = 0;
+    unsigned long opens = 0;
+};
+
+inline FileStats fileStats;
+
+inline void resetFileStats() { fileStats = FileStats(); }
+
+class File {
+public:
+    File() : data(nullptr), pos(0) {}
+    explicit File(std::shared_ptr<const std::vector<uint8_t>> content) : data(content), pos(0) {}
+
+    explicit operator bool() const { return data != nullptr; }
+
+    int read() {
+        fileStats.reads++;
+        if (!data || pos >= data->size()) return -1;
+        fileStats.bytesRead++;
+        return (*data)[pos++];
+    }
+
+    size_t read(uint8_t* buffer, size_t len) {
+        fileStats.reads++;
+        if (!data || pos >= data->size()) return 0;
+        if (len > data->size() - pos) len = data->size() - pos;
+        memcpy(buffer, data->data() + pos, len);
+        pos += len;
+        fileStats.bytesRead += len;
+        return len;
+    }
+
+    bool seek(uint32_t offset, SeekMode mode = SeekSet) {
+        fileStats.seeks++;
+        if (!data) return false;
+        size_t base = mode == SeekSet ? 0 : (mode == SeekCur ? pos : data->size());
+        if (base + offset > data->size()) return false;
+        pos = base + offset;
+        return true;
+    }
+
+    size_t position() const { return pos; }
+    size_t size() const { return data ? data->size() : 0; }
+    void close() { data.reset(); pos = 0; }
+
+private:
+    std::shared_ptr<const std::vector<uint8_t>> data;
+    size_t pos;
+};
+
+/**
+ * System plików w pamięci. Kopia obiektu (np. przypisanie do SPIFFS)
+ * wskazuje te same pliki, jak referencja do systemu plików na ESP32.
+ */
+class FS {
+public:
+    FS() : files(std::make_shared<FileMap>()) {}
+
+    void addFile(const std::string& path, const std::vector<uint8_t>& content) { (*files)[path] = content; }
+    void clear() { files->clear(); }
+
+    bool exists(const String& path) const { return files->count(path) != 0; }
+
+    File open(const String& path, const char* = "r") const {
+        auto it = files->find(path);
+        if (it == files->end()) return File();
+        fileStats.opens++;
+        // Plik współdzieli zawartość z systemem plików, więc nie jest kopiowany przy otwarciu
+        return File(std::shared_ptr<const std::vector<uint8_t>>(files, &it->second));
+    }
+
+private:
+    std::shared_ptr<FileMap> files;
+};
+
+} // namespace fs
+
+#endif
@@ -0,0 +1,79 @@
+// ============================================================================
+// Model pamięci obrazu ILI9341 na magistrali SPI do testów na komputerze
+// ============================================================================
+#ifndef FAKE_ILI9341_H
+#define FAKE_ILI9341_H
+
+#include <vector>
+#include "SPI.h"
+
+/**
+ * Obsługuje tylko komendy okna i zapisu pamięci: CASET (0x2A), PASET (0x2B)
+ * i RAMWR (0x2C). Bajt przy niskim stanie pinu D/C to komenda, przy wysokim
+ * dane. Piksele RAMWR (565, starszy bajt pierwszy) wypełniają okno wierszami,
+ * a zapisy poza ekranem są pomijane jak w sterowniku. Pozostałe komendy
+ * (inicjalizacja) są ignorowane.
+ */
+class FakeILI9341 : public SPIDevice {
+public:
+    static const uint8_t CMD_CASET = 0x2A;
+    static const uint8_t CMD_PASET = 0x2B;
+    static const uint8_t CMD_RAMWR = 0x2C;
+
+    FakeILI9341(uint16_t width, uint16_t height, uint8_t dcPin)
+        : width(width), height(height), dcPin(dcPin), pixels((size_t)width * height, 0) {}
+    virtual ~FakeILI9341() {}
+
+    uint16_t pixel(int32_t x, int32_t y) const { return pixels[(size_t)y * width + x]; }
+    void fill(uint16_t color) { std::fill(pixels.begin(), pixels.end(), color); }
+
+    uint8_t transfer(uint8_t data) override {
+        if (ArduinoShim::pinLevels[dcPin] == LOW) {
+            command = data;
+            count = 0;
+            if (command == CMD_RAMWR) {
+                x = x0;
+                y = y0;
+            }
+            return 0;
+        }
+
+        uint8_t n = count++;
+        if (command == CMD_CASET && n < 4) setWord(n, x0, x1, data);
+        else if (command == CMD_PASET && n < 4) setWord(n, y0, y1, data);
+        else if (command == CMD_RAMWR) {
+            if (!(n & 1)) {
+                high = data;
+                return 0;
+            }
+            if (x < width && y < height) pixels[(size_t)y * width + x] = (uint16_t)(high << 8 | data);
+            pixelsWritten++;
+            if (++x > x1) {
+                x = x0;
+                y++;
+            }
+            count = 0; // Kolejne piksele bez ograniczenia długości
+        }
+        return 0;
+    }
+
+    uint16_t width, height;
+    uint8_t dcPin;
+    std::vector<uint16_t> pixels;
+    unsigned long pixelsWritten = 0;
+
+private:
+    // Dwa słowa 16-bitowe (początek i koniec), starszy bajt pierwszy
+    static void setWord(uint8_t n, uint16_t& start, uint16_t& end, uint8_t data) {
+        uint16_t& word = n < 2 ? start : end;
+        word = (n & 1) ? (uint16_t)((word & 0xFF00) | data) : (uint16_t)(data << 8);
+    }
+
+    uint8_t command = 0;
+    uint8_t count = 0;
+    uint8_t high = 0;
+    uint16_t x0 = 0, x1 = 0, y0 = 0, y1 = 0;
+    uint16_t x = 0, y = 0;
+};
+
+#endif
@@ -0,0 +1,59 @@
+// ============================================================================
+// Model Nunchuka na magistrali I2C (adres 0x52) do testów na komputerze
+// ============================================================================
+#ifndef FAKE_NUNCHUK_H
+#define FAKE_NUNCHUK_H
+
+#include "Wire.h"
+
+class FakeNunchuk : public I2CDevice {
+public:
+    static const unsigned long CONVERSION_US = 175; // Czas przygotowania danych po zapisie wskaźnika
+
+    bool present = true;      // Czy kontroler jest podłączony
+    bool initialized = false; // Po zapisie 0xF0=0x55
+    uint8_t joyX = 128, joyY = 128;
+    bool buttonC = false, buttonZ = false;
+    unsigned long earlyReads = 0; // Odczyty przed upływem CONVERSION_US
+
+    bool receive(const uint8_t* data, size_t len) override {
+        if (!present) return false;
+        if (len == 2 && data[0] == 0xF0 && data[1] == 0x55) initialized = true;
+        if (len >= 1) {
+            pointer = data[0];
+            pointerWrittenAt = micros();
+        }
+        return true;
+    }
+
+    size_t request(uint8_t* data, size_t len) override {
+        if (!present) return 0;
+        bool ready = micros() - pointerWrittenAt >= CONVERSION_US;
+        if (!ready) earlyReads++;
+        static const uint8_t id[6] = {0x00, 0x00, 0xA4, 0x20, 0x00, 0x00};
+        for (size_t i = 0; i < len; i++) {
+            if (!initialized || !ready) data[i] = 0xFF;        // Brak danych: same 0xFF
+            else if (pointer == 0xFA) data[i] = id[i % 6];     // Identyfikator
+            else data[i] = controlByte(i);                     // Dane sterujące
+        }
+        return len;
+    }
+
+    // Odłączenie i ponowne podłączenie kasuje inicjalizację
+    void unplug() { present = false; initialized = false; }
+
+private:
+    uint8_t pointer = 0;
+    unsigned long pointerWrittenAt = 0;
+
+    uint8_t controlByte(size_t i) const {
+        switch (i) {
+            case 0: return joyX;
+            case 1: return joyY;
+            case 5: return (buttonC ? 0x00 : 0x02) | (buttonZ ? 0x00 : 0x01); // Logika odwrócona
+            default: return 0x80;
+        }
+    }
+};
+
+#endif
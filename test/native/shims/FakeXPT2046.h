@@ -0,0 +1,66 @@
+// ============================================================================
+// Model kontrolera dotyku XPT2046 na magistrali SPI do testów na komputerze
+// ============================================================================
+#ifndef FAKE_XPT2046_H
+#define FAKE_XPT2046_H
+
+#include "SPI.h"
+
+/**
+ * Model na poziomie bajtów: bajt z bitem startu (0x80) wybiera kanał
+ * (bity A2-A0), a 12-bitowy wynik przesunięty o 3 bity w lewo wychodzi
+ * w dwóch kolejnych bajtach. Kolejną komendę można wysłać już w drugim
+ * z nich - tak robi transfer16(komenda) w sterowniku.
+ */
+class FakeXPT2046 : public SPIDevice {
+public:
+    static const uint8_t CHANNEL_X = 1;  // 0x91
+    static const uint8_t CHANNEL_Z1 = 3; // 0xB1
+    static const uint8_t CHANNEL_Z2 = 4; // 0xC1
+    static const uint8_t CHANNEL_Y = 5;  // 0xD1, 0xD0
+
+    uint16_t x = 0, y = 0;       // Surowe wyniki kanałów X i Y (0-4095)
+    uint16_t z1 = 0, z2 = 4095;  // Nacisk: z = z1 + 4095 - z2
+    unsigned long conversions = 0;
+
+    virtual ~FakeXPT2046() {}
+
+    void press(uint16_t rawX, uint16_t rawY, uint16_t pressure = 2000) {
+        x = rawX;
+        y = rawY;
+        z1 = pressure;
+        z2 = 4095;
+    }
+
+    void release() {
+        z1 = 0;
+        z2 = 4095;
+    }
+
+    uint8_t transfer(uint8_t data) override {
+        uint8_t out = (uint8_t)(shift >> 8);
+        shift = (uint16_t)(shift << 8);
+        if (data & 0x80) { // Bit startu: nowa konwersja
+            conversions++;
+            shift = (uint16_t)(convert((data >> 4) & 0x07) << 3);
+        }
+        return out;
+    }
+
+protected:
+    // Wynik konwersji kanału - test może dodać szum lub odtworzyć nagrany przebieg
+    virtual uint16_t convert(uint8_t channel) {
+        switch (channel) {
+            case CHANNEL_X: return x;
+            case CHANNEL_Y: return y;
+            case CHANNEL_Z1: return z1;
+            case CHANNEL_Z2: return z2;
+            default: return 0;
+        }
+    }
+
+private:
+    uint16_t shift = 0; // Rejestr wyjściowy (DOUT)
+};
+
+#endif
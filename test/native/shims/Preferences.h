@@ -0,0 +1,69 @@
+// ============================================================================
+// Atrapa Preferences (NVS) do testów na komputerze (env:native)
+// ============================================================================
+#ifndef PREFERENCES_SHIM_H
+#define PREFERENCES_SHIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace PreferencesShim {
+    // Zawartość "flasha": przestrzeń nazw + klucz -> bajty; przetrwa kolejne begin()
+    inline std::map<std::string, std::vector<uint8_t>> flash;
+    inline unsigned long writes = 0;
+
+    inline void reset() {
+        flash.clear();
+        writes = 0;
+    }
+}
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* = nullptr) {
+        space = name;
+        this->readOnly = readOnly;
+        opened = true;
+        return true;
+    }
+
+    void end() { opened = false; }
+
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        if (!opened || readOnly) return 0;
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        PreferencesShim::flash[path(key)].assign(bytes, bytes + len);
+        PreferencesShim::writes++;
+        return len;
+    }
+
+    size_t getBytesLength(const char* key) {
+        auto entry = PreferencesShim::flash.find(path(key));
+        return opened && entry != PreferencesShim::flash.end() ? entry->second.size() : 0;
+    }
+
+    size_t getBytes(const char* key, void* buf, size_t maxLen) {
+        size_t len = getBytesLength(key);
+        if (len == 0 || len > maxLen) return 0;
+        memcpy(buf, PreferencesShim::flash[path(key)].data(), len);
+        return len;
+    }
+
+    bool remove(const char* key) {
+        if (!opened || readOnly) return false;
+        return PreferencesShim::flash.erase(path(key)) > 0;
+    }
+
+private:
+    std::string path(const char* key) const { return space + "/" + key; }
+
+    std::string space;
+    bool readOnly = false;
+    bool opened = false;
+};
+
+#endif
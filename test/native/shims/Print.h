@@ -0,0 +1,9 @@
+// ============================================================================
+// Print.h rdzenia Arduino - klasa Print jest w nakładce Arduino.h
+// ============================================================================
+#ifndef PRINT_SHIM_H
+#define PRINT_SHIM_H
+
+#include "Arduino.h"
+
+#endif
@@ -0,0 +1,94 @@
+// ============================================================================
+// Atrapa SPIClass do testów na komputerze (env:native)
+// ============================================================================
+#ifndef SPI_SHIM_H
+#define SPI_SHIM_H
+
+#include "Arduino.h"
+
+#define HSPI 2
+#define VSPI 3
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+class SPISettings {
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+
+    uint32_t clock;
+    uint8_t bitOrder;
+    uint8_t dataMode;
+};
+
+/**
+ * Układ podłączony do magistrali: odpowiada na każde przesłane słowo
+ */
+class SPIDevice {
+public:
+    virtual ~SPIDevice() {}
+    virtual uint8_t transfer(uint8_t data) = 0;
+
+    // Słowo 16-bitowe jako dwa bajty, starszy pierwszy (MSBFIRST)
+    virtual uint16_t transfer16(uint16_t data) {
+        uint16_t high = transfer((uint8_t)(data >> 8));
+        return (uint16_t)(high << 8 | transfer((uint8_t)data));
+    }
+};
+
+/**
+ * Zamiennik magistrali: przekazuje dane do device i zlicza transakcje
+ * oraz transfery, żeby testy mogły sprawdzić koszt odczytu
+ */
+class SPIClass {
+public:
+    explicit SPIClass(uint8_t bus = HSPI) : bus(bus) {}
+    void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+    void end() {}
+
+    void beginTransaction(SPISettings settings) {
+        this->settings = settings;
+        transactions++;
+    }
+    void endTransaction() {}
+    void setFrequency(uint32_t) {}
+
+    uint8_t transfer(uint8_t data) {
+        transfers++;
+        bytes++;
+        return device ? device->transfer(data) : 0;
+    }
+    uint16_t transfer16(uint16_t data) {
+        transfers++;
+        bytes += 2;
+        return device ? device->transfer16(data) : 0;
+    }
+
+    // Jak w rdzeniu ESP32: cały bufor jednym wywołaniem (przez kolejkę FIFO SPI)
+    void transferBytes(const uint8_t* data, uint8_t* out, uint32_t size) {
+        transfers++;
+        bytes += size;
+        for (uint32_t i = 0; i < size; i++) {
+            uint8_t received = device ? device->transfer(data ? data[i] : 0xFF) : 0;
+            if (out) out[i] = received;
+        }
+    }
+
+    void resetCounters() { transactions = transfers = bytes = 0; }
+
+    uint8_t bus;
+    SPIDevice* device = nullptr;
+    SPISettings settings;
+    uint32_t transactions = 0;
+    uint32_t transfers = 0; // Wywołania transfer*() - każde to osobna obsługa sterownika SPI
+    uint32_t bytes = 0;
+};
+
+inline SPIClass SPI(VSPI);
+
+#endif
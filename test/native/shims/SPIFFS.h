@@ -0,0 +1,11 @@
+// ============================================================================
+// Atrapa SPIFFS do testów na komputerze: system plików w pamięci (FS.h)
+// ============================================================================
+#ifndef SPIFFS_SHIM_H
+#define SPIFFS_SHIM_H
+
+#include "FS.h"
+
+inline fs::FS SPIFFS;
+
+#endif
@@ -0,0 +1,4 @@
+// ============================================================================
+// Przekierowanie <TFT_Drivers/ILI9341_Defines.h> z User_Setup_Select.h
+// ============================================================================
+#include "../../../../lib/TFT_eSPI/TFT_Drivers/ILI9341_Defines.h"
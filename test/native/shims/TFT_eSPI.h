@@ -0,0 +1,120 @@
+// ============================================================================
+// Atrapa TFT_eSPI do testów na komputerze (env:native)
+// Przy spiHz > 0 transfer trwa tyle, ile na magistrali SPI: pushColors()
+// blokuje (przesuwa wirtualny zegar), DMA kończy się w tle, a callback
+// zakończenia wywołuje dmaBusy()/dmaWait() w chwili końca transferu.
+// ============================================================================
+#ifndef TFT_ESPI_SHIM_H
+#define TFT_ESPI_SHIM_H
+
+#include "Arduino.h"
+
+#define TFT_BLACK 0x0000
+
+/**
+ * Zamiennik ekranu zliczający transakcje, przesłane piksele i czas magistrali
+ */
+class TFT_eSPI {
+public:
+    TFT_eSPI(int16_t w = 240, int16_t h = 320) : width(w), height(h) {}
+    void begin() {}
+    void setRotation(uint8_t r) { rotation = r % 4; }
+    void setSwapBytes(bool swap) { swapBytes = swap; }
+    bool getSwapBytes() const { return swapBytes; }
+    void fillScreen(uint32_t) { pixelsPushed += (uint32_t)width * height; }
+
+    void startWrite() { transactions++; }
+    void endWrite() { dmaWait(); }
+    void setAddrWindow(int32_t, int32_t, int32_t, int32_t) { windows++; }
+
+    // Wysyłka blokująca: procesor czeka na koniec transferu, a przy swap
+    // dodatkowo zamienia bajty każdego piksela (swapNsPerPixel)
+    void pushColors(uint16_t* data, uint32_t len, bool swap = true) {
+        firstPixel = swap ? (uint16_t)((data[0] >> 8) | (data[0] << 8)) : data[0];
+        pixelsPushed += len;
+        busUs += transferMicros(len);
+        unsigned long swapUs = swap ? (unsigned long)(len * swapNsPerPixel / 1000) : 0;
+        swappedUs += swapUs;
+        ArduinoShim::advanceMicros(transferMicros(len) + swapUs);
+    }
+
+    // --- DMA ---
+    bool initDMA(bool = false) { DMA_Enabled = true; return true; }
+
+    void setDMACompleteCallback(void (*callback)(void* param), void* param = nullptr) {
+        dmaCallback = callback;
+        dmaCallbackParam = param;
+    }
+
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* = nullptr) {
+        if (w <= 0 || h <= 0 || !DMA_Enabled) return;
+        dmaWait();
+        setAddrWindow(x, y, w, h);
+        startTransfer(data, (uint32_t)(w * h));
+    }
+
+    void pushPixelsDMA(uint16_t* data, uint32_t len) {
+        if (len == 0 || !DMA_Enabled) return;
+        dmaWait();
+        startTransfer(data, len);
+    }
+
+    bool dmaBusy() {
+        if (dmaActive && (long)(micros() - dmaDoneUs) >= 0) completeTransfer();
+        return dmaActive;
+    }
+
+    void dmaWait() {
+        if (!dmaActive) return;
+        if ((long)(dmaDoneUs - micros()) > 0) {
+            waitedUs += dmaDoneUs - micros();
+            ArduinoShim::clockMicros = dmaDoneUs;
+        }
+        completeTransfer();
+    }
+
+    // Czas przesłania pikseli RGB565 przy zegarze spiHz
+    uint32_t transferMicros(uint32_t pixels) const {
+        return spiHz ? (uint32_t)((uint64_t)pixels * 16 * 1000000 / spiHz) : 0;
+    }
+
+    int16_t width, height;
+    uint8_t rotation = 0;
+    bool swapBytes = false;
+    bool DMA_Enabled = false;
+    uint32_t spiHz = 0;          // Zegar SPI; 0 = transfer bez upływu czasu
+    uint32_t transactions = 0;
+    uint32_t windows = 0;
+    uint32_t pixelsPushed = 0;
+    uint32_t dmaTransfers = 0;
+    unsigned long busUs = 0;     // Łączny czas zajętości magistrali
+    unsigned long waitedUs = 0;  // Czas, przez który procesor czekał na DMA
+    double swapNsPerPixel = 0;   // Koszt zamiany bajtów w pushColors(swap = true)
+    unsigned long swappedUs = 0; // Łączny czas zamiany bajtów w pushColors
+    const uint16_t* dmaBuffer = nullptr; // Bufor aktualnie czytany przez DMA
+    uint16_t firstPixel = 0;     // Pierwsze słowo ostatniego transferu (kolejność bajtów)
+
+private:
+    void startTransfer(const uint16_t* data, uint32_t len) {
+        firstPixel = data[0];
+        pixelsPushed += len;
+        busUs += transferMicros(len);
+        dmaTransfers++;
+        dmaBuffer = data;
+        dmaActive = true;
+        dmaDoneUs = micros() + transferMicros(len);
+    }
+
+    void completeTransfer() {
+        dmaActive = false;
+        dmaBuffer = nullptr;
+        if (dmaCallback) dmaCallback(dmaCallbackParam);
+    }
+
+    bool dmaActive = false;
+    unsigned long dmaDoneUs = 0;
+    void (*dmaCallback)(void* param) = nullptr;
+    void* dmaCallbackParam = nullptr;
+};
+
+#endif
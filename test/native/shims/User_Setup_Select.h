@@ -0,0 +1,5 @@
+// ============================================================================
+// Przekierowanie <User_Setup_Select.h> z prawdziwego TFT_eSPI.h (env:native
+// pomija bibliotekę, więc jej katalog nie jest na ścieżce nagłówków)
+// ============================================================================
+#include "../../../lib/TFT_eSPI/User_Setup_Select.h"
@@ -0,0 +1,22 @@
+// ============================================================================
+// Atrapa WiFi do testów na komputerze (env:native)
+// ============================================================================
+#ifndef WIFI_SHIM_H
+#define WIFI_SHIM_H
+
+#include "Arduino.h"
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t m) { currentMode = m; return true; }
+    wifi_mode_t getMode() const { return currentMode; }
+
+private:
+    wifi_mode_t currentMode = WIFI_OFF;
+};
+
+inline WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,88 @@
+// ============================================================================
+// Atrapa TwoWire do testów na komputerze (env:native)
+// ============================================================================
+#ifndef WIRE_SHIM_H
+#define WIRE_SHIM_H
+
+#include "Arduino.h"
+
+/**
+ * Model urządzenia podłączonego do magistrali I2C
+ * Każda metoda odpowiada jednej fazie transakcji TwoWire.
+ */
+class I2CDevice {
+public:
+    virtual ~I2CDevice() {}
+    virtual bool receive(const uint8_t* data, size_t len) = 0; // false = NACK
+    virtual size_t request(uint8_t* data, size_t len) = 0;     // Liczba zwróconych bajtów
+};
+
+/**
+ * Zamiennik TwoWire przekazujący transakcje do modelu urządzenia
+ * i zliczający je, aby testy mogły sprawdzić ruch na magistrali.
+ */
+class TwoWire {
+public:
+    void begin() {}
+    void begin(int, int) {}
+
+    void attach(uint8_t address, I2CDevice* dev) {
+        deviceAddress = address;
+        device = dev;
+    }
+
+    void beginTransmission(uint8_t address) {
+        txAddress = address;
+        txLength = 0;
+    }
+
+    size_t write(uint8_t value) {
+        if (txLength >= sizeof(txBuffer)) return 0;
+        txBuffer[txLength++] = value;
+        return 1;
+    }
+
+    uint8_t endTransmission(bool = true) {
+        writeTransactions++;
+        if (!device || txAddress != deviceAddress) return 2; // NACK adresu
+        return device->receive(txBuffer, txLength) ? 0 : 3;  // NACK danych
+    }
+
+    uint8_t requestFrom(uint8_t address, uint8_t quantity) {
+        readTransactions++;
+        rxLength = rxIndex = 0;
+        if (!device || address != deviceAddress) return 0;
+        if (quantity > sizeof(rxBuffer)) quantity = sizeof(rxBuffer);
+        rxLength = device->request(rxBuffer, quantity);
+        return rxLength;
+    }
+
+    int available() { return rxLength - rxIndex; }
+    int read() { return rxIndex < rxLength ? rxBuffer[rxIndex++] : -1; }
+
+    size_t readBytes(uint8_t* buffer, size_t length) {
+        size_t count = 0;
+        while (count < length && rxIndex < rxLength) buffer[count++] = rxBuffer[rxIndex++];
+        return count;
+    }
+
+    unsigned long transactions() const { return writeTransactions + readTransactions; }
+    void resetCounters() { writeTransactions = readTransactions = 0; }
+
+    unsigned long writeTransactions = 0; // Liczba endTransmission()
+    unsigned long readTransactions = 0;  // Liczba requestFrom()
+
+private:
+    I2CDevice* device = nullptr;
+    uint8_t deviceAddress = 0;
+    uint8_t txAddress = 0;
+    uint8_t txBuffer[32];
+    size_t txLength = 0;
+    uint8_t rxBuffer[32];
+    size_t rxLength = 0;
+    size_t rxIndex = 0;
+};
+
+inline TwoWire Wire;
+
+#endif
@@ -0,0 +1,49 @@
+// ============================================================================
+// Atrapa sterownika dotyku XPT2046 do testów na komputerze (env:native)
+// ============================================================================
+#ifndef XPT2046_SHIM_H
+#define XPT2046_SHIM_H
+
+#include "SPI.h"
+
+class TS_Point {
+public:
+    TS_Point() : x(0), y(0), z(0) {}
+    TS_Point(int16_t x, int16_t y, int16_t z) : x(x), y(y), z(z) {}
+    int16_t x, y, z;
+};
+
+class TS_Sample {
+public:
+    TS_Sample() : x(0), y(0), z(0), valid(false) {}
+    int16_t x, y, z;
+    bool valid;
+};
+
+/**
+ * Zamiennik sterownika: test ustawia pressed i point, kod je odczytuje
+ */
+class XPT2046_Touchscreen {
+public:
+    XPT2046_Touchscreen(uint8_t csPin, uint8_t irqPin = 255) : csPin(csPin), irqPin(irqPin) {}
+    bool begin(SPIClass&) { return true; }
+    void setRotation(uint8_t r) { rotation = r % 4; }
+    bool touched() { return pressed; }
+    TS_Point getPoint() { return pressed ? point : TS_Point(); }
+    TS_Sample readSample() {
+        TS_Sample sample;
+        if (!pressed) return sample;
+        sample.x = point.x;
+        sample.y = point.y;
+        sample.z = point.z;
+        sample.valid = true;
+        return sample;
+    }
+
+    bool pressed = false;
+    TS_Point point;
+    uint8_t csPin, irqPin;
+    uint8_t rotation = 1;
+};
+
+#endif
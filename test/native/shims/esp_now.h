@@ -0,0 +1,164 @@
+// ============================================================================
+// Atrapa ESP-NOW do testów na komputerze (env:native)
+// Kilka węzłów (kontroler, łódź) dzieli jedno "powietrze" z opóźnieniem
+// i opcjonalną utratą ramek; pump() doręcza ramki, których czas nadszedł.
+// ============================================================================
+#ifndef ESP_NOW_SHIM_H
+#define ESP_NOW_SHIM_H
+
+#include "Arduino.h"
+#include <deque>
+#include <functional>
+#include <vector>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_ESPNOW_BASE 0x3066
+#define ESP_ERR_ESPNOW_NOT_INIT (ESP_ERR_ESPNOW_BASE + 1)
+#define ESP_ERR_ESPNOW_ARG (ESP_ERR_ESPNOW_BASE + 2)
+#define ESP_ERR_ESPNOW_NOT_FOUND (ESP_ERR_ESPNOW_BASE + 5)
+#define ESP_ERR_ESPNOW_EXIST (ESP_ERR_ESPNOW_BASE + 7)
+
+#define ESP_NOW_ETH_ALEN 6
+#define ESP_NOW_MAX_DATA_LEN 250
+
+typedef enum {
+    ESP_NOW_SEND_SUCCESS = 0,
+    ESP_NOW_SEND_FAIL,
+} esp_now_send_status_t;
+
+typedef struct {
+    uint8_t peer_addr[ESP_NOW_ETH_ALEN];
+    uint8_t lmk[16];
+    uint8_t channel;
+    int ifidx;
+    bool encrypt;
+    void* priv;
+} esp_now_peer_info_t;
+
+typedef void (*esp_now_send_cb_t)(const uint8_t* mac_addr, esp_now_send_status_t status);
+typedef void (*esp_now_recv_cb_t)(const uint8_t* mac_addr, const uint8_t* data, int len);
+
+namespace EspNowShim {
+    // Jedno urządzenie ESP32 z własnym adresem i callbackami
+    struct Node {
+        uint8_t mac[ESP_NOW_ETH_ALEN];
+        bool initialized = false;
+        esp_now_send_cb_t sendCb = nullptr;
+        esp_now_recv_cb_t recvCb = nullptr;
+        std::vector<std::vector<uint8_t>> peers;
+        uint32_t framesSent = 0;
+        uint32_t framesReceived = 0;
+
+        bool hasPeer(const uint8_t* addr) const {
+            for (const std::vector<uint8_t>& peer : peers) {
+                if (memcmp(peer.data(), addr, ESP_NOW_ETH_ALEN) == 0) return true;
+            }
+            return false;
+        }
+    };
+
+    // Ramka w drodze między węzłami
+    struct AirFrame {
+        Node* from;
+        uint8_t to[ESP_NOW_ETH_ALEN];
+        std::vector<uint8_t> data;
+        unsigned long deliverAtUs;
+    };
+
+    inline std::vector<Node*> nodes;
+    inline Node* current = nullptr;           // Węzeł, którego kod właśnie się wykonuje
+    inline std::deque<AirFrame> air;
+    inline unsigned long airLatencyUs = 1000; // Czas od esp_now_send() do callbacku odbioru
+    inline std::function<bool(const AirFrame&)> dropFrame; // true = ramka utracona
+
+    inline void attach(Node& node) { nodes.push_back(&node); }
+    inline void select(Node& node) { current = &node; }
+
+    inline void reset() {
+        nodes.clear();
+        current = nullptr;
+        air.clear();
+        airLatencyUs = 1000;
+        dropFrame = nullptr;
+    }
+
+    inline Node* findNode(const uint8_t* mac) {
+        for (Node* node : nodes) {
+            if (memcmp(node->mac, mac, ESP_NOW_ETH_ALEN) == 0) return node;
+        }
+        return nullptr;
+    }
+
+    /**
+     * Doręcza ramki, których czas dotarcia minął, i zgłasza nadawcy wynik
+     * @return Liczba doręczonych ramek
+     */
+    inline size_t pump() {
+        size_t delivered = 0;
+        Node* caller = current;
+        while (!air.empty() && (long)(micros() - air.front().deliverAtUs) >= 0) {
+            AirFrame frame = air.front();
+            air.pop_front();
+            Node* target = findNode(frame.to);
+            bool ok = target && target->initialized && !(dropFrame && dropFrame(frame));
+            if (ok) {
+                target->framesReceived++;
+                delivered++;
+                if (target->recvCb) {
+                    current = target;
+                    target->recvCb(frame.from->mac, frame.data.data(), (int)frame.data.size());
+                }
+            }
+            if (frame.from->sendCb) {
+                current = frame.from;
+                frame.from->sendCb(frame.to, ok ? ESP_NOW_SEND_SUCCESS : ESP_NOW_SEND_FAIL);
+            }
+        }
+        current = caller;
+        return delivered;
+    }
+}
+
+inline esp_err_t esp_now_init() {
+    EspNowShim::current->initialized = true;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_now_register_send_cb(esp_now_send_cb_t cb) {
+    EspNowShim::current->sendCb = cb;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb) {
+    EspNowShim::current->recvCb = cb;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_now_add_peer(const esp_now_peer_info_t* peer) {
+    EspNowShim::Node* node = EspNowShim::current;
+    if (!node->initialized) return ESP_ERR_ESPNOW_NOT_INIT;
+    if (node->hasPeer(peer->peer_addr)) return ESP_ERR_ESPNOW_EXIST;
+    node->peers.push_back(std::vector<uint8_t>(peer->peer_addr, peer->peer_addr + ESP_NOW_ETH_ALEN));
+    return ESP_OK;
+}
+
+inline esp_err_t esp_now_send(const uint8_t* peer_addr, const uint8_t* data, size_t len) {
+    EspNowShim::Node* node = EspNowShim::current;
+    if (!node->initialized) return ESP_ERR_ESPNOW_NOT_INIT;
+    if (len == 0 || len > ESP_NOW_MAX_DATA_LEN) return ESP_ERR_ESPNOW_ARG;
+    if (!node->hasPeer(peer_addr)) return ESP_ERR_ESPNOW_NOT_FOUND;
+
+    EspNowShim::AirFrame frame;
+    frame.from = node;
+    memcpy(frame.to, peer_addr, ESP_NOW_ETH_ALEN);
+    frame.data.assign(data, data + len);
+    frame.deliverAtUs = micros() + EspNowShim::airLatencyUs;
+    EspNowShim::air.push_back(frame);
+    node->framesSent++;
+    return ESP_OK;
+}
+
+#endif
@@ -0,0 +1,88 @@
+// ============================================================================
+// Atrapa zadań FreeRTOS: zadania są tylko rejestrowane, opóźnienia przesuwają
+// wirtualny zegar nakładki Arduino
+// ============================================================================
+#ifndef FREERTOS_TASK_SHIM_H
+#define FREERTOS_TASK_SHIM_H
+
+#include "FreeRTOS.h"
+#include "../Arduino.h"
+#include <vector>
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define tskIDLE_PRIORITY ((UBaseType_t)0)
+#define tskNO_AFFINITY ((BaseType_t)0x7FFFFFFF)
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define portYIELD_FROM_ISR(...) ((void)0)
+
+namespace FreeRtosShim {
+    // Zadanie utworzone przez kod - test wywołuje jego krok samodzielnie
+    struct TaskRecord {
+        TaskFunction_t function;
+        const char* name;
+        void* param;
+        UBaseType_t priority;
+        BaseType_t core;
+    };
+
+    inline std::vector<TaskRecord> tasks;
+    inline std::vector<uint32_t> notifications; // Licznik powiadomień każdego zadania
+    inline TaskHandle_t currentTask = nullptr;  // Zadanie, którego krok wykonuje test
+
+    inline const TaskRecord* findTask(const char* name) {
+        for (const TaskRecord& task : tasks) {
+            if (strcmp(task.name, name) == 0) return &task;
+        }
+        return nullptr;
+    }
+
+    inline uint32_t& notification(TaskHandle_t task) {
+        size_t index = (uintptr_t)task;
+        if (notifications.size() <= index) notifications.resize(index + 1, 0);
+        return notifications[index];
+    }
+
+    inline void reset() {
+        tasks.clear();
+        notifications.clear();
+        currentTask = nullptr;
+    }
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t, void* param,
+                                          UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    FreeRtosShim::tasks.push_back({function, name, param, priority, core});
+    if (handle) *handle = (TaskHandle_t)(uintptr_t)FreeRtosShim::tasks.size(); // Numer zadania
+    return pdPASS;
+}
+
+inline TickType_t xTaskGetTickCount() { return (TickType_t)millis(); }
+
+inline void vTaskDelay(TickType_t ticks) { delay(ticks); }
+
+// Czeka do *previousWake + increment (bez czekania, jeśli ten moment już minął)
+inline void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment) {
+    *previousWake += increment;
+    TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(*previousWake - now) > 0) delay(*previousWake - now);
+}
+
+// Powiadomienia zadań: bez prawdziwego planisty oczekiwanie tylko przesuwa zegar
+inline void xTaskNotifyGive(TaskHandle_t task) { FreeRtosShim::notification(task)++; }
+
+inline void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken) {
+    FreeRtosShim::notification(task)++;
+    if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdTRUE;
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    uint32_t& value = FreeRtosShim::notification(FreeRtosShim::currentTask);
+    if (value == 0 && ticks != portMAX_DELAY) delay(ticks);
+    uint32_t taken = value;
+    if (taken) value = clearOnExit ? 0 : taken - 1;
+    return taken;
+}
+
+#endif
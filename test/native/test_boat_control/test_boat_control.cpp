@@ -0,0 +1,237 @@
+#include <unity.h>
+#include <vector>
+#include <BoatControl.h>
+#include <ControlMailbox.h>
+#include <LinkMonitor.h>
+
+// --- Parametry symulacji (jak w boat_driver.cpp, LINK_TIMEOUT_MS z BoatLink.h) ---
+const int UPDATE_INTERVAL = 80;
+const int SLEW_RATE = 125;                                   // Jednostek na sekundę
+const int SMOOTHING_STEP = SLEW_RATE * UPDATE_INTERVAL / 1000; // 10 na okres
+
+// Pakiet ESP-NOW odebrany w danej chwili symulacji
+struct TimedPacket {
+    unsigned long arrivalMs;
+    struct_message msg;
+};
+
+MotorMixerConfig controlConfig(int slewRate = SLEW_RATE) {
+    MotorMixerConfig config;
+    config.slewRate = slewRate;
+    config.periodMs = UPDATE_INTERVAL;
+    return config;
+}
+
+// --- Symulacja: odtwarza oś czasu pakietów względem pętli o stałym okresie ---
+// Zwraca prędkość silnika lewego po każdym okresie sterowania.
+// Z podanym monitorem łącza działa też watchdog (failsafe) jak w boat_driver.cpp
+std::vector<int> replay(const std::vector<TimedPacket>& timeline, int periods, LinkMonitor* monitor = nullptr) {
+    ControlMailbox<struct_message> mailbox;
+    BoatControl control(controlConfig());
+    std::vector<int> speeds;
+    size_t next = 0;
+
+    for (int period = 0; period < periods; period++) {
+        unsigned long now = (unsigned long)period * UPDATE_INTERVAL;
+        // Callback ESP-NOW: wszystkie pakiety, które dotarły przed tym okresem
+        while (next < timeline.size() && timeline[next].arrivalMs <= now) {
+            mailbox.push(timeline[next].msg);
+            if (monitor) monitor->notePacket(timeline[next].arrivalMs);
+            next++;
+        }
+        // Zadanie sterowania
+        struct_message msg;
+        if (mailbox.take(msg)) control.setCommand(msg);
+        if (monitor) control.setLinkLost(monitor->isLost(now));
+        speeds.push_back(control.step().currentSpeed1);
+    }
+    return speeds;
+}
+
+struct_message forward(uint8_t up) {
+    struct_message msg = {};
+    msg.up = up;
+    return msg;
+}
+
+// --- Unit tests ---
+void test_mailbox_returns_latest_value_once() {
+    ControlMailbox<struct_message> mailbox;
+    struct_message out;
+    TEST_ASSERT_FALSE(mailbox.take(out));
+
+    mailbox.push(forward(10));
+    mailbox.push(forward(20));
+    TEST_ASSERT_TRUE(mailbox.take(out));
+    TEST_ASSERT_EQUAL(20, out.up);
+    TEST_ASSERT_FALSE(mailbox.take(out));
+}
+
+void test_ramp_advances_without_new_packets() {
+    // Jeden pakiet, a rampa i tak dochodzi do celu w kolejnych okresach
+    std::vector<TimedPacket> timeline = {{0, forward(255)}};
+    std::vector<int> speeds = replay(timeline, 30);
+    TEST_ASSERT_EQUAL(10, speeds[0]);
+    TEST_ASSERT_EQUAL(250, speeds[24]);
+    TEST_ASSERT_EQUAL(255, speeds[25]);
+    TEST_ASSERT_EQUAL(255, speeds[29]);
+}
+
+void test_ramp_timing_independent_of_packet_jitter() {
+    // Ten sam sygnał wysyłany co 100 ms: raz równo, raz z dużym jitterem radia
+    std::vector<TimedPacket> steady, jittery;
+    const unsigned long jitter[] = {0, 70, 5, 90, 30, 0, 95, 10, 60, 40};
+    for (int i = 0; i < 30; i++) {
+        steady.push_back({(unsigned long)i * 100, forward(255)});
+        jittery.push_back({(unsigned long)i * 100 + jitter[i % 10], forward(255)});
+    }
+    // Pierwszy pakiet w obu przypadkach przychodzi przed pierwszym okresem
+    jittery[0].arrivalMs = 0;
+    TEST_ASSERT_EQUAL_INT_ARRAY(replay(steady, 40).data(), replay(jittery, 40).data(), 40);
+}
+
+void test_packet_burst_does_not_speed_up_ramp() {
+    // Seria pakietów w jednym okresie liczy się jak jedna komenda
+    std::vector<TimedPacket> burst;
+    for (int i = 0; i < 10; i++) burst.push_back({(unsigned long)i, forward(255)});
+    std::vector<int> speeds = replay(burst, 3);
+    TEST_ASSERT_EQUAL(SMOOTHING_STEP, speeds[0]);
+    TEST_ASSERT_EQUAL(2 * SMOOTHING_STEP, speeds[1]);
+    TEST_ASSERT_EQUAL(3 * SMOOTHING_STEP, speeds[2]);
+}
+
+void test_trigger_stops_immediately() {
+    struct_message stop = forward(255);
+    stop.trigger = true;
+    std::vector<TimedPacket> timeline = {{0, forward(255)}, {400, stop}};
+    std::vector<int> speeds = replay(timeline, 8);
+    TEST_ASSERT_EQUAL(50, speeds[4]);
+    TEST_ASSERT_EQUAL(0, speeds[5]);
+}
+
+void test_turn_mixing() {
+    BoatControl control(controlConfig(100000)); // Bez rampy
+    struct_message msg = {};
+    msg.up = 200;
+    msg.right = 100;
+    control.setCommand(msg);
+    MotorSpeeds speeds = control.step();
+    TEST_ASSERT_EQUAL(250, speeds.currentSpeed1);
+    TEST_ASSERT_EQUAL(150, speeds.currentSpeed2);
+}
+
+// Strumień tej samej komendy co periodMs w przedziale [fromMs, toMs)
+void appendStream(std::vector<TimedPacket>& timeline, unsigned long fromMs, unsigned long toMs,
+                  unsigned long periodMs, struct_message msg) {
+    for (unsigned long t = fromMs; t < toMs; t += periodMs) timeline.push_back({t, msg});
+}
+
+void test_watchdog_ramps_to_zero_after_timeout() {
+    // Pakiety co 100 ms do 1000 ms, potem cisza
+    LinkMonitor monitor(LINK_TIMEOUT_MS);
+    std::vector<TimedPacket> timeline;
+    appendStream(timeline, 0, 1000, 100, forward(100));
+    std::vector<int> speeds = replay(timeline, 40, &monitor);
+
+    // Ostatni pakiet w 900 ms, timeout mija po 1400 ms (okres 18 = 1440 ms)
+    TEST_ASSERT_EQUAL(100, speeds[17]);
+    TEST_ASSERT_EQUAL(100 - SMOOTHING_STEP, speeds[18]);
+    TEST_ASSERT_EQUAL(100 - 2 * SMOOTHING_STEP, speeds[19]);
+    TEST_ASSERT_EQUAL(0, speeds[27]);
+    TEST_ASSERT_EQUAL(0, speeds[39]);
+}
+
+void test_watchdog_tolerates_gaps_below_timeout() {
+    // Przerwy 450 ms (krótsze niż timeout) nie przerywają jazdy
+    LinkMonitor monitor(LINK_TIMEOUT_MS);
+    std::vector<TimedPacket> timeline;
+    appendStream(timeline, 0, 3000, 450, forward(255));
+    std::vector<int> speeds = replay(timeline, 37, &monitor);
+    for (int i = 1; i < 37; i++) TEST_ASSERT_GREATER_OR_EQUAL(speeds[i - 1], speeds[i]);
+    TEST_ASSERT_EQUAL(255, speeds[36]);
+}
+
+void test_watchdog_resumes_last_command_after_recovery() {
+    // Przerwa 1 s w środku strumienia, po niej znowu ta sama komenda
+    LinkMonitor monitor(LINK_TIMEOUT_MS);
+    std::vector<TimedPacket> timeline;
+    appendStream(timeline, 0, 1000, 100, forward(60));
+    appendStream(timeline, 2000, 4000, 100, forward(60));
+    std::vector<int> speeds = replay(timeline, 50, &monitor);
+
+    TEST_ASSERT_EQUAL(60, speeds[17]);
+    TEST_ASSERT_EQUAL(0, speeds[24]);                 // 1920 ms: zatrzymana
+    TEST_ASSERT_EQUAL(SMOOTHING_STEP, speeds[25]);    // 2000 ms: pakiet, rampa od zera
+    TEST_ASSERT_EQUAL(60, speeds[30]);
+}
+
+void test_watchdog_holds_motors_before_first_packet() {
+    LinkMonitor monitor(LINK_TIMEOUT_MS);
+    TEST_ASSERT_TRUE(monitor.isLost(0));
+    std::vector<TimedPacket> timeline = {{400, forward(255)}};
+    std::vector<int> speeds = replay(timeline, 8, &monitor);
+    TEST_ASSERT_EQUAL(0, speeds[4]);
+    TEST_ASSERT_EQUAL(SMOOTHING_STEP, speeds[5]);
+}
+
+void test_trigger_still_stops_immediately_during_failsafe() {
+    BoatControl control(controlConfig());
+    control.setCommand(forward(255));
+    for (int i = 0; i < 10; i++) control.step();
+    control.setLinkLost(true);
+    TEST_ASSERT_EQUAL(100 - SMOOTHING_STEP, control.step().currentSpeed1);
+
+    struct_message stop = forward(255);
+    stop.trigger = true;
+    control.setCommand(stop);
+    TEST_ASSERT_EQUAL(0, control.step().currentSpeed1);
+}
+
+void test_link_stats_histogram_rate_and_age() {
+    LinkMonitor monitor(LINK_TIMEOUT_MS);
+    LinkStats empty = monitor.stats(0);
+    TEST_ASSERT_EQUAL(0, empty.packets);
+    TEST_ASSERT_EQUAL(UINT32_MAX, empty.lastSeenAgeMs);
+
+    // 20 pakietów co 40 ms, następnie przerwy 150 ms, 700 ms i 1200 ms
+    uint32_t t = 0;
+    for (int i = 0; i < 20; i++, t += 40) monitor.notePacket(t);
+    t -= 40;
+    t += 150; monitor.notePacket(t);
+    t += 700; monitor.notePacket(t);
+    t += 1200; monitor.notePacket(t);
+
+    LinkStats stats = monitor.stats(t + 30);
+    TEST_ASSERT_EQUAL(23, stats.packets);
+    TEST_ASSERT_EQUAL(30, stats.lastSeenAgeMs);
+    TEST_ASSERT_EQUAL(1200, stats.longestGapMs);
+    const uint32_t histogram[LINK_GAP_BUCKETS] = {19, 0, 1, 0, 1, 1};
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(histogram, stats.gapHistogram, LINK_GAP_BUCKETS);
+
+    // Stały strumień 25 pakietów/s
+    LinkMonitor steady(LINK_TIMEOUT_MS);
+    for (t = 0; t <= 3000; t += 40) steady.notePacket(t);
+    TEST_ASSERT_EQUAL(25, steady.stats(3000).packetRate);
+    // Po długiej ciszy częstotliwość spada do zera
+    TEST_ASSERT_EQUAL(0, steady.stats(6000).packetRate);
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_mailbox_returns_latest_value_once);
+    RUN_TEST(test_ramp_advances_without_new_packets);
+    RUN_TEST(test_ramp_timing_independent_of_packet_jitter);
+    RUN_TEST(test_packet_burst_does_not_speed_up_ramp);
+    RUN_TEST(test_trigger_stops_immediately);
+    RUN_TEST(test_turn_mixing);
+    RUN_TEST(test_watchdog_ramps_to_zero_after_timeout);
+    RUN_TEST(test_watchdog_tolerates_gaps_below_timeout);
+    RUN_TEST(test_watchdog_resumes_last_command_after_recovery);
+    RUN_TEST(test_watchdog_holds_motors_before_first_packet);
+    RUN_TEST(test_trigger_still_stops_immediately_during_failsafe);
+    RUN_TEST(test_link_stats_histogram_rate_and_age);
+    return UNITY_END();
+}
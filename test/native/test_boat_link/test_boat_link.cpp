@@ -0,0 +1,434 @@
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <BoatLink.h>
+
+struct_message command(uint8_t up, bool trigger = false) {
+    struct_message msg = {};
+    msg.up = up;
+    msg.left = 7;
+    msg.trigger = trigger;
+    return msg;
+}
+
+// Ramka o zadanym numerze i znaczniku czasu, zdekodowana jak po stronie łodzi
+LinkFrame controlFrame(uint16_t seq, uint32_t timestampMs, uint8_t up = 100) {
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    LinkFrame frame;
+    linkDecode(buf, linkEncodeControl(buf, seq, timestampMs, command(up)), frame);
+    return frame;
+}
+
+LinkFrame keepaliveFrame(uint16_t seq, uint32_t timestampMs, uint16_t refSeq) {
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    LinkFrame frame;
+    linkDecode(buf, linkEncodeKeepalive(buf, seq, timestampMs, refSeq), frame);
+    return frame;
+}
+
+// --- Kodek ---
+void test_crc_matches_reference_vector() {
+    // Wektor kontrolny CRC-16/CCITT-FALSE
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, linkCrc16(check, sizeof(check)));
+}
+
+void test_control_round_trip() {
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    struct_message sent = command(200, true);
+    sent.down = 3;
+    sent.right = 250;
+    size_t len = linkEncodeControl(buf, 0xBEEF, 0x12345678, sent);
+    TEST_ASSERT_EQUAL(LINK_CONTROL_FRAME_SIZE, len);
+
+    LinkFrame frame;
+    TEST_ASSERT_EQUAL(LINK_OK, linkDecode(buf, len, frame));
+    TEST_ASSERT_EQUAL(LINK_FRAME_CONTROL, frame.type);
+    TEST_ASSERT_EQUAL_HEX16(0xBEEF, frame.seq);
+    TEST_ASSERT_EQUAL_HEX32(0x12345678, frame.timestampMs);
+    TEST_ASSERT_EQUAL_MEMORY(&sent, &frame.command, sizeof(struct_message));
+}
+
+void test_keepalive_round_trip() {
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    size_t len = linkEncodeKeepalive(buf, 42, 1000, 40);
+    TEST_ASSERT_EQUAL(LINK_KEEPALIVE_FRAME_SIZE, len);
+
+    LinkFrame frame;
+    TEST_ASSERT_EQUAL(LINK_OK, linkDecode(buf, len, frame));
+    TEST_ASSERT_EQUAL(LINK_FRAME_KEEPALIVE, frame.type);
+    TEST_ASSERT_EQUAL(42, frame.seq);
+    TEST_ASSERT_EQUAL(40, frame.refSeq);
+}
+
+void test_rejects_wrong_version_type_and_length() {
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    LinkFrame frame;
+    size_t len = linkEncodeControl(buf, 1, 0, command(10));
+
+    TEST_ASSERT_EQUAL(LINK_ERR_LENGTH, linkDecode(buf, len - 1, frame));
+    TEST_ASSERT_EQUAL(LINK_ERR_LENGTH, linkDecode(buf, len + 1, frame));
+    TEST_ASSERT_EQUAL(LINK_ERR_LENGTH, linkDecode(buf, 5, frame)); // Stary format bez nagłówka
+
+    buf[1] = 0x7F;
+    TEST_ASSERT_EQUAL(LINK_ERR_TYPE, linkDecode(buf, len, frame));
+    buf[0] = LINK_VERSION + 1;
+    TEST_ASSERT_EQUAL(LINK_ERR_VERSION, linkDecode(buf, len, frame));
+}
+
+void test_every_single_bit_flip_is_rejected() {
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    LinkFrame frame;
+    size_t len = linkEncodeControl(buf, 77, 5000, command(128));
+    for (size_t bit = 0; bit < len * 8; bit++) {
+        buf[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        TEST_ASSERT_NOT_EQUAL(LINK_OK, linkDecode(buf, len, frame));
+        buf[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+    }
+    TEST_ASSERT_EQUAL(LINK_OK, linkDecode(buf, len, frame));
+}
+
+void test_fuzz_random_frames() {
+    // Losowe bufory i losowe uszkodzenia poprawnych ramek nie mogą przejść jako poprawne
+    // (poza przypadkową zgodnością CRC, której oczekiwana częstość to 1/65536)
+    srand(1234);
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    LinkFrame frame;
+    int accepted = 0;
+    const int rounds = 200000;
+    for (int i = 0; i < rounds; i++) {
+        size_t len;
+        if (i % 2) {
+            len = (size_t)(rand() % (LINK_MAX_FRAME_SIZE + 1));
+            for (size_t j = 0; j < len; j++) buf[j] = (uint8_t)rand();
+            // Połowa z poprawnym nagłówkiem, żeby dojść do sprawdzenia CRC
+            if (len > 1 && (i & 2)) {
+                buf[0] = LINK_VERSION;
+                buf[1] = LINK_FRAME_CONTROL;
+                len = LINK_CONTROL_FRAME_SIZE;
+            }
+        } else {
+            len = linkEncodeControl(buf, (uint16_t)i, (uint32_t)i, command((uint8_t)i));
+            int flips = 2 + rand() % 6;
+            for (int f = 0; f < flips; f++) buf[rand() % len] ^= (uint8_t)(1 + rand() % 255);
+            if (linkCrc16(buf, len - LINK_CRC_SIZE) == linkGet16(buf + len - LINK_CRC_SIZE)) continue;
+        }
+        if (linkDecode(buf, len, frame) == LINK_OK) accepted++;
+    }
+    TEST_ASSERT_LESS_THAN(rounds / 4 / 65536 + 8, accepted);
+}
+
+void test_telemetry_round_trip() {
+    LinkTelemetry sent = LinkTelemetry();
+    sent.sampleCount = LINK_TELEMETRY_SAMPLES;
+    sent.flags = LINK_TELEMETRY_FAILSAFE;
+    sent.targetSpeed1 = -255;
+    sent.targetSpeed2 = 128;
+    for (uint8_t i = 0; i < LINK_TELEMETRY_SAMPLES; i++) {
+        sent.speed1[i] = (int16_t)(-10 * i);
+        sent.speed2[i] = (int16_t)(20 * i);
+    }
+    sent.loopBusyMaxUs = 350;
+    sent.loopPeriodMaxUs = 80120;
+    sent.accepted = 123456;
+    sent.dropped = 7;
+    sent.stale = 0xFFFFFFFF;
+    sent.batteryMv = 12480;
+
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    size_t len = linkEncodeTelemetry(buf, 9, 777, sent);
+    TEST_ASSERT_EQUAL(LINK_TELEMETRY_FRAME_SIZE, len);
+    TEST_ASSERT_LESS_OR_EQUAL(LINK_MAX_FRAME_SIZE, len);
+
+    LinkFrame frame;
+    TEST_ASSERT_EQUAL(LINK_OK, linkDecode(buf, len, frame));
+    TEST_ASSERT_EQUAL(LINK_FRAME_TELEMETRY, frame.type);
+    const LinkTelemetry& got = frame.telemetry;
+    TEST_ASSERT_EQUAL(LINK_TELEMETRY_SAMPLES, got.sampleCount);
+    TEST_ASSERT_EQUAL(LINK_TELEMETRY_FAILSAFE, got.flags);
+    TEST_ASSERT_EQUAL(-255, got.targetSpeed1);
+    TEST_ASSERT_EQUAL(128, got.targetSpeed2);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(sent.speed1, got.speed1, LINK_TELEMETRY_SAMPLES);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(sent.speed2, got.speed2, LINK_TELEMETRY_SAMPLES);
+    TEST_ASSERT_EQUAL(350, got.loopBusyMaxUs);
+    TEST_ASSERT_EQUAL_UINT32(80120, got.loopPeriodMaxUs);
+    TEST_ASSERT_EQUAL_UINT32(123456, got.accepted);
+    TEST_ASSERT_EQUAL_UINT32(7, got.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFF, got.stale);
+    TEST_ASSERT_EQUAL(12480, got.batteryMv);
+
+    // Uszkodzona liczba próbek nie wyprowadzi odczytu poza tablice
+    buf[LINK_HEADER_SIZE] = 200;
+    linkSeal(buf, len - LINK_CRC_SIZE);
+    TEST_ASSERT_EQUAL(LINK_OK, linkDecode(buf, len, frame));
+    TEST_ASSERT_EQUAL(LINK_TELEMETRY_SAMPLES, frame.telemetry.sampleCount);
+}
+
+void test_telemetry_batch_fills_once_per_batch() {
+    LinkTelemetryBatch batch;
+    int sent = 0;
+    for (int period = 0; period < 4 * LINK_TELEMETRY_SAMPLES; period++) {
+        uint32_t busy = period == 7 ? 900 : 100;
+        if (batch.add(period, -period, period * 2, -period * 2, busy, 80000 + period)) {
+            const LinkTelemetry& t = batch.telemetry();
+            TEST_ASSERT_EQUAL(LINK_TELEMETRY_SAMPLES, t.sampleCount);
+            TEST_ASSERT_EQUAL(period, t.targetSpeed1);
+            TEST_ASSERT_EQUAL((period - LINK_TELEMETRY_SAMPLES + 1) * 2, t.speed1[0]);
+            TEST_ASSERT_EQUAL(period * 2, t.speed1[LINK_TELEMETRY_SAMPLES - 1]);
+            TEST_ASSERT_EQUAL(period >= 7 && period < 7 + LINK_TELEMETRY_SAMPLES ? 900 : 100, t.loopBusyMaxUs);
+            TEST_ASSERT_EQUAL_UINT32(80000 + period, t.loopPeriodMaxUs);
+            sent++;
+        }
+    }
+    TEST_ASSERT_EQUAL(4, sent);
+
+    // Czas wykonania ponad zakres 16 bitów jest nasycany
+    LinkTelemetryBatch slow;
+    slow.add(0, 0, 0, 0, 100000, 200000);
+    TEST_ASSERT_EQUAL(0xFFFF, slow.telemetry().loopBusyMaxUs);
+    TEST_ASSERT_EQUAL_UINT32(200000, slow.telemetry().loopPeriodMaxUs);
+}
+
+// --- Nadawca ---
+void test_sender_suppresses_unchanged_commands() {
+    LinkSender sender(100, 500);
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    size_t controls = 0, keepalives = 0, silent = 0;
+
+    // Stała komenda próbkowana co 40 ms przez 1 s
+    for (uint32_t t = 0; t <= 1000; t += 40) {
+        size_t len = sender.encode(buf, command(50), t);
+        if (len == LINK_CONTROL_FRAME_SIZE) controls++;
+        else if (len == LINK_KEEPALIVE_FRAME_SIZE) keepalives++;
+        else silent++;
+    }
+    // Pełna ramka na starcie i przy odświeżeniu co 500 ms, poza tym KEEPALIVE co >=100 ms
+    TEST_ASSERT_EQUAL(2, controls);
+    TEST_ASSERT_EQUAL(8, keepalives);
+    TEST_ASSERT_EQUAL(16, silent);
+
+    // Zmiana komendy wychodzi od razu
+    TEST_ASSERT_EQUAL(LINK_CONTROL_FRAME_SIZE, sender.encode(buf, command(51), 1010));
+}
+
+void test_sender_keepalive_references_last_control() {
+    LinkSender sender(100, 500);
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    LinkFrame frame = LinkFrame();
+    sender.encode(buf, command(1), 0);
+    sender.encode(buf, command(2), 10);
+    TEST_ASSERT_EQUAL(LINK_OK, linkDecode(buf, sender.encode(buf, command(2), 110), frame));
+    TEST_ASSERT_EQUAL(LINK_FRAME_KEEPALIVE, frame.type);
+    TEST_ASSERT_EQUAL(2, frame.seq);
+    TEST_ASSERT_EQUAL(1, frame.refSeq);
+}
+
+// Domyślny nadawca powtarza pełną ramkę, zanim łódź uzna łącze za utracone
+void test_sender_refresh_is_shorter_than_link_timeout() {
+    LinkSender sender;
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    uint32_t lastControl = 0;
+    uint32_t longestGap = 0;
+
+    // Pętla wejścia co 40 ms, komenda bez zmian przez 3 s
+    for (uint32_t t = 0; t <= 3000; t += 40) {
+        if (sender.encode(buf, command(50), t) != LINK_CONTROL_FRAME_SIZE) continue;
+        if (t - lastControl > longestGap) longestGap = t - lastControl;
+        lastControl = t;
+    }
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LINK_REFRESH_MS + 40, longestGap);
+    TEST_ASSERT_LESS_THAN_UINT32(LINK_TIMEOUT_MS, 2 * longestGap); // Nawet po utracie jednej ramki
+}
+
+// --- Odbiorca ---
+// Sesja kontrolera: ramki CONTROL co 40 ms od numeru firstSeq i zegara senderMs
+// Zwraca czas odbiorcy po ostatniej ramce
+uint32_t runSession(LinkReceiver& receiver, uint16_t firstSeq, uint16_t count, uint32_t senderMs, uint32_t nowMs) {
+    for (uint16_t i = 0; i < count; i++) {
+        receiver.accept(controlFrame((uint16_t)(firstSeq + i), senderMs + i * 40u), nowMs + i * 40u);
+    }
+    return nowMs + count * 40u;
+}
+
+void test_receiver_counts_gaps_and_reordering() {
+    LinkReceiver receiver(200);
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(10, 0), 1000));
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(13, 30), 1030));
+    TEST_ASSERT_EQUAL(LINK_DUPLICATE, receiver.accept(controlFrame(12, 20), 1035));
+    TEST_ASSERT_EQUAL(LINK_DUPLICATE, receiver.accept(controlFrame(13, 30), 1036));
+
+    const LinkCounters& stats = receiver.stats();
+    TEST_ASSERT_EQUAL(2, stats.accepted);
+    TEST_ASSERT_EQUAL(2, stats.dropped);
+    TEST_ASSERT_EQUAL(2, stats.reordered);
+}
+
+void test_receiver_handles_sequence_wraparound() {
+    LinkReceiver receiver(200);
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(0xFFFF, 0), 0));
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(0x0000, 10), 10));
+    TEST_ASSERT_EQUAL(0, receiver.stats().dropped);
+}
+
+void test_receiver_rejects_stale_frames() {
+    LinkReceiver receiver(200);
+    // Zegar nadawcy przesunięty o 5000 ms nie ma znaczenia, liczy się tylko zmiana różnicy
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(1, 5000), 10));
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(2, 5100), 150));
+    TEST_ASSERT_EQUAL(LINK_STALE, receiver.accept(controlFrame(3, 5200), 420));
+    TEST_ASSERT_EQUAL(1, receiver.stats().stale);
+}
+
+// Paczka zaległych ramek dostarczona naraz nie jest restartem nadawcy
+void test_receiver_rejects_late_burst_without_resync() {
+    LinkReceiver receiver(200);
+    uint32_t now = runSession(receiver, 1, 10, 1000, 1000);
+    for (uint16_t i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL(LINK_STALE, receiver.accept(controlFrame(11 + i, 1400 + i * 40u), now + 600 + i));
+    }
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(17, now + 640), now + 650));
+    TEST_ASSERT_EQUAL(0, receiver.stats().resyncs);
+}
+
+void test_receiver_detects_keepalive_for_lost_command() {
+    LinkReceiver receiver(200);
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(1, 0), 0));
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(keepaliveFrame(2, 100, 1), 100));
+    // Ramka CONTROL nr 3 zaginęła, KEEPALIVE nr 4 ją potwierdza
+    TEST_ASSERT_EQUAL(LINK_DESYNC, receiver.accept(keepaliveFrame(4, 200, 3), 200));
+    TEST_ASSERT_EQUAL(1, receiver.stats().desynced);
+    // Odświeżenie pełnej komendy przywraca synchronizację
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(5, 300), 300));
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(keepaliveFrame(6, 400, 5), 400));
+}
+
+void test_receiver_resyncs_after_sender_restart() {
+    LinkReceiver receiver(200);
+    for (uint16_t seq = 1000; seq < 1010; seq++) receiver.accept(controlFrame(seq, seq * 10), seq * 10);
+    // Kontroler zrestartował się: numeracja i zegar od zera
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(0, 0), 10200));
+    TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(1, 40), 10240));
+    TEST_ASSERT_EQUAL(1, receiver.stats().resyncs);
+}
+
+// Po restarcie kontrolera (numeracja od zera, zegar od startu) liczy ramki do pierwszej przyjętej
+// i sprawdza, że kolejne są przyjmowane
+uint16_t framesUntilResync(LinkReceiver& receiver, uint32_t nowMs) {
+    const uint32_t bootMs = 300;
+    uint16_t seq = 0;
+    while (seq < 200 && receiver.accept(controlFrame(seq, bootMs + seq * 40u), nowMs + seq * 40u) != LINK_ACCEPTED) seq++;
+    for (uint16_t i = seq + 1; i < seq + 50; i++) {
+        TEST_ASSERT_EQUAL(LINK_ACCEPTED, receiver.accept(controlFrame(i, bootMs + i * 40u), nowMs + i * 40u));
+    }
+    return seq;
+}
+
+// Restart tuż po starcie: nowe numery trafiają w okno zmiany kolejności
+void test_receiver_resyncs_after_restart_with_low_sequence() {
+    LinkReceiver receiver(200);
+    uint32_t now = runSession(receiver, 0, 31, 300, 5000); // Ostatni numer 30 < REORDER_WINDOW
+    TEST_ASSERT_LESS_OR_EQUAL_UINT16(8, framesUntilResync(receiver, now + 500));
+    TEST_ASSERT_EQUAL(1, receiver.stats().resyncs);
+}
+
+// Restart po ponad 11 min przy 50 Hz: skok numeru wstecz wygląda jak luka do przodu
+void test_receiver_resyncs_after_restart_with_high_sequence() {
+    LinkReceiver receiver(200);
+    uint32_t now = runSession(receiver, 39970, 31, 1600000, 1700000); // Ostatni numer 40000 > 32767
+    TEST_ASSERT_LESS_OR_EQUAL_UINT16(8, framesUntilResync(receiver, now + 500));
+    TEST_ASSERT_EQUAL(1, receiver.stats().resyncs);
+}
+
+// Zegar odbiorcy szybszy o 40 ppm: przez 3 h przy ramkach co 20 ms nic nie jest spóźnione
+void test_receiver_tracks_clock_drift() {
+    LinkReceiver receiver(200);
+    uint32_t latencySeed = 1;
+    const uint32_t frames = 3 * 3600 * 50;
+    for (uint32_t i = 0; i < frames; i++) {
+        uint32_t senderMs = i * 20;
+        latencySeed = latencySeed * 1103515245u + 12345u;
+        uint32_t latencyMs = 2 + (latencySeed >> 16) % 30; // Opóźnienie radia 2-31 ms
+        uint32_t nowMs = senderMs + (uint32_t)((uint64_t)senderMs * 40 / 1000000) + latencyMs;
+        if (receiver.accept(controlFrame((uint16_t)i, senderMs), nowMs) != LINK_ACCEPTED) {
+            TEST_FAIL_MESSAGE("Frame rejected under clock drift");
+        }
+    }
+    TEST_ASSERT_EQUAL(0, receiver.stats().stale);
+}
+
+// --- Benchmark ---
+void test_codec_throughput() {
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    LinkFrame frame;
+    const uint32_t frames = 2000000;
+    uint32_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frames; i++) {
+        size_t len = linkEncodeControl(buf, (uint16_t)i, i, command((uint8_t)i));
+        if (linkDecode(buf, len, frame) == LINK_OK) checksum += frame.command.up;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    char message[128];
+    snprintf(message, sizeof(message), "encode+decode: %.1f Mframes/s (%.1f ns/ramke), checksum %u",
+             frames / seconds / 1e6, seconds * 1e9 / frames, (unsigned)checksum);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_NOT_EQUAL(0, checksum);
+}
+
+void test_telemetry_encoder_throughput() {
+    uint8_t buf[LINK_MAX_FRAME_SIZE];
+    LinkTelemetryBatch batch;
+    const uint32_t frames = 1000000;
+    uint32_t checksum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frames; i++) {
+        for (uint8_t s = 0; s < LINK_TELEMETRY_SAMPLES; s++) batch.add(i, -(int)i, s, -s, 250 + s, 80000);
+        LinkTelemetry& telemetry = batch.telemetry();
+        telemetry.batteryMv = (uint16_t)i;
+        size_t len = linkEncodeTelemetry(buf, (uint16_t)i, i, telemetry);
+        checksum += buf[len - 1];
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    char message[128];
+    snprintf(message, sizeof(message), "telemetria (%u okresow + kodowanie): %.1f ns/ramke, %u B, checksum %u",
+             (unsigned)LINK_TELEMETRY_SAMPLES, seconds * 1e9 / frames, (unsigned)LINK_TELEMETRY_FRAME_SIZE,
+             (unsigned)checksum);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_NOT_EQUAL(0, checksum);
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_crc_matches_reference_vector);
+    RUN_TEST(test_control_round_trip);
+    RUN_TEST(test_keepalive_round_trip);
+    RUN_TEST(test_rejects_wrong_version_type_and_length);
+    RUN_TEST(test_every_single_bit_flip_is_rejected);
+    RUN_TEST(test_fuzz_random_frames);
+    RUN_TEST(test_telemetry_round_trip);
+    RUN_TEST(test_telemetry_batch_fills_once_per_batch);
+    RUN_TEST(test_sender_suppresses_unchanged_commands);
+    RUN_TEST(test_sender_keepalive_references_last_control);
+    RUN_TEST(test_sender_refresh_is_shorter_than_link_timeout);
+    RUN_TEST(test_receiver_counts_gaps_and_reordering);
+    RUN_TEST(test_receiver_handles_sequence_wraparound);
+    RUN_TEST(test_receiver_rejects_stale_frames);
+    RUN_TEST(test_receiver_rejects_late_burst_without_resync);
+    RUN_TEST(test_receiver_detects_keepalive_for_lost_command);
+    RUN_TEST(test_receiver_resyncs_after_sender_restart);
+    RUN_TEST(test_receiver_resyncs_after_restart_with_low_sequence);
+    RUN_TEST(test_receiver_resyncs_after_restart_with_high_sequence);
+    RUN_TEST(test_receiver_tracks_clock_drift);
+    RUN_TEST(test_codec_throughput);
+    RUN_TEST(test_telemetry_encoder_throughput);
+    return UNITY_END();
+}
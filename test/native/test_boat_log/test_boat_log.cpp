@@ -0,0 +1,222 @@
+// Poziom ustawiony wyżej niż domyślny, aby sprawdzić usuwanie wyłączonych poziomów
+#define BOAT_LOG_LEVEL BOAT_LOG_LEVEL_WARN
+
+#include <unity.h>
+#include <Arduino.h>
+#include <BoatLog.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Wyjście z ograniczonym miejscem w nadajniku (jak FIFO UART)
+class CapturePrint : public Print {
+public:
+    size_t write(uint8_t c) override {
+        text += (char)c;
+        space--;
+        return 1;
+    }
+    int availableForWrite() override { return space; }
+    using Print::write;
+
+    std::string text;
+    int space = 0;
+};
+
+// Opróżnienie wspólnego bufora między testami
+static void drainGlobal() {
+    CapturePrint sink;
+    sink.space = 1 << 20;
+    boatLogFlush(sink);
+}
+
+// --- LogRing ---
+void test_ring_keeps_order_and_levels_across_wraparound() {
+    LogRing<64> ring;
+    char out[LogRing<64>::MAX_MESSAGE + 1];
+    uint8_t level = 0;
+    TEST_ASSERT_EQUAL(-1, ring.pop(out, level));
+
+    // 12 bajtów na rekord: zapis wielokrotnie zawija się w 64-bajtowym buforze
+    for (int i = 0; i < 20; i++) {
+        char text[16];
+        int len = snprintf(text, sizeof(text), "msg-%05d", i);
+        TEST_ASSERT_TRUE(ring.push(i % BOAT_LOG_LEVEL_COUNT, text, len));
+        TEST_ASSERT_EQUAL(len, ring.peekLength());
+        TEST_ASSERT_EQUAL(len, ring.pop(out, level));
+        TEST_ASSERT_EQUAL_STRING(text, out);
+        TEST_ASSERT_EQUAL(i % BOAT_LOG_LEVEL_COUNT, level);
+    }
+    TEST_ASSERT_EQUAL(0, ring.droppedTotal());
+}
+
+void test_ring_drops_when_full_and_counts_per_level() {
+    LogRing<64> ring;
+    char out[LogRing<64>::MAX_MESSAGE + 1];
+    uint8_t level = 0;
+    const char text[] = "0123456789abcdef"; // 18 bajtów z nagłówkiem
+
+    TEST_ASSERT_TRUE(ring.push(BOAT_LOG_LEVEL_INFO, text, 16));
+    TEST_ASSERT_TRUE(ring.push(BOAT_LOG_LEVEL_INFO, text, 16));
+    TEST_ASSERT_TRUE(ring.push(BOAT_LOG_LEVEL_INFO, text, 16));
+    TEST_ASSERT_FALSE(ring.push(BOAT_LOG_LEVEL_WARN, text, 16));
+    TEST_ASSERT_FALSE(ring.push(BOAT_LOG_LEVEL_ERROR, text, 16));
+    TEST_ASSERT_TRUE(ring.push(BOAT_LOG_LEVEL_ERROR, "x", 1)); // Drobny komunikat jeszcze się mieści
+    TEST_ASSERT_EQUAL(1, ring.dropped(BOAT_LOG_LEVEL_WARN));
+    TEST_ASSERT_EQUAL(1, ring.dropped(BOAT_LOG_LEVEL_ERROR));
+    TEST_ASSERT_EQUAL(2, ring.droppedTotal());
+
+    // Odczyt zwalnia miejsce
+    TEST_ASSERT_EQUAL(16, ring.pop(out, level));
+    TEST_ASSERT_TRUE(ring.push(BOAT_LOG_LEVEL_WARN, text, 16));
+}
+
+void test_ring_truncates_long_messages() {
+    LogRing<1024> ring;
+    char out[LogRing<1024>::MAX_MESSAGE + 1];
+    uint8_t level = 0;
+    std::string text(400, 'a');
+    TEST_ASSERT_TRUE(ring.push(BOAT_LOG_LEVEL_ERROR, text.c_str(), text.size()));
+    TEST_ASSERT_EQUAL(LogRing<1024>::MAX_MESSAGE, ring.pop(out, level));
+}
+
+void test_ring_concurrent_producers_never_block_or_corrupt() {
+    static LogRing<4096> ring;
+    const int producers = 4, perProducer = 20000;
+    std::atomic<int> accepted(0);
+    std::atomic<bool> done(false);
+    int received = 0, corrupted = 0;
+
+    std::thread consumer([&] {
+        char out[LogRing<4096>::MAX_MESSAGE + 1];
+        uint8_t level;
+        for (;;) {
+            bool finished = done.load();
+            int len;
+            while ((len = ring.pop(out, level)) >= 0) {
+                int p, i;
+                if (sscanf(out, "p%d-%d", &p, &i) != 2 || level != (uint8_t)(p % BOAT_LOG_LEVEL_COUNT)) corrupted++;
+                received++;
+            }
+            if (finished) break;
+            std::this_thread::yield();
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            char text[32];
+            for (int i = 0; i < perProducer; i++) {
+                int len = snprintf(text, sizeof(text), "p%d-%d", p, i);
+                if (ring.push(p % BOAT_LOG_LEVEL_COUNT, text, len)) accepted++;
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    done = true;
+    consumer.join();
+
+    TEST_ASSERT_EQUAL(0, corrupted);
+    TEST_ASSERT_EQUAL(accepted.load(), received);
+    TEST_ASSERT_EQUAL(producers * perProducer, accepted.load() + (int)ring.droppedTotal());
+}
+
+// --- Makra i opróżnianie ---
+static int sideEffects = 0;
+static int sideEffect() { return ++sideEffects; }
+
+// Parametr użyty tylko w wyłączonym makrze nie może dawać -Wunused-parameter
+static void traceOnly(int value) { BOAT_LOG_TRACE("value %d", value); }
+
+void test_disabled_levels_compile_to_nothing() {
+    drainGlobal();
+    sideEffects = 0;
+    BOAT_LOG_TRACE("trace %d", sideEffect());
+    BOAT_LOG_INFO("info %d", sideEffect());
+    traceOnly(1);
+    TEST_ASSERT_EQUAL(0, sideEffects);
+    TEST_ASSERT_EQUAL(-1, boatLogRing.peekLength());
+
+    BOAT_LOG_WARN("warn %d", sideEffect());
+    BOAT_LOG_ERROR("error %d", sideEffect());
+    TEST_ASSERT_EQUAL(2, sideEffects);
+
+    CapturePrint sink;
+    sink.space = 1000;
+    TEST_ASSERT_EQUAL(2, boatLogFlush(sink));
+    TEST_ASSERT_EQUAL_STRING("[W] warn 1\r\n[E] error 2\r\n", sink.text.c_str());
+}
+
+void test_flush_only_writes_what_fits_in_transmitter() {
+    drainGlobal();
+    BOAT_LOG_WARN("first");   // 11 bajtów z prefiksem i CRLF
+    BOAT_LOG_WARN("second");  // 12 bajtów
+
+    CapturePrint sink;
+    sink.space = 15;
+    TEST_ASSERT_EQUAL(1, boatLogFlush(sink));
+    TEST_ASSERT_EQUAL_STRING("[W] first\r\n", sink.text.c_str());
+    TEST_ASSERT_EQUAL(0, boatLogFlush(sink)); // Zostały 4 bajty - nic nie wypisano, nic nie zgubiono
+
+    sink.space = 12;
+    TEST_ASSERT_EQUAL(1, boatLogFlush(sink));
+    TEST_ASSERT_EQUAL_STRING("[W] first\r\n[W] second\r\n", sink.text.c_str());
+}
+
+void test_flush_reports_dropped_messages_once() {
+    drainGlobal();
+    int attempts = 0;
+    while (boatLogRing.dropped(BOAT_LOG_LEVEL_ERROR) == 0) {
+        BOAT_LOG_ERROR("flood %04d ........................................", attempts++);
+    }
+
+    CapturePrint sink;
+    sink.space = 1 << 20;
+    boatLogFlush(sink);
+    TEST_ASSERT_EQUAL(0, sink.text.find("[W] log: pominieto 1 komunikatow (T/I/W/E: 0/0/0/1)\r\n"));
+
+    sink.text.clear();
+    BOAT_LOG_WARN("after");
+    boatLogFlush(sink);
+    TEST_ASSERT_EQUAL_STRING("[W] after\r\n", sink.text.c_str());
+}
+
+// --- Benchmark ---
+void test_log_call_cost() {
+    drainGlobal();
+    CapturePrint sink;
+    const int calls = 200000;
+    double totalNs = 0;
+    for (int batch = 0; batch < calls / 50; batch++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 50; i++) BOAT_LOG_WARN("targetSpeed1: %d, currentSpeed1: %d", i, batch);
+        totalNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        sink.text.clear();
+        sink.space = 1 << 20;
+        boatLogFlush(sink);
+    }
+
+    char message[128];
+    // Dla porównania: ta sama linia (ok. 40 znaków) przy 115200 bodów blokuje UART ok. 3.5 ms
+    snprintf(message, sizeof(message), "BOAT_LOG_WARN: %.0f ns/wywolanie", totalNs / calls);
+    TEST_MESSAGE(message);
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_keeps_order_and_levels_across_wraparound);
+    RUN_TEST(test_ring_drops_when_full_and_counts_per_level);
+    RUN_TEST(test_ring_truncates_long_messages);
+    RUN_TEST(test_ring_concurrent_producers_never_block_or_corrupt);
+    RUN_TEST(test_disabled_levels_compile_to_nothing);
+    RUN_TEST(test_flush_only_writes_what_fits_in_transmitter);
+    RUN_TEST(test_flush_reports_dropped_messages_once);
+    RUN_TEST(test_log_call_cost);
+    return UNITY_END();
+}
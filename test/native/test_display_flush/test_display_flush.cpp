@@ -0,0 +1,831 @@
+#include <unity.h>
+#include <chrono>
+#include <vector>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <DisplayFlush.h>
+#include <ui.h>
+#include "src/display/lv_display_private.h"
+
+// Ekran i bufory jak w controller_driver.cpp
+static const int32_t SCREEN_WIDTH = 320;
+static const int32_t SCREEN_HEIGHT = 240;
+static const uint32_t BUFFER_PIXELS = SCREEN_WIDTH * SCREEN_HEIGHT / 10;
+static const uint32_t SPI_HZ = 40000000;     // Zegar SPI ekranu na ESP32 (80 MHz / 2)
+static const uint32_t ESP32_SLOWDOWN = 40;   // Szacunkowo: rysowanie na ESP32 vs na komputerze
+
+static uint16_t buffer1[BUFFER_PIXELS];
+static uint16_t buffer2[BUFFER_PIXELS];
+
+TFT_eSPI* tft;
+DisplayFlush* flush;
+lv_display_t* display;
+
+static uint32_t my_tick_get_cb() { return millis(); }
+
+// --- Symulacja czasu: rysowanie mierzone na komputerze, transfer z zegara SPI ---
+struct FrameStats {
+    unsigned long frameUs;
+    unsigned long renderUs;
+    unsigned long busUs;
+    unsigned long swapUs;    // Zamiana bajtów poza rysowaniem (flush_cb lub pushColors)
+    uint32_t stripes;
+    uint32_t overlapped;     // Paski gotowe, zanim poprzedni skończył się przesyłać
+    uint32_t bufferHazards;  // Paski narysowane w buforze czytanym przez DMA
+    uint32_t earlyReady;     // flush_cb zakończone z flushing = 0 przed końcem DMA
+};
+
+static FrameStats stats;
+static bool rendering = false;
+static std::chrono::steady_clock::time_point renderStart;
+
+// Czas na ESP32 odpowiadający czasowi zmierzonemu od start na komputerze
+static unsigned long esp32MicrosSince(std::chrono::steady_clock::time_point start) {
+    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+    return (unsigned long)(elapsed.count() * ESP32_SLOWDOWN / 1000);
+}
+
+// Dolicza czas rysowania od poprzedniego punktu do wirtualnego zegara
+static void finishRendering() {
+    if (!rendering) return;
+    rendering = false;
+    unsigned long us = esp32MicrosSince(renderStart);
+    stats.renderUs += us;
+    ArduinoShim::advanceMicros(us);
+}
+
+static void timingEvent(lv_event_t* e) {
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_REFR_START:
+            rendering = true;
+            renderStart = std::chrono::steady_clock::now();
+            break;
+        case LV_EVENT_FLUSH_WAIT_START:
+            finishRendering();
+            if (tft->dmaBusy()) {
+                stats.overlapped++;
+                if (tft->dmaBuffer == (const uint16_t*)lv_display_get_buf_active(display)->data) stats.bufferHazards++;
+            }
+            break;
+        case LV_EVENT_FLUSH_WAIT_FINISH:
+            rendering = true;
+            renderStart = std::chrono::steady_clock::now();
+            break;
+        case LV_EVENT_FLUSH_START:
+            finishRendering();
+            stats.stripes++;
+            break;
+        case LV_EVENT_FLUSH_FINISH:
+            if (tft->dmaBuffer && !display->flushing) stats.earlyReady++;
+            rendering = true;
+            renderStart = std::chrono::steady_clock::now();
+            break;
+        case LV_EVENT_REFR_READY:
+            finishRendering();
+            break;
+        default:
+            break;
+    }
+}
+
+// Ścieżki wysyłki porównywane w benchmarku
+enum FlushPath {
+    BLOCKING_SWAP,    // Jeden bufor, pushColors() zamienia bajty podczas wysyłki
+    DMA_FLUSH_SWAP,   // Dwa bufory i DMA, lv_draw_sw_rgb565_swap() w flush_cb
+    DMA_RENDER_SWAP   // Dwa bufory i DMA, LVGL rysuje od razu big-endian (DisplayFlush)
+};
+
+// Pierwsza implementacja: jeden bufor, wysyłka blokująca
+static void blocking_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* pixelmap) {
+    uint32_t width = area->x2 - area->x1 + 1;
+    uint32_t height = area->y2 - area->y1 + 1;
+    tft->startWrite();
+    tft->setAddrWindow(area->x1, area->y1, width, height);
+    tft->pushColors((uint16_t*)pixelmap, width * height, true);
+    tft->endWrite();
+    lv_display_flush_ready(disp);
+}
+
+// Poprzednia implementacja DisplayFlush: zamiana bajtów całego paska przed DMA
+static void swapping_dma_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* pixelmap) {
+    LV_UNUSED(disp);
+    uint32_t width = area->x2 - area->x1 + 1;
+    uint32_t height = area->y2 - area->y1 + 1;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    lv_draw_sw_rgb565_swap(pixelmap, width * height);
+    unsigned long us = esp32MicrosSince(start);
+    stats.swapUs += us;
+    ArduinoShim::advanceMicros(us);
+    tft->pushImageDMA(area->x1, area->y1, width, height, (uint16_t*)pixelmap);
+}
+
+// Koszt zamiany bajtów jednego piksela na ESP32 (dla pushColors z swap = true)
+static double swapNsPerPixel() {
+    static double ns = 0;
+    if (ns == 0) {
+        const int rounds = 200;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) lv_draw_sw_rgb565_swap(buffer1, BUFFER_PIXELS);
+        std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+        ns = (double)elapsed.count() * ESP32_SLOWDOWN / rounds / BUFFER_PIXELS;
+    }
+    return ns;
+}
+
+static void createDisplay(FlushPath path) {
+    tft = new TFT_eSPI(SCREEN_WIDTH, SCREEN_HEIGHT);
+    tft->spiHz = SPI_HZ;
+    tft->swapNsPerPixel = swapNsPerPixel();
+    flush = new DisplayFlush(*tft);
+    display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (path == BLOCKING_SWAP) {
+        lv_display_set_buffers(display, buffer1, nullptr, sizeof(buffer1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(display, blocking_flush);
+    } else {
+        TEST_ASSERT_TRUE(flush->begin(display, buffer1, buffer2, sizeof(buffer1)));
+        if (path == DMA_FLUSH_SWAP) {
+            // Ten sam rozmiar piksela, więc bufory pozostają ważne
+            lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565);
+            lv_display_set_flush_cb(display, swapping_dma_flush);
+        }
+    }
+    lv_display_add_event_cb(display, timingEvent, LV_EVENT_ALL, nullptr);
+    ui_init();
+    lv_screen_load(ui_Menu);
+    lv_refr_now(display);
+}
+
+// Pełne odświeżenie ekranu frames razy; klatka kończy się wraz z ostatnim transferem
+static FrameStats refreshFrames(int frames) {
+    tft->busUs = 0;
+    tft->swappedUs = 0;
+    stats = FrameStats();
+    for (int i = 0; i < frames; i++) {
+        unsigned long startUs = micros();
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(display);
+        tft->dmaWait();
+        stats.frameUs += micros() - startUs;
+    }
+    stats.busUs = tft->busUs;
+    stats.swapUs += tft->swappedUs;
+    return stats;
+}
+
+void setUp() {}
+
+void tearDown() {
+    if (display) lv_display_delete(display);
+    delete flush;
+    delete tft;
+    display = nullptr;
+    flush = nullptr;
+    tft = nullptr;
+}
+
+// --- Poprawność ---
+void test_full_refresh_sends_every_pixel_once() {
+    createDisplay(DMA_RENDER_SWAP);
+    tft->dmaWait();
+    tft->pixelsPushed = 0;
+    uint32_t flushesBefore = flush->flushes();
+    uint32_t transfersBefore = tft->dmaTransfers;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(display);
+    TEST_ASSERT_EQUAL_UINT32(SCREEN_WIDTH * SCREEN_HEIGHT, tft->pixelsPushed);
+    TEST_ASSERT_EQUAL_UINT32(10, flush->flushes() - flushesBefore);
+    TEST_ASSERT_EQUAL_UINT32(10, tft->dmaTransfers - transfersBefore);
+
+    // Ostatni pasek wysyła się już po powrocie z odświeżania
+    TEST_ASSERT_TRUE(tft->dmaBusy());
+    TEST_ASSERT_EQUAL(1, display->flushing);
+    ArduinoShim::advanceMicros(tft->transferMicros(BUFFER_PIXELS));
+    TEST_ASSERT_FALSE(tft->dmaBusy());
+    TEST_ASSERT_EQUAL(0, display->flushing);
+}
+
+void test_flush_ready_comes_from_dma_completion() {
+    createDisplay(DMA_RENDER_SWAP);
+    refreshFrames(2);
+    // flush_cb wraca z trwającym transferem, flushing zeruje dopiero koniec DMA
+    TEST_ASSERT_EQUAL_UINT32(0, stats.earlyReady);
+    TEST_ASSERT_GREATER_THAN(0, stats.overlapped);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.bufferHazards);
+}
+
+void test_pixels_are_sent_big_endian() {
+    createDisplay(DMA_RENDER_SWAP);
+    lv_obj_t* screen = lv_obj_create(nullptr);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(0xFF0000), LV_PART_MAIN);
+    lv_screen_load(screen);
+    refreshFrames(1);
+    TEST_ASSERT_EQUAL_HEX16(0x00F8, tft->firstPixel); // 0xF800 z zamienionymi bajtami
+    TEST_ASSERT_FALSE(tft->swapBytes);
+}
+
+void test_pixels_are_rendered_big_endian() {
+    createDisplay(DMA_RENDER_SWAP);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565_SWAPPED, lv_display_get_color_format(display));
+    lv_obj_t* screen = lv_obj_create(nullptr);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(0x0000FF), LV_PART_MAIN);
+    lv_screen_load(screen);
+    lv_obj_invalidate(screen);
+    lv_refr_now(display);
+    // Bufor trafia do DMA dokładnie tak, jak go narysował LVGL
+    TEST_ASSERT_EQUAL_HEX16(0x1F00, tft->dmaBuffer[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x1F00, tft->firstPixel);
+}
+
+// Zmiana pasków prędkości: wąskie obszary mieszczą się w jednym pasku bufora
+void test_speed_bar_update_flushes_each_area_once() {
+    createDisplay(DMA_RENDER_SWAP);
+    lv_bar_set_value(ui_SpeedBarUp, 75, LV_ANIM_OFF);
+    lv_bar_set_value(ui_SpeedBarRight, 60, LV_ANIM_OFF);
+    lv_refr_now(display);
+    tft->dmaWait();
+
+    const lv_display_refr_stats_t* refr = lv_display_get_refr_stats(display);
+    TEST_ASSERT_GREATER_THAN(0, refr->area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(refr->area_cnt, refr->flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(refr->px_rendered, refr->px_flushed);
+    TEST_ASSERT_EQUAL_UINT32(refr->px_flushed * 2, refr->flush_bytes);
+
+    char message[160];
+    snprintf(message, sizeof(message),
+             "obszary %u -> %u, paski %u, piksele: uniewaznione %u, narysowane %u, wyslane %u (%u B, %.1f%% ekranu)",
+             (unsigned)refr->inv_area_cnt, (unsigned)refr->area_cnt, (unsigned)refr->flush_cnt,
+             (unsigned)refr->px_invalidated, (unsigned)refr->px_rendered, (unsigned)refr->px_flushed,
+             (unsigned)refr->flush_bytes, 100.0 * refr->px_flushed / (SCREEN_WIDTH * SCREEN_HEIGHT));
+    TEST_MESSAGE(message);
+}
+
+// --- Benchmark ---
+static void printStats(const char* name, const FrameStats& st, int frames) {
+    // Część czasu magistrali ukryta pod rysowaniem kolejnych pasków
+    double hidden = (double)st.renderUs + st.swapUs + st.busUs - st.frameUs;
+    char message[200];
+    snprintf(message, sizeof(message),
+             "%s ms/klatke: %.2f (rysowanie %.2f, zamiana bajtow %.2f, SPI %.2f, ukryte %.0f%% transferu)", name,
+             st.frameUs / 1000.0 / frames, st.renderUs / 1000.0 / frames, st.swapUs / 1000.0 / frames,
+             st.busUs / 1000.0 / frames, 100.0 * hidden / st.busUs);
+    TEST_MESSAGE(message);
+}
+
+void test_flush_paths_benchmark() {
+    const int frames = 20;
+    createDisplay(BLOCKING_SWAP);
+    FrameStats blocking = refreshFrames(frames);
+    tearDown();
+    createDisplay(DMA_FLUSH_SWAP);
+    FrameStats flushSwap = refreshFrames(frames);
+    tearDown();
+    createDisplay(DMA_RENDER_SWAP);
+    FrameStats renderSwap = refreshFrames(frames);
+
+    TEST_ASSERT_EQUAL_UINT32(blocking.stripes, flushSwap.stripes);
+    TEST_ASSERT_EQUAL_UINT32(blocking.stripes, renderSwap.stripes);
+    TEST_ASSERT_EQUAL_UINT32(0, flushSwap.bufferHazards);
+    TEST_ASSERT_EQUAL_UINT32(0, renderSwap.bufferHazards);
+    TEST_ASSERT_EQUAL_UINT32(0, renderSwap.swapUs);
+
+    char message[120];
+    snprintf(message, sizeof(message), "zamiana bajtow na ESP32 ~%.1f ns/piksel (x%u wzgledem komputera)",
+             swapNsPerPixel(), ESP32_SLOWDOWN);
+    TEST_MESSAGE(message);
+    printStats("pushColors(swap) 1 bufor", blocking, frames);
+    printStats("DMA + swap w flush_cb   ", flushSwap, frames);
+    printStats("DMA + RGB565_SWAPPED    ", renderSwap, frames);
+}
+
+// --- Łączenie obszarów: nagrane ślady unieważnień ---
+typedef std::vector<std::vector<lv_area_t>> InvalidationTrace;
+
+static InvalidationTrace* recording = nullptr;
+
+static void recordInvalidation(lv_event_t* e) {
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        if (!recording->back().empty()) recording->push_back(std::vector<lv_area_t>());
+    } else {
+        recording->back().push_back(*(lv_area_t*)lv_event_get_param(e));
+    }
+}
+
+// Menu jak w sterowniku: co 100 ms nowe położenie joysticka (animowane paski) i napięcie baterii
+static InvalidationTrace recordMenuTrace(uint32_t ms) {
+    InvalidationTrace trace(1);
+    recording = &trace;
+    lv_display_add_event_cb(display, recordInvalidation, LV_EVENT_INVALIDATE_AREA, nullptr);
+    lv_display_add_event_cb(display, recordInvalidation, LV_EVENT_REFR_START, nullptr);
+    lv_obj_t* bars[4] = {ui_SpeedBarUp, ui_SpeedBarDown, ui_SpeedBarLeft, ui_SpeedBarRight};
+    for (uint32_t t = 0; t < ms; t += 20) {
+        if (t % 100 == 0) {
+            for (lv_obj_t* bar : bars) lv_bar_set_value(bar, random(0, 101), LV_ANIM_ON);
+            lv_label_set_text_fmt(ui_BatteryText, "%d.%dV", 11 + (int)(t / 1000) % 2, (int)random(0, 10));
+        }
+        ArduinoShim::advanceMillis(20);
+        lv_timer_handler();
+        tft->dmaWait();
+    }
+    lv_display_remove_event_cb_with_user_data(display, recordInvalidation, nullptr);
+    if (trace.back().empty()) trace.pop_back();
+    recording = nullptr;
+    return trace;
+}
+
+// Rozrzucone małe znaczniki: więcej obszarów niż LV_INV_BUF_SIZE w jednej klatce
+static InvalidationTrace markerTrace(int frames) {
+    InvalidationTrace trace;
+    for (int f = 0; f < frames; f++) {
+        std::vector<lv_area_t> areas;
+        for (int i = 0; i < 48; i++) {
+            lv_area_t a;
+            a.x1 = (i % 8) * 40 + random(0, 24);
+            a.y1 = (i / 8) * 40 + random(0, 24);
+            a.x2 = a.x1 + 9;
+            a.y2 = a.y1 + 9;
+            areas.push_back(a);
+        }
+        trace.push_back(areas);
+    }
+    return trace;
+}
+
+struct ReplayStats {
+    FrameStats frame;
+    uint32_t invalidated;
+    uint32_t areas;
+    uint32_t flushes;
+    uint32_t pxRendered;
+};
+
+static ReplayStats replay(const InvalidationTrace& trace, uint32_t overheadPx) {
+    lv_display_set_area_overhead(display, overheadPx);
+    ReplayStats out = ReplayStats();
+    tft->busUs = 0;
+    stats = FrameStats();
+    for (const std::vector<lv_area_t>& areas : trace) {
+        unsigned long startUs = micros();
+        for (const lv_area_t& a : areas) _lv_inv_area(display, &a);
+        lv_refr_now(display);
+        tft->dmaWait();
+        stats.frameUs += micros() - startUs;
+        const lv_display_refr_stats_t* refr = lv_display_get_refr_stats(display);
+        out.invalidated += refr->inv_area_cnt;
+        out.areas += refr->area_cnt;
+        out.flushes += refr->flush_cnt;
+        out.pxRendered += refr->px_rendered;
+    }
+    stats.busUs = tft->busUs;
+    out.frame = stats;
+    return out;
+}
+
+static void printReplay(const char* name, uint32_t overheadPx, const ReplayStats& st, size_t frames) {
+    char message[200];
+    snprintf(message, sizeof(message),
+             "%s narzut %4u px: obszary %.1f -> %.1f, paski %.1f, piksele %.0f, ms/klatke %.2f (rysowanie %.2f, SPI %.2f)",
+             name, (unsigned)overheadPx, (double)st.invalidated / frames, (double)st.areas / frames,
+             (double)st.flushes / frames, (double)st.pxRendered / frames, st.frame.frameUs / 1000.0 / frames,
+             st.frame.renderUs / 1000.0 / frames, st.frame.busUs / 1000.0 / frames);
+    TEST_MESSAGE(message);
+}
+
+void test_area_overflow_keeps_clusters() {
+    createDisplay(DMA_RENDER_SWAP);
+    InvalidationTrace trace = markerTrace(1);
+    ReplayStats st = replay(trace, 1);
+    // Nadmiarowe obszary dołączają do najbliższych zamiast odświeżać cały ekran
+    TEST_ASSERT_EQUAL_UINT32(LV_INV_BUF_SIZE, st.invalidated);
+    TEST_ASSERT_LESS_THAN_UINT32(SCREEN_WIDTH * SCREEN_HEIGHT / 2, st.pxRendered);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(48 * 10 * 10, st.pxRendered);
+}
+
+void test_area_join_benchmark() {
+    createDisplay(DMA_RENDER_SWAP);
+    InvalidationTrace menu = recordMenuTrace(6000);
+    InvalidationTrace markers = markerTrace(60);
+    TEST_ASSERT_GREATER_THAN(0, menu.size());
+
+    const uint32_t overheads[] = {1, 500, 1000, 2000, 4000, 8000};
+    for (uint32_t overhead : overheads) printReplay("menu     ", overhead, replay(menu, overhead), menu.size());
+    for (uint32_t overhead : overheads) printReplay("znaczniki", overhead, replay(markers, overhead), markers.size());
+}
+
+// --- Obrócone paski: warstwa trzymana między odświeżeniami ---
+static uint32_t barDraws = 0;
+
+static void countBarDraw(lv_event_t* e) {
+    LV_UNUSED(e);
+    barDraws++;
+}
+
+static void setSpeedBarCache(bool en) {
+    lv_obj_t* bars[3] = {ui_SpeedBarUp, ui_SpeedBarDown, ui_SpeedBarLeft};
+    for (lv_obj_t* bar : bars) lv_obj_set_layer_cache(bar, en);
+    lv_refr_now(display);
+    tft->dmaWait();
+}
+
+void test_cached_speed_bar_is_drawn_only_on_change() {
+    createDisplay(DMA_RENDER_SWAP);
+    setSpeedBarCache(true);
+    lv_obj_add_event_cb(ui_SpeedBarUp, countBarDraw, LV_EVENT_DRAW_MAIN_BEGIN, nullptr);
+
+    // Pełne odświeżenie w 10 paskach bufora bez rysowania paska prędkości
+    barDraws = 0;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(display);
+    tft->dmaWait();
+    TEST_ASSERT_EQUAL_UINT32(0, barDraws);
+
+    lv_bar_set_value(ui_SpeedBarUp, 200, LV_ANIM_OFF);
+    lv_refr_now(display);
+    tft->dmaWait();
+    TEST_ASSERT_EQUAL_UINT32(1, barDraws);
+
+    // Bez pamięci podręcznej pasek rysuje się w każdym pasku bufora, który przecina
+    setSpeedBarCache(false);
+    barDraws = 0;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(display);
+    tft->dmaWait();
+    TEST_ASSERT_GREATER_THAN(1, barDraws);
+}
+
+// Czas obrotu paska 82x30 ARGB8888 o 90 stopni na ESP32 [ns/piksel]
+static double rotateNsPerPixel(bool interpolate) {
+    const int32_t w = 82;
+    const int32_t h = 30;
+    static uint32_t src[w * h];
+    static uint32_t dst[w * h];
+    for (int32_t i = 0; i < w * h; i++) src[i] = 0xFF000000 | (i * 2654435761u >> 8);
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.rotation = 900;
+    dsc.pivot.x = w / 2;
+    dsc.pivot.y = h / 2;
+    lv_area_t area;
+    _lv_image_buf_get_transformed_area(&area, w, h, dsc.rotation, dsc.scale_x, dsc.scale_y, &dsc.pivot);
+    area.x2 = area.x1 + h - 1;
+    area.y2 = area.y1 + w - 1;
+
+    const int rounds = 2000;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        if (interpolate) {
+            lv_draw_sw_transform(nullptr, &area, src, w, h, w * 4, &dsc, nullptr, LV_COLOR_FORMAT_ARGB8888, dst);
+        } else {
+            lv_draw_sw_rotate(src, dst, w, h, w * 4, h * 4, LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_ARGB8888);
+        }
+    }
+    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+    return (double)elapsed.count() * ESP32_SLOWDOWN / rounds / (w * h);
+}
+
+// Klatki menu: pełne odświeżenie ekranu (paski bez zmian) albo nowe wartości wszystkich pasków
+static FrameStats speedBarFrames(int frames, bool fullScreen) {
+    lv_obj_t* bars[4] = {ui_SpeedBarUp, ui_SpeedBarDown, ui_SpeedBarLeft, ui_SpeedBarRight};
+    tft->busUs = 0;
+    stats = FrameStats();
+    for (int i = 0; i < frames; i++) {
+        unsigned long startUs = micros();
+        if (fullScreen) {
+            lv_obj_invalidate(lv_screen_active());
+        } else {
+            for (int b = 0; b < 4; b++) lv_bar_set_value(bars[b], (i * 37 + b * 50) % 256, LV_ANIM_OFF);
+        }
+        lv_refr_now(display);
+        tft->dmaWait();
+        stats.frameUs += micros() - startUs;
+    }
+    stats.busUs = tft->busUs;
+    return stats;
+}
+
+void test_layer_cache_benchmark() {
+    const int frames = 20;
+    char message[120];
+    snprintf(message, sizeof(message), "obrot 90 stopni 82x30: interpolacja %.1f ns/piksel, kopiowanie %.1f ns/piksel",
+             rotateNsPerPixel(true), rotateNsPerPixel(false));
+    TEST_MESSAGE(message);
+
+    createDisplay(DMA_RENDER_SWAP);
+    FrameStats fullOff = speedBarFrames(frames, true);
+    FrameStats barsOff = speedBarFrames(frames, false);
+    setSpeedBarCache(true);
+    FrameStats fullOn = speedBarFrames(frames, true);
+    FrameStats barsOn = speedBarFrames(frames, false);
+
+    printStats("caly ekran, bez pamieci warstwy", fullOff, frames);
+    printStats("caly ekran, z pamiecia warstwy ", fullOn, frames);
+    printStats("paski, bez pamieci warstwy     ", barsOff, frames);
+    printStats("paski, z pamiecia warstwy      ", barsOn, frames);
+}
+
+// --- Gradienty: mapy kolorów z pamięci podręcznej ---
+void test_menu_gradients_are_cached() {
+    createDisplay(DMA_RENDER_SWAP);
+    lv_gradient_cache_stats_t before;
+    lv_gradient_cache_get_stats(&before);
+    refreshFrames(3);
+    lv_gradient_cache_stats_t after;
+    lv_gradient_cache_get_stats(&after);
+
+    // Po pierwszej klatce każdy gradient menu jest już w pamięci
+    TEST_ASSERT_EQUAL_UINT32(before.miss_cnt, after.miss_cnt);
+    TEST_ASSERT_GREATER_THAN(before.hit_cnt, after.hit_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(after.max_size, after.size);
+}
+
+void test_gradient_cache_benchmark() {
+    const int frames = 20;
+    createDisplay(DMA_RENDER_SWAP);
+
+    // Rozmiar 0: nic się nie mieści, każdy gradient liczony od nowa jak wcześniej
+    lv_gradient_cache_resize(0);
+    FrameStats off = refreshFrames(frames);
+
+    lv_gradient_cache_resize(LV_DRAW_SW_GRADIENT_CACHE_SIZE);
+    refreshFrames(1);
+    lv_gradient_cache_stats_t before;
+    lv_gradient_cache_get_stats(&before);
+    FrameStats on = refreshFrames(frames);
+    lv_gradient_cache_stats_t after;
+    lv_gradient_cache_get_stats(&after);
+
+    char message[160];
+    snprintf(message, sizeof(message), "gradienty na klatke: trafienia %.1f, przeliczenia %.1f, pamiec %u/%u B",
+             (double)(after.hit_cnt - before.hit_cnt) / frames, (double)(after.miss_cnt - before.miss_cnt) / frames,
+             (unsigned)after.size, (unsigned)after.max_size);
+    TEST_MESSAGE(message);
+    printStats("bez pamieci gradientow", off, frames);
+    printStats("z pamiecia gradientow ", on, frames);
+}
+
+// --- Układ tekstu: identyfikatory glifów z pamięci podręcznej czcionki ---
+static const lv_font_t* const layoutFonts[] = {
+    &lv_font_montserrat_10, &lv_font_montserrat_12, &lv_font_montserrat_14,
+    &lv_font_montserrat_20, &lv_font_montserrat_32,
+};
+static const size_t LAYOUT_FONT_COUNT = sizeof(layoutFonts) / sizeof(layoutFonts[0]);
+
+// Tekst jak w menu (ASCII) i linia stanu (symbole LVGL i znak stopnia, wyszukiwane w rzadkiej tablicy)
+static const char* const menuText =
+    "Version: 0.1V\n\nAuthor: Timefly Workshop\n\nDescription: A control application for a "
+    "fishing boat with a graphical interface, enabling movement and navigation control via joystick.\n";
+static const char* const statusText =
+    LV_SYMBOL_BATTERY_2 LV_SYMBOL_WIFI LV_SYMBOL_GPS "\xc2\xb0" LV_SYMBOL_UP LV_SYMBOL_DOWN
+    LV_SYMBOL_LEFT LV_SYMBOL_RIGHT LV_SYMBOL_OK LV_SYMBOL_SETTINGS;
+
+// Czas ułożenia tekstu na ESP32 [ns/znak]; cold: pamięć czcionki pusta przed każdym tekstem
+static double layoutNsPerLetter(const lv_font_t* font, const char* text, bool cold) {
+    const int rounds = 2000;
+    uint32_t letters = _lv_text_get_encoded_length(text);
+    lv_point_t size;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        if (cold) lv_font_fmt_txt_cache_drop(font);
+        lv_text_get_size(&size, text, font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    }
+    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+    return (double)elapsed.count() * ESP32_SLOWDOWN / rounds / letters;
+}
+
+void test_text_layout_does_not_depend_on_font_cache() {
+    const char* texts[] = {menuText, statusText};
+    for (size_t f = 0; f < LAYOUT_FONT_COUNT; f++) {
+        for (const char* text : texts) {
+            lv_point_t cold;
+            lv_point_t warm;
+            lv_font_fmt_txt_cache_drop(layoutFonts[f]);
+            lv_text_get_size(&cold, text, layoutFonts[f], 0, 0, 300, LV_TEXT_FLAG_NONE);
+            lv_text_get_size(&warm, text, layoutFonts[f], 0, 0, 300, LV_TEXT_FLAG_NONE);
+            TEST_ASSERT_EQUAL_INT32(cold.x, warm.x);
+            TEST_ASSERT_EQUAL_INT32(cold.y, warm.y);
+        }
+    }
+}
+
+void test_text_layout_benchmark() {
+    static const int sizes[] = {10, 12, 14, 20, 32};
+    for (size_t f = 0; f < LAYOUT_FONT_COUNT; f++) {
+        char message[160];
+        snprintf(message, sizeof(message),
+                 "montserrat %d [ns/znak]: menu %.0f (pusta pamiec %.0f), symbole %.0f (pusta pamiec %.0f)", sizes[f],
+                 layoutNsPerLetter(layoutFonts[f], menuText, false), layoutNsPerLetter(layoutFonts[f], menuText, true),
+                 layoutNsPerLetter(layoutFonts[f], statusText, false),
+                 layoutNsPerLetter(layoutFonts[f], statusText, true));
+        TEST_MESSAGE(message);
+    }
+}
+
+// --- Glify: bitmapy A8 z pamięci podręcznej ---
+void test_menu_glyphs_are_cached() {
+    createDisplay(DMA_RENDER_SWAP);
+    refreshFrames(1);
+    lv_font_fmt_txt_glyph_cache_stats_t before;
+    lv_font_fmt_txt_glyph_cache_get_stats(&before);
+    refreshFrames(3);
+    lv_font_fmt_txt_glyph_cache_stats_t after;
+    lv_font_fmt_txt_glyph_cache_get_stats(&after);
+
+    // Po pierwszej klatce wszystkie glify menu mieszczą się w pamięci
+    TEST_ASSERT_EQUAL_UINT32(before.miss_cnt, after.miss_cnt);
+    TEST_ASSERT_GREATER_THAN(before.hit_cnt, after.hit_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(after.max_size, after.size);
+}
+
+// Rozpakowanie 4 bpp piksel po pikselu, jak przed pamięcią glifów
+static void unpackPerPixel(const uint8_t* in, uint8_t* out, int32_t w, int32_t h) {
+    static const uint8_t opa4[16] = {0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255};
+    int32_t i = 0;
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++, i++) {
+            i = i & 0x1;
+            if (i == 0) {
+                out[x] = opa4[(*in) >> 4];
+            } else {
+                out[x] = opa4[(*in) & 0xF];
+                in++;
+            }
+        }
+        out += w;
+    }
+}
+
+// Czas pobrania bitmap wszystkich glifów ASCII montserrat 14 na ESP32 [ns/piksel].
+// Obie wersje tak samo pobierają deskryptor glifu, różnią się tylko rozpakowaniem.
+static double decodeNsPerPixel(bool perPixel) {
+    const lv_font_t* font = &lv_font_montserrat_14;
+    const lv_font_fmt_txt_dsc_t* fdsc = (const lv_font_fmt_txt_dsc_t*)font->dsc;
+    lv_draw_buf_t* buf = lv_draw_buf_create(32, 32, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    const int rounds = 200;
+    uint64_t pixels = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (uint32_t letter = 33; letter < 127; letter++) {
+            lv_font_glyph_dsc_t g;
+            lv_font_get_glyph_dsc(font, &g, letter, 0);
+            lv_draw_buf_reshape(buf, LV_COLOR_FORMAT_A8, g.box_w, g.box_h, LV_STRIDE_AUTO);
+            if (perPixel) {
+                const lv_font_fmt_txt_glyph_dsc_t* gdsc = &fdsc->glyph_dsc[letter - 32 + 1];
+                unpackPerPixel(&fdsc->glyph_bitmap[gdsc->bitmap_index], buf->data, g.box_w, g.box_h);
+            } else {
+                lv_font_get_glyph_bitmap(&g, letter, buf);
+                lv_font_glyph_release_draw_data(&g);
+            }
+            pixels += g.box_w * g.box_h;
+        }
+    }
+    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+    lv_draw_buf_destroy(buf);
+    return (double)elapsed.count() * ESP32_SLOWDOWN / pixels;
+}
+
+void test_glyph_cache_benchmark() {
+    const int frames = 20;
+
+    // Rozmiar 0: każdy glif dekodowany przy każdym rysowaniu
+    lv_font_fmt_txt_glyph_cache_resize(0);
+    double perPixel = decodeNsPerPixel(true);
+    double words = decodeNsPerPixel(false);
+    // Wszystkie glify ASCII montserrat 14 nie mieszczą się w domyślnym budżecie
+    lv_font_fmt_txt_glyph_cache_resize(64 * 1024);
+    double cached = decodeNsPerPixel(false);
+    lv_font_fmt_txt_glyph_cache_resize(0);
+    createDisplay(DMA_RENDER_SWAP);
+    FrameStats off = refreshFrames(frames);
+
+    lv_font_fmt_txt_glyph_cache_resize(LV_FONT_FMT_TXT_GLYPH_CACHE_SIZE);
+    refreshFrames(1);
+    lv_font_fmt_txt_glyph_cache_stats_t before;
+    lv_font_fmt_txt_glyph_cache_get_stats(&before);
+    FrameStats on = refreshFrames(frames);
+    lv_font_fmt_txt_glyph_cache_stats_t after;
+    lv_font_fmt_txt_glyph_cache_get_stats(&after);
+
+    char message[160];
+    snprintf(message, sizeof(message),
+             "glify 4 bpp [ns/piksel]: piksel po pikselu %.1f, slowami %.1f, z pamieci %.1f", perPixel,
+             words, cached);
+    TEST_MESSAGE(message);
+    uint32_t hits = after.hit_cnt - before.hit_cnt;
+    uint32_t misses = after.miss_cnt - before.miss_cnt;
+    snprintf(message, sizeof(message), "glify na klatke: trafienia %.1f, dekodowania %.1f (%.0f%% trafien), pamiec %u/%u B",
+             (double)hits / frames, (double)misses / frames, hits + misses ? 100.0 * hits / (hits + misses) : 0.0,
+             (unsigned)after.size, (unsigned)after.max_size);
+    TEST_MESSAGE(message);
+    printStats("bez pamieci glifow", off, frames);
+    printStats("z pamiecia glifow ", on, frames);
+}
+
+// --- Etykiety: zapamiętane podziały linii ---
+static const int LABEL_COUNT = 8;
+
+// Ekran z etykietami z długim, zawijanym tekstem w dwóch kolumnach
+static std::vector<lv_obj_t*> createLongLabels() {
+    lv_obj_t* screen = lv_obj_create(nullptr);
+    std::vector<lv_obj_t*> labels;
+    for (int i = 0; i < LABEL_COUNT; i++) {
+        lv_obj_t* label = lv_label_create(screen);
+        lv_obj_set_style_text_font(label, &lv_font_montserrat_10, 0);
+        lv_obj_set_style_text_align(label, i % 2 ? LV_TEXT_ALIGN_CENTER : LV_TEXT_ALIGN_LEFT, 0);
+        lv_obj_set_width(label, SCREEN_WIDTH / 2 - 10);
+        lv_obj_set_pos(label, (i % 2) * SCREEN_WIDTH / 2, (i / 2) * SCREEN_HEIGHT / 4);
+        lv_label_set_text_fmt(label, "%s%s", menuText, menuText);
+        labels.push_back(label);
+    }
+    lv_screen_load(screen);
+    return labels;
+}
+
+// Wymusza ponowne łamanie tekstu, jak przed zapamiętywaniem linii
+static void forgetLines(const std::vector<lv_obj_t*>& labels) {
+    for (lv_obj_t* label : labels) lv_draw_label_lines_invalidate(&((lv_label_t*)label)->lines);
+}
+
+void test_label_lines_are_kept_between_frames() {
+    createDisplay(DMA_RENDER_SWAP);
+    std::vector<lv_obj_t*> labels = createLongLabels();
+    refreshFrames(1);
+    // Znacznik: przeliczenie linii nadpisałby szerokość najdłuższej linii
+    for (lv_obj_t* label : labels) ((lv_label_t*)label)->lines.max_line_width = -1;
+
+    refreshFrames(2);
+    lv_point_t p = {10, 30};
+    uint32_t letter = lv_label_get_letter_on(labels[0], &p, false);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, letter);
+    for (lv_obj_t* label : labels) TEST_ASSERT_EQUAL_INT32(-1, ((lv_label_t*)label)->lines.max_line_width);
+
+    // Zmiana tekstu unieważnia linie
+    lv_label_set_text(labels[0], menuText);
+    refreshFrames(1);
+    TEST_ASSERT_GREATER_THAN_INT32(0, ((lv_label_t*)labels[0])->lines.max_line_width);
+}
+
+// Czas wskazania znaku pod punktem w ostatniej linii etykiety na ESP32 [us]
+static double letterOnMicros(const std::vector<lv_obj_t*>& labels, bool keepLines) {
+    const int rounds = 200;
+    lv_point_t p = {40, lv_obj_get_height(labels[0]) - 5};
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        if (!keepLines) forgetLines(labels);
+        lv_label_get_letter_on(labels[0], &p, false);
+    }
+    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+    return (double)elapsed.count() * ESP32_SLOWDOWN / rounds / 1000;
+}
+
+void test_label_lines_benchmark() {
+    const int frames = 20;
+    createDisplay(DMA_RENDER_SWAP);
+    std::vector<lv_obj_t*> labels = createLongLabels();
+    refreshFrames(1);
+
+    FrameStats kept = refreshFrames(frames);
+    FrameStats forgotten = FrameStats();
+    for (int i = 0; i < frames; i++) {
+        forgetLines(labels);
+        FrameStats st = refreshFrames(1);
+        forgotten.frameUs += st.frameUs;
+        forgotten.renderUs += st.renderUs;
+        forgotten.busUs += st.busUs;
+        forgotten.swapUs += st.swapUs;
+        forgotten.stripes += st.stripes;
+        forgotten.overlapped += st.overlapped;
+    }
+
+    char message[160];
+    snprintf(message, sizeof(message), "%d etykiet po %u linii, znak pod punktem: %.0f us (bez zapamietanych linii %.0f us)",
+             LABEL_COUNT, (unsigned)((lv_label_t*)labels[0])->lines.line_cnt, letterOnMicros(labels, true),
+             letterOnMicros(labels, false));
+    TEST_MESSAGE(message);
+    printStats("linie liczone co klatke", forgotten, frames);
+    printStats("zapamietane linie      ", kept, frames);
+}
+
+int main(int, char**) {
+    lv_init();
+    lv_tick_set_cb(my_tick_get_cb);
+    UNITY_BEGIN();
+    RUN_TEST(test_full_refresh_sends_every_pixel_once);
+    RUN_TEST(test_flush_ready_comes_from_dma_completion);
+    RUN_TEST(test_pixels_are_sent_big_endian);
+    RUN_TEST(test_pixels_are_rendered_big_endian);
+    RUN_TEST(test_speed_bar_update_flushes_each_area_once);
+    RUN_TEST(test_area_overflow_keeps_clusters);
+    RUN_TEST(test_cached_speed_bar_is_drawn_only_on_change);
+    RUN_TEST(test_menu_gradients_are_cached);
+    RUN_TEST(test_text_layout_does_not_depend_on_font_cache);
+    RUN_TEST(test_menu_glyphs_are_cached);
+    RUN_TEST(test_label_lines_are_kept_between_frames);
+    RUN_TEST(test_flush_paths_benchmark);
+    RUN_TEST(test_area_join_benchmark);
+    RUN_TEST(test_layer_cache_benchmark);
+    RUN_TEST(test_gradient_cache_benchmark);
+    RUN_TEST(test_text_layout_benchmark);
+    RUN_TEST(test_glyph_cache_benchmark);
+    RUN_TEST(test_label_lines_benchmark);
+    return UNITY_END();
+}
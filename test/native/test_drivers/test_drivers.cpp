@@ -0,0 +1,386 @@
+#include <unity.h>
+#include <ui.h>
+#include <ui_events.h>
+#include <ui_helpers.h>
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <XPT2046_Touchscreen.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <FakeNunchuk.h>
+#include <FakeXPT2046.h>
+#include <NintendoExtensionCtrl.h>
+#include <esp_now.h>
+#include <WiFi.h>
+#include <BoatControl.h>
+#include <BoatLink.h>
+#include <BoatLog.h>
+#include <LinkMonitor.h>
+#include <ControlMailbox.h>
+#include <DisplayFlush.h>
+#include <TouchSampler.h>
+#include <TouchCalibration.h>
+#include <Preferences.h>
+#include "lvgl.h"
+
+// Oba programy w jednym procesie - każdy we własnej przestrzeni nazw
+namespace controller {
+#include "../../../src/controller_driver.cpp"
+}
+namespace boat {
+#include "../../../src/boat_driver.cpp"
+}
+
+// --- Symulacja dwóch płytek połączonych ESP-NOW ---
+static const uint8_t CONTROLLER_MAC[6] = {0x24, 0x6F, 0x28, 0x10, 0x20, 0x30};
+
+EspNowShim::Node controllerNode, boatNode;
+FakeNunchuk device;
+FakeXPT2046 touchPanel;
+
+// Zadanie okresowe jednej z płytek (odpowiednik pętli z vTaskDelayUntil)
+struct SimTask {
+    void (*step)();
+    EspNowShim::Node* node;
+    unsigned long periodUs;
+    unsigned long nextUs;
+};
+
+static void lvglStep() {
+    controller::process_touch_events();
+    lv_timer_handler();
+}
+// Zadanie dotyku co okres próbkowania; bez przerwania i dotyku step() nie używa SPI
+static void touchStep() { controller::touch_sampler.step(); }
+static void logStep() { boatLogFlush(Serial); }
+
+SimTask simTasks[] = {
+    {controller::input_step, &controllerNode, controller::INPUT_PERIOD_MS * 1000UL, 0},
+    {lvglStep, &controllerNode, 5000, 0},
+    {touchStep, &controllerNode, 10000, 0},
+    {boat::controlStep, &boatNode, boat::UPDATE_INTERVAL * 1000UL, 0},
+    {logStep, &boatNode, 10000, 0},
+};
+
+/**
+ * Przesuwa wirtualny czas o ms, wykonując zadania w ich terminach i doręczając
+ * ramki ESP-NOW. Zadania wykonują się po kolei, więc czekanie wewnątrz
+ * input_step() (konwersja Nunchuka) na chwilę wstrzymuje też drugą płytkę.
+ */
+static void runFor(unsigned long ms) {
+    unsigned long endUs = micros() + ms * 1000UL;
+    while ((long)(endUs - micros()) > 0) {
+        unsigned long nextUs = endUs;
+        for (SimTask& task : simTasks) {
+            if ((long)(micros() - task.nextUs) >= 0) {
+                EspNowShim::select(*task.node);
+                task.step();
+                task.nextUs += task.periodUs;
+            }
+            if ((long)(task.nextUs - nextUs) < 0) nextUs = task.nextUs;
+        }
+        EspNowShim::pump();
+        if (!EspNowShim::air.empty() && (long)(EspNowShim::air.front().deliverAtUs - nextUs) < 0) {
+            nextUs = EspNowShim::air.front().deliverAtUs;
+        }
+        if ((long)(nextUs - micros()) > 0) ArduinoShim::clockMicros = nextUs;
+    }
+}
+
+// Czeka (maksymalnie maxMs) na spełnienie warunku; zwraca czas oczekiwania w us lub ULONG_MAX
+template <typename Condition>
+static unsigned long runUntil(Condition condition, unsigned long maxMs) {
+    unsigned long startUs = micros();
+    for (unsigned long ms = 0; ms < maxMs; ms++) {
+        if (condition()) return micros() - startUs;
+        runFor(1);
+    }
+    return condition() ? micros() - startUs : ULONG_MAX;
+}
+
+static uint32_t leftDuty() { return ArduinoShim::ledc[boat::PWM_CHANNEL_ENA].duty; }
+static uint32_t rightDuty() { return ArduinoShim::ledc[boat::PWM_CHANNEL_ENB].duty; }
+static uint8_t pin(int number) { return ArduinoShim::pinLevels[number]; }
+
+static void bootDevices() {
+    memcpy(controllerNode.mac, CONTROLLER_MAC, sizeof(CONTROLLER_MAC));
+    memcpy(boatNode.mac, controller::receiverAddress, sizeof(boatNode.mac));
+    EspNowShim::attach(controllerNode);
+    EspNowShim::attach(boatNode);
+    Wire.attach(ExtensionPort::I2C_Addr, &device);
+    controller::touch_spi.device = &touchPanel;
+    ArduinoShim::pinLevels[TOUCH_IRQ_PIN] = HIGH; // TIRQ w spoczynku (brak dotyku przy starcie)
+    ArduinoShim::analogMillivolts[boat::BATTERY_PIN] = 3000; // 12.0 V za dzielnikiem 1:4
+
+    EspNowShim::select(controllerNode);
+    controller::setup();
+    EspNowShim::select(boatNode);
+    boat::setup();
+    for (SimTask& task : simTasks) task.nextUs = micros();
+}
+
+void setUp() {
+    // Joystick w środku, Nunchuk podłączony, łącze bez strat - silniki stoją
+    device.present = true;
+    device.joyX = 128;
+    device.joyY = 128;
+    device.buttonZ = false;
+    EspNowShim::dropFrame = nullptr;
+    runFor(3000);
+}
+
+void tearDown() {}
+
+// --- Uruchomienie ---
+void test_setup_registers_tasks_and_peers() {
+    const FreeRtosShim::TaskRecord* input = FreeRtosShim::findTask("input");
+    const FreeRtosShim::TaskRecord* control = FreeRtosShim::findTask("control");
+    TEST_ASSERT_NOT_NULL(input);
+    TEST_ASSERT_NOT_NULL(control);
+    TEST_ASSERT_NOT_NULL(FreeRtosShim::findTask("log"));
+    TEST_ASSERT_NOT_NULL(FreeRtosShim::findTask("touch"));
+    TEST_ASSERT_EQUAL(boat::CONTROL_TASK_PRIORITY, control->priority);
+    TEST_ASSERT_EQUAL(boat::CONTROL_TASK_CORE, control->core);
+    TEST_ASSERT_TRUE(controllerNode.hasPeer(boatNode.mac));
+    TEST_ASSERT_EQUAL(WIFI_STA, WiFi.getMode());
+    TEST_ASSERT_EQUAL(boat::ENA_PIN, ArduinoShim::ledc[boat::PWM_CHANNEL_ENA].pin);
+    TEST_ASSERT_EQUAL(OUTPUT, ArduinoShim::pinModes[boat::IN1_PIN]);
+}
+
+// --- Joystick -> silniki ---
+void test_forward_stick_drives_both_motors_forward() {
+    device.joyY = 255;
+    runFor(2500);
+    TEST_ASSERT_EQUAL(255, leftDuty());
+    TEST_ASSERT_EQUAL(255, rightDuty());
+    TEST_ASSERT_EQUAL(HIGH, pin(boat::IN1_PIN));
+    TEST_ASSERT_EQUAL(LOW, pin(boat::IN2_PIN));
+    TEST_ASSERT_EQUAL(HIGH, pin(boat::IN3_PIN));
+    TEST_ASSERT_EQUAL(LOW, pin(boat::IN4_PIN));
+}
+
+void test_reverse_stick_drives_both_motors_backward() {
+    device.joyY = 0;
+    runFor(2500);
+    TEST_ASSERT_EQUAL(255, leftDuty());
+    TEST_ASSERT_EQUAL(LOW, pin(boat::IN1_PIN));
+    TEST_ASSERT_EQUAL(HIGH, pin(boat::IN2_PIN));
+    TEST_ASSERT_EQUAL(LOW, pin(boat::IN3_PIN));
+    TEST_ASSERT_EQUAL(HIGH, pin(boat::IN4_PIN));
+}
+
+void test_right_stick_slows_right_motor() {
+    device.joyY = 255;
+    device.joyX = 255;
+    runFor(2500);
+    TEST_ASSERT_EQUAL(255, leftDuty());
+    TEST_ASSERT_LESS_THAN(leftDuty(), rightDuty());
+    TEST_ASSERT_GREATER_THAN(0, rightDuty());
+}
+
+void test_trigger_stops_motors_within_one_period() {
+    device.joyY = 255;
+    runFor(2500);
+    device.buttonZ = true;
+    // Próbka joysticka + lot ramki + jeden okres pętli łodzi
+    unsigned long waitedUs = runUntil([] { return leftDuty() == 0 && rightDuty() == 0; }, 500);
+    TEST_ASSERT_LESS_OR_EQUAL((controller::INPUT_PERIOD_MS + boat::UPDATE_INTERVAL + 5) * 1000UL, waitedUs);
+}
+
+// --- Failsafe ---
+void test_link_loss_ramps_motors_down() {
+    device.joyY = 255;
+    runFor(2500);
+    EspNowShim::dropFrame = [](const EspNowShim::AirFrame& frame) { return frame.from == &controllerNode; };
+    runFor(LINK_TIMEOUT_MS + boat::UPDATE_INTERVAL);
+    TEST_ASSERT_TRUE(boat::boatControl.linkLost());
+    TEST_ASSERT_GREATER_THAN(0, leftDuty()); // Rampa, nie skok do zera
+    runFor(2500);
+    TEST_ASSERT_EQUAL(0, leftDuty());
+    TEST_ASSERT_EQUAL(0, rightDuty());
+
+    // Po powrocie łącza ostatnia komenda obowiązuje ponownie
+    EspNowShim::dropFrame = nullptr;
+    runFor(2500);
+    TEST_ASSERT_FALSE(boat::boatControl.linkLost());
+    TEST_ASSERT_EQUAL(255, leftDuty());
+}
+
+// Utrata jednej ramki CONTROL: kolejne KEEPALIVE (DESYNC) podtrzymują łącze do odświeżenia komendy
+static int controlFramesToDrop = 0;
+
+void test_single_lost_control_frame_keeps_link() {
+    device.joyY = 255;
+    runFor(2500);
+    controlFramesToDrop = 1;
+    EspNowShim::dropFrame = [](const EspNowShim::AirFrame& frame) {
+        if (frame.from != &controllerNode || frame.data[1] != LINK_FRAME_CONTROL || controlFramesToDrop == 0) return false;
+        controlFramesToDrop--;
+        return true;
+    };
+    uint32_t desyncedBefore = boat::linkReceiver.stats().desynced;
+    device.joyY = 0; // Komenda "do tyłu" ginie w powietrzu
+
+    // KEEPALIVE po utraconej ramce liczy się jako znak życia: cisza to najwyżej utracona
+    // ramka i jeden okres KEEPALIVE, a nie czekanie na odświeżenie pełnej komendy
+    for (unsigned long ms = 0; ms < 3 * LINK_TIMEOUT_MS; ms++) {
+        runFor(1);
+        TEST_ASSERT_FALSE(boat::boatControl.linkLost());
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * LINK_KEEPALIVE_MS + controller::INPUT_PERIOD_MS,
+                                         boat::linkMonitor.stats(millis()).lastSeenAgeMs);
+    }
+    TEST_ASSERT_EQUAL(0, controlFramesToDrop);
+    TEST_ASSERT_GREATER_THAN(desyncedBefore, boat::linkReceiver.stats().desynced);
+
+    // Odświeżona pełna ramka dociera: łódź zwalnia i po rampie płynie do tyłu
+    TEST_ASSERT_LESS_THAN(255, boat::boatControl.currentSpeed1());
+    runFor(5000);
+    TEST_ASSERT_EQUAL(255, leftDuty());
+    TEST_ASSERT_EQUAL(LOW, pin(boat::IN1_PIN));
+    TEST_ASSERT_EQUAL(HIGH, pin(boat::IN2_PIN));
+}
+
+void test_unplugged_nunchuk_stops_boat() {
+    device.joyY = 255;
+    runFor(2500);
+    device.unplug();
+    runFor(3000);
+    TEST_ASSERT_TRUE(boat::boatControl.linkLost());
+    TEST_ASSERT_EQUAL(0, leftDuty());
+    TEST_ASSERT_EQUAL(0, lv_subject_get_int(&controller::connected_subject));
+}
+
+// --- Telemetria ---
+void test_telemetry_shows_battery_on_controller() {
+    runFor(1000);
+    TEST_ASSERT_EQUAL_STRING("12.0V", lv_label_get_text(ui_BatteryText));
+    TEST_ASSERT_GREATER_THAN(0, boatNode.framesSent);
+}
+
+// --- Dotyk ---
+static bool touchPressed() { return lv_indev_get_state(controller::touch_input) == LV_INDEV_STATE_PRESSED; }
+
+// Panel obrócony względem ekranu: oś Y odwrócona, oś X lekko pochylona
+static TouchPoint rawFor(int32_t x, int32_t y) { return {350 + x * 10 + y / 4, 3800 - y * 14}; }
+
+static void tap(const TouchPoint& raw) {
+    touchPanel.press(raw.x, raw.y);
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    runFor(60);
+    touchPanel.release();
+    runFor(60);
+}
+
+void test_first_boot_calibrates_touch() {
+    // Pusta pamięć NVS: ekran kalibracji od startu, dotyk nie trafia do interfejsu
+    TEST_ASSERT_EQUAL(0, controller::calibration_step);
+    TEST_ASSERT_NOT_NULL(controller::calibration_screen);
+    touchPanel.press(rawFor(160, 120).x, rawFor(160, 120).y);
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    runFor(60);
+    TEST_ASSERT_FALSE(touchPressed());
+    touchPanel.release();
+    runFor(60);
+    TEST_ASSERT_EQUAL(1, controller::calibration_step); // Każde puszczenie zamyka cel
+
+    controller::start_touch_calibration();
+    for (const TouchPoint& target : controller::CALIBRATION_TARGETS) tap(rawFor(target.x, target.y));
+    TEST_ASSERT_EQUAL(-1, controller::calibration_step);
+    TEST_ASSERT_NULL(controller::calibration_screen);
+    TEST_ASSERT_EQUAL(1, PreferencesShim::writes);
+
+    // Zapisana kalibracja przetrwa restart
+    TouchCalibration stored;
+    TEST_ASSERT_TRUE(stored.load(controller::SCREEN_WIDTH, controller::SCREEN_HEIGHT));
+
+    touchPanel.press(rawFor(100, 50).x, rawFor(100, 50).y);
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    TEST_ASSERT_NOT_EQUAL(ULONG_MAX, runUntil(touchPressed, 100));
+    lv_point_t point;
+    lv_indev_get_point(controller::touch_input, &point);
+    TEST_ASSERT_INT_WITHIN(1, 100, point.x);
+    TEST_ASSERT_INT_WITHIN(1, 50, point.y);
+    touchPanel.release();
+    runFor(60);
+}
+
+void test_touch_reaches_lvgl_before_next_refresh() {
+    TEST_ASSERT_EQUAL(LV_INDEV_MODE_EVENT, lv_indev_get_mode(controller::touch_input));
+    unsigned long batches = controller::touch_sampler.batches();
+    runFor(1000);
+    TEST_ASSERT_EQUAL(batches, controller::touch_sampler.batches()); // Bez dotyku magistrala stoi
+
+    // Zadanie próbkowania jest tu krokowane co 10 ms, na płytce budzi je przerwanie
+    touchPanel.press(2000, 2000);
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    unsigned long pressUs = runUntil(touchPressed, 100);
+    TEST_ASSERT_LESS_THAN(LV_DEF_REFR_PERIOD * 1000UL, pressUs);
+
+    lv_point_t point;
+    lv_indev_get_point(controller::touch_input, &point);
+    TEST_ASSERT_INT_WITHIN(controller::SCREEN_WIDTH / 2, controller::SCREEN_WIDTH / 2, point.x);
+    TEST_ASSERT_INT_WITHIN(controller::SCREEN_HEIGHT / 2, controller::SCREEN_HEIGHT / 2, point.y);
+
+    touchPanel.release();
+    unsigned long releaseUs = runUntil([] { return !touchPressed(); }, 100);
+    TEST_ASSERT_LESS_THAN(LV_DEF_REFR_PERIOD * 1000UL, releaseUs);
+    TEST_ASSERT_EQUAL(0, controller::touch_sampler.dropped());
+}
+
+// --- Benchmark ---
+void test_stick_to_pwm_latency_benchmark() {
+    const int trials = 200;
+    unsigned long firstMin = ULONG_MAX, firstMax = 0, firstSum = 0;
+    unsigned long fullMin = ULONG_MAX, fullMax = 0, fullSum = 0;
+    srand(7);
+
+    for (int i = 0; i < trials; i++) {
+        // Start z postoju w losowej fazie względem obu pętli
+        device.joyY = 128;
+        TEST_ASSERT_NOT_EQUAL(ULONG_MAX, runUntil([] { return leftDuty() == 0; }, 3000));
+        runFor(random(0, boat::UPDATE_INTERVAL));
+        simTasks[2].nextUs = micros() + random(0, boat::UPDATE_INTERVAL * 1000UL); // Niezależne zegary płytek
+
+        unsigned long movedUs = micros();
+        device.joyY = 255;
+        TEST_ASSERT_NOT_EQUAL(ULONG_MAX, runUntil([] { return leftDuty() > 0; }, 1000));
+        unsigned long first = ArduinoShim::ledc[boat::PWM_CHANNEL_ENA].changedAtUs - movedUs;
+        TEST_ASSERT_NOT_EQUAL(ULONG_MAX, runUntil([] { return leftDuty() == 255; }, 5000));
+        unsigned long full = ArduinoShim::ledc[boat::PWM_CHANNEL_ENA].changedAtUs - movedUs;
+
+        firstMin = min(firstMin, first);
+        firstMax = max(firstMax, first);
+        firstSum += first;
+        fullMin = min(fullMin, full);
+        fullMax = max(fullMax, full);
+        fullSum += full;
+    }
+
+    // Najgorszy przypadek: okres próbkowania + lot ramki + okres pętli łodzi
+    TEST_ASSERT_LESS_OR_EQUAL((controller::INPUT_PERIOD_MS + boat::UPDATE_INTERVAL + 5) * 1000UL, firstMax);
+
+    char message[200];
+    snprintf(message, sizeof(message),
+             "joystick -> pierwsza zmiana PWM [ms]: min %.1f, sr %.1f, max %.1f; pelna predkosc [ms]: min %.1f, sr %.1f, max %.1f",
+             firstMin / 1000.0, firstSum / 1000.0 / trials, firstMax / 1000.0,
+             fullMin / 1000.0, fullSum / 1000.0 / trials, fullMax / 1000.0);
+    TEST_MESSAGE(message);
+}
+
+int main(int, char**) {
+    bootDevices();
+    UNITY_BEGIN();
+    RUN_TEST(test_setup_registers_tasks_and_peers);
+    RUN_TEST(test_forward_stick_drives_both_motors_forward);
+    RUN_TEST(test_reverse_stick_drives_both_motors_backward);
+    RUN_TEST(test_right_stick_slows_right_motor);
+    RUN_TEST(test_trigger_stops_motors_within_one_period);
+    RUN_TEST(test_link_loss_ramps_motors_down);
+    RUN_TEST(test_single_lost_control_frame_keeps_link);
+    RUN_TEST(test_unplugged_nunchuk_stops_boat);
+    RUN_TEST(test_telemetry_shows_battery_on_controller);
+    RUN_TEST(test_first_boot_calibrates_touch);
+    RUN_TEST(test_touch_reaches_lvgl_before_next_refresh);
+    RUN_TEST(test_stick_to_pwm_latency_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,196 @@
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <MotorMixer.h>
+
+MotorMixerConfig makeConfig(int deadband, int expo, int slewRate, int periodMs, int minPwm) {
+    MotorMixerConfig config;
+    config.deadband = deadband;
+    config.expo = expo;
+    config.slewRate = slewRate;
+    config.periodMs = periodMs;
+    config.minPwm = minPwm;
+    return config;
+}
+
+// --- Poprzednia implementacja z boat_driver.cpp (odniesienie) ---
+static long arduinoMap(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+static int referenceConstrain(int value, int low, int high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+static void referenceMix(int up, int down, int left, int right, int& target1, int& target2) {
+    int baseSpeed = referenceConstrain(up - down, -255, 255);
+    int turnAdjust = referenceConstrain((right - left) / 2, -255, 255);
+    target1 = referenceConstrain(baseSpeed + turnAdjust, -255, 255);
+    target2 = referenceConstrain(baseSpeed - turnAdjust, -255, 255);
+}
+
+static int referenceSmooth(int currentSpeed, int targetSpeed, int step) {
+    if (currentSpeed < targetSpeed) return currentSpeed + step < targetSpeed ? currentSpeed + step : targetSpeed;
+    if (currentSpeed > targetSpeed) return currentSpeed - step > targetSpeed ? currentSpeed - step : targetSpeed;
+    return currentSpeed;
+}
+
+static int referencePwm(int speed) {
+    int absSpeed = abs(speed);
+    return absSpeed > 0 ? (int)arduinoMap(absSpeed, 0, 255, 50, 255) : 0;
+}
+
+// Krzywa osi liczona przy każdej próbce (to, co zastępuje tablica curve())
+static int referenceCurve(int axis, int deadband, float expo) {
+    if (axis <= deadband) return 0;
+    float x = (float)(axis - deadband) / (float)(255 - deadband);
+    return (int)lroundf(((1.0f - expo) * x + expo * x * x * x) * 255);
+}
+
+// --- Krzywe i tablice ---
+void test_default_config_matches_previous_mixing() {
+    MotorMixer mixer(makeConfig(0, 0, 125, 80, 50));
+    for (int up = 0; up < 256; up += 15) {
+        for (int down = 0; down < 256; down += 51) {
+            for (int left = 0; left < 256; left += 17) {
+                for (int right = 0; right < 256; right += 85) {
+                    int t1, t2, r1, r2;
+                    mixer.mix(up, down, left, right, t1, t2);
+                    referenceMix(up, down, left, right, r1, r2);
+                    TEST_ASSERT_EQUAL(r1, t1);
+                    TEST_ASSERT_EQUAL(r2, t2);
+                }
+            }
+        }
+    }
+}
+
+void test_pwm_table_matches_map_with_min_pwm() {
+    MotorMixer mixer(makeConfig(0, 0, 125, 80, 50));
+    for (int speed = -255; speed <= 255; speed++) {
+        TEST_ASSERT_EQUAL(referencePwm(speed), mixer.pwm(speed));
+    }
+    TEST_ASSERT_EQUAL(255, mixer.pwm(1000)); // Poza zakresem - nasycenie
+}
+
+void test_deadband_zeroes_small_inputs_and_keeps_full_scale() {
+    MotorMixer mixer(makeConfig(20, 0, 125, 80, 0));
+    for (int i = 0; i <= 20; i++) TEST_ASSERT_EQUAL(0, mixer.curve(i));
+    TEST_ASSERT_EQUAL(255, mixer.curve(255));
+    for (int i = 1; i < 256; i++) TEST_ASSERT_GREATER_OR_EQUAL(mixer.curve(i - 1), mixer.curve(i));
+    // Wyjście zaczyna się tuż przy zerze, bez skoku na krawędzi martwej strefy
+    TEST_ASSERT_LESS_OR_EQUAL(2, mixer.curve(21));
+}
+
+void test_expo_softens_center_and_keeps_endpoints() {
+    MotorMixer linear(makeConfig(0, 0, 125, 80, 0));
+    MotorMixer soft(makeConfig(0, 50, 125, 80, 0));
+    MotorMixer cubic(makeConfig(0, 100, 125, 80, 0));
+    TEST_ASSERT_EQUAL(128, linear.curve(128));
+    TEST_ASSERT_EQUAL(32, cubic.curve(128));   // (128/255)^3 * 255
+    TEST_ASSERT_EQUAL(80, soft.curve(128));    // Połowa drogi między liniową a sześcienną
+    TEST_ASSERT_EQUAL(255, cubic.curve(255));
+    TEST_ASSERT_EQUAL(0, cubic.curve(0));
+    for (int i = 1; i < 256; i++) TEST_ASSERT_GREATER_OR_EQUAL(cubic.curve(i - 1), cubic.curve(i));
+}
+
+// --- Ograniczenie narastania ---
+void test_slew_rate_is_in_units_per_second() {
+    // 255 jednostek/s przy okresie 20 ms = 5.1 jednostki na okres (ułamki są akumulowane)
+    MotorMixer mixer(makeConfig(0, 0, 255, 20, 0));
+    MotorSpeeds speeds = {};
+    for (int i = 0; i < 25; i++) speeds = mixer.step(255, -255);
+    TEST_ASSERT_EQUAL(127, speeds.currentSpeed1);
+    TEST_ASSERT_EQUAL(-127, speeds.currentSpeed2);
+    for (int i = 0; i < 25; i++) speeds = mixer.step(255, -255);
+    TEST_ASSERT_EQUAL(255, speeds.currentSpeed1);
+    TEST_ASSERT_EQUAL(-255, speeds.currentSpeed2);
+}
+
+void test_slew_independent_of_loop_period() {
+    // Ta sama rampa przy pętli 10 ms i 80 ms po tym samym czasie
+    MotorMixer fast(makeConfig(0, 0, 100, 10, 0));
+    MotorMixer slow(makeConfig(0, 0, 100, 80, 0));
+    for (int ms = 80; ms <= 2400; ms += 80) {
+        for (int i = 0; i < 8; i++) fast.step(255, 0);
+        slow.step(255, 0);
+        TEST_ASSERT_INT_WITHIN(1, ms * 100 / 1000, fast.speed1());
+        TEST_ASSERT_INT_WITHIN(1, fast.speed1(), slow.speed1());
+    }
+}
+
+void test_slew_reverses_through_zero_and_stop_is_immediate() {
+    MotorMixer mixer(makeConfig(0, 0, 125, 80, 0));
+    for (int i = 0; i < 5; i++) mixer.step(255, 255);
+    TEST_ASSERT_EQUAL(50, mixer.speed1());
+    for (int i = 0; i < 7; i++) mixer.step(-255, -255);
+    TEST_ASSERT_EQUAL(-20, mixer.speed1());
+    mixer.stop();
+    TEST_ASSERT_EQUAL(0, mixer.speed1());
+    TEST_ASSERT_EQUAL(0, mixer.speed2());
+}
+
+// --- Benchmark ---
+void test_mixer_benchmark() {
+    const int samples = 2000000;
+    uint8_t axes[256];
+    for (int i = 0; i < 256; i++) axes[i] = (uint8_t)(rand() & 0xFF);
+    volatile int sink = 0;
+
+    int speed1 = 0, speed2 = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++) {
+        int t1, t2;
+        referenceMix(axes[i & 255], axes[(i + 1) & 255], axes[(i + 2) & 255], axes[(i + 3) & 255], t1, t2);
+        speed1 = referenceSmooth(speed1, t1, 10);
+        speed2 = referenceSmooth(speed2, t2, 10);
+        sink = sink + referencePwm(speed1) + referencePwm(speed2);
+    }
+    double referenceNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    speed1 = speed2 = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++) {
+        int t1, t2;
+        referenceMix(referenceCurve(axes[i & 255], 8, 0.3f), referenceCurve(axes[(i + 1) & 255], 8, 0.3f),
+                     referenceCurve(axes[(i + 2) & 255], 8, 0.3f), referenceCurve(axes[(i + 3) & 255], 8, 0.3f), t1, t2);
+        speed1 = referenceSmooth(speed1, t1, 10);
+        speed2 = referenceSmooth(speed2, t2, 10);
+        sink = sink + referencePwm(speed1) + referencePwm(speed2);
+    }
+    double curveNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    MotorMixer mixer(makeConfig(8, 30, 125, 80, 50));
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++) {
+        int t1, t2;
+        mixer.mix(axes[i & 255], axes[(i + 1) & 255], axes[(i + 2) & 255], axes[(i + 3) & 255], t1, t2);
+        MotorSpeeds speeds = mixer.step(t1, t2);
+        sink = sink + mixer.pwm(speeds.currentSpeed1) + mixer.pwm(speeds.currentSpeed2);
+    }
+    double mixerNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    char message[200];
+    snprintf(message, sizeof(message),
+             "ns/probke: map()+smoothSpeed %.1f, to samo + expo liczone na biezaco %.1f, MotorMixer (expo z LUT) %.1f",
+             referenceNs / samples, curveNs / samples, mixerNs / samples);
+    TEST_MESSAGE(message);
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_default_config_matches_previous_mixing);
+    RUN_TEST(test_pwm_table_matches_map_with_min_pwm);
+    RUN_TEST(test_deadband_zeroes_small_inputs_and_keeps_full_scale);
+    RUN_TEST(test_expo_softens_center_and_keeps_endpoints);
+    RUN_TEST(test_slew_rate_is_in_units_per_second);
+    RUN_TEST(test_slew_independent_of_loop_period);
+    RUN_TEST(test_slew_reverses_through_zero_and_stop_is_immediate);
+    RUN_TEST(test_mixer_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,92 @@
+#include <unity.h>
+#include <Wire.h>
+#include <FakeNunchuk.h>
+#include <NintendoExtensionCtrl.h>
+
+FakeNunchuk device;
+Nunchuk nunchuk;
+
+void setUp() {
+    ArduinoShim::resetClock();
+    device = FakeNunchuk();
+    Wire.attach(ExtensionPort::I2C_Addr, &device);
+    nunchuk.reset();
+    TEST_ASSERT_TRUE(nunchuk.connect());
+    Wire.resetCounters();
+}
+
+void tearDown() {}
+
+// --- Unit tests ---
+void test_begin_update_does_not_block() {
+    unsigned long start = micros();
+    TEST_ASSERT_TRUE(nunchuk.beginUpdate());
+    TEST_ASSERT_EQUAL(start, micros()); // Brak delayMicroseconds() w wywołaniu
+    TEST_ASSERT_EQUAL(1, Wire.writeTransactions);
+    TEST_ASSERT_EQUAL(0, Wire.readTransactions);
+}
+
+void test_poll_waits_for_conversion_deadline() {
+    device.joyX = 42;
+    TEST_ASSERT_TRUE(nunchuk.beginUpdate());
+
+    // Czas "renderowania" krótszy niż konwersja: odczyt jeszcze nie startuje
+    ArduinoShim::advanceMicros(100);
+    TEST_ASSERT_EQUAL(UpdateStatus::Pending, nunchuk.pollUpdate());
+    TEST_ASSERT_EQUAL(0, Wire.readTransactions);
+
+    ArduinoShim::advanceMicros(75);
+    TEST_ASSERT_EQUAL(UpdateStatus::Ready, nunchuk.pollUpdate());
+    TEST_ASSERT_EQUAL(1, Wire.readTransactions);
+    TEST_ASSERT_EQUAL(0, device.earlyReads);
+    TEST_ASSERT_EQUAL(42, nunchuk.joyX());
+
+    // Wynik zgłaszany jest tylko raz
+    TEST_ASSERT_EQUAL(UpdateStatus::Idle, nunchuk.pollUpdate());
+}
+
+void test_interleaved_work_hides_conversion() {
+    // Pętla UI: rozpoczęcie odczytu, praca 2 ms, dokończenie odczytu
+    for (int frame = 0; frame < 10; frame++) {
+        device.joyY = 100 + frame;
+        TEST_ASSERT_TRUE(nunchuk.beginUpdate());
+        ArduinoShim::advanceMillis(2); // lv_timer_handler()
+        TEST_ASSERT_EQUAL(UpdateStatus::Ready, nunchuk.pollUpdate());
+        TEST_ASSERT_EQUAL(100 + frame, nunchuk.joyY());
+    }
+    TEST_ASSERT_EQUAL(20, Wire.transactions());
+    TEST_ASSERT_EQUAL(0, device.earlyReads);
+}
+
+void test_deadline_survives_micros_rollover() {
+    ArduinoShim::clockMicros = (unsigned long)-100;
+    TEST_ASSERT_TRUE(nunchuk.beginUpdate());
+    ArduinoShim::advanceMicros(150);
+    TEST_ASSERT_EQUAL(UpdateStatus::Pending, nunchuk.pollUpdate());
+    ArduinoShim::advanceMicros(25);
+    TEST_ASSERT_EQUAL(UpdateStatus::Ready, nunchuk.pollUpdate());
+}
+
+void test_failed_read_marks_connection_suspect() {
+    TEST_ASSERT_TRUE(nunchuk.beginUpdate());
+    device.unplug();
+    ArduinoShim::advanceMicros(200);
+    TEST_ASSERT_EQUAL(UpdateStatus::Failed, nunchuk.pollUpdate());
+    TEST_ASSERT_EQUAL(ConnectionState::Suspect, nunchuk.getConnectionState());
+
+    // Bez połączenia odczyt asynchroniczny nie startuje - obsługuje to poll()
+    TEST_ASSERT_FALSE(nunchuk.beginUpdate());
+    TEST_ASSERT_FALSE(nunchuk.poll());
+    TEST_ASSERT_EQUAL(ConnectionState::Reconnecting, nunchuk.getConnectionState());
+    TEST_ASSERT_FALSE(nunchuk.beginUpdate());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_update_does_not_block);
+    RUN_TEST(test_poll_waits_for_conversion_deadline);
+    RUN_TEST(test_interleaved_work_hides_conversion);
+    RUN_TEST(test_deadline_survives_micros_rollover);
+    RUN_TEST(test_failed_read_marks_connection_suspect);
+    return UNITY_END();
+}
@@ -0,0 +1,119 @@
+#include <unity.h>
+#include <Wire.h>
+#include <FakeNunchuk.h>
+#include <NintendoExtensionCtrl.h>
+
+FakeNunchuk device;
+Nunchuk nunchuk;
+
+void setUp() {
+    ArduinoShim::resetClock();
+    device = FakeNunchuk();
+    Wire.attach(ExtensionPort::I2C_Addr, &device);
+    nunchuk.reset();
+    TEST_ASSERT_TRUE(nunchuk.connect());
+    Wire.resetCounters();
+}
+
+void tearDown() {}
+
+// --- Unit tests ---
+void test_connected_poll_is_single_read() {
+    device.joyX = 200;
+    unsigned long start = micros();
+    TEST_ASSERT_TRUE(nunchuk.poll());
+    // Jeden zapis wskaźnika + jeden odczyt, bez 30 ms opóźnień z initialize()
+    TEST_ASSERT_EQUAL(1, Wire.writeTransactions);
+    TEST_ASSERT_EQUAL(1, Wire.readTransactions);
+    TEST_ASSERT_LESS_THAN(1000, micros() - start);
+    TEST_ASSERT_EQUAL(200, nunchuk.joyX());
+}
+
+void test_connect_costs_full_init() {
+    // Dla porównania: stare connect() przy każdej próbce
+    unsigned long start = micros();
+    TEST_ASSERT_TRUE(nunchuk.connect());
+    TEST_ASSERT_GREATER_OR_EQUAL(30000, micros() - start);
+    TEST_ASSERT_EQUAL(3, Wire.writeTransactions);
+}
+
+void test_ten_ticks_bus_traffic() {
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE(nunchuk.poll());
+        ArduinoShim::advanceMillis(100);
+    }
+    TEST_ASSERT_EQUAL(20, Wire.transactions());
+    TEST_ASSERT_EQUAL(ConnectionState::Connected, nunchuk.getConnectionState());
+}
+
+void test_unplug_goes_suspect_then_reconnecting() {
+    device.unplug();
+    TEST_ASSERT_FALSE(nunchuk.poll());
+    TEST_ASSERT_EQUAL(ConnectionState::Suspect, nunchuk.getConnectionState());
+    TEST_ASSERT_TRUE(nunchuk.isConnected());
+
+    // Sprawdzenie żywotności jednym odczytem identyfikatora
+    Wire.resetCounters();
+    TEST_ASSERT_FALSE(nunchuk.poll());
+    TEST_ASSERT_EQUAL(1, Wire.writeTransactions);
+    TEST_ASSERT_EQUAL(ConnectionState::Reconnecting, nunchuk.getConnectionState());
+    TEST_ASSERT_FALSE(nunchuk.isConnected());
+}
+
+void test_reconnect_is_rate_limited() {
+    device.unplug();
+    nunchuk.poll();
+    nunchuk.poll();
+    ArduinoShim::advanceMillis(ExtensionPort::ReconnectInterval);
+
+    // Pierwsza próba od razu, kolejne najwyżej co ReconnectInterval
+    Wire.resetCounters();
+    TEST_ASSERT_FALSE(nunchuk.poll());
+    TEST_ASSERT_EQUAL(1, Wire.writeTransactions);
+    for (int i = 0; i < 4; i++) {
+        ArduinoShim::advanceMillis(100);
+        TEST_ASSERT_FALSE(nunchuk.poll());
+    }
+    TEST_ASSERT_EQUAL(1, Wire.transactions());
+
+    // Ponowne podłączenie: pełna inicjalizacja i od razu świeże dane
+    device.present = true;
+    ArduinoShim::advanceMillis(100);
+    TEST_ASSERT_TRUE(nunchuk.poll());
+    TEST_ASSERT_EQUAL(ConnectionState::Connected, nunchuk.getConnectionState());
+}
+
+void test_transient_error_recovers_without_init() {
+    device.present = false; // Chwilowy NACK, kontroler pozostaje zainicjalizowany
+    TEST_ASSERT_FALSE(nunchuk.poll());
+    device.present = true;
+
+    Wire.resetCounters();
+    TEST_ASSERT_TRUE(nunchuk.poll());
+    TEST_ASSERT_EQUAL(ConnectionState::Connected, nunchuk.getConnectionState());
+    TEST_ASSERT_EQUAL(2, Wire.writeTransactions); // Identyfikator + dane, bez initialize()
+}
+
+void test_garbage_data_forces_reinit() {
+    // Kontroler zresetował się, ale odpowiada: same 0xFF nie przechodzą verifyData()
+    device.initialized = false;
+    TEST_ASSERT_FALSE(nunchuk.poll());
+    TEST_ASSERT_FALSE(nunchuk.poll()); // Identyfikator też nieczytelny
+    TEST_ASSERT_EQUAL(ConnectionState::Reconnecting, nunchuk.getConnectionState());
+
+    ArduinoShim::advanceMillis(ExtensionPort::ReconnectInterval);
+    TEST_ASSERT_TRUE(nunchuk.poll()); // Ponowna inicjalizacja przywraca dane
+    TEST_ASSERT_EQUAL(128, nunchuk.joyX());
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_connected_poll_is_single_read);
+    RUN_TEST(test_connect_costs_full_init);
+    RUN_TEST(test_ten_ticks_bus_traffic);
+    RUN_TEST(test_unplug_goes_suspect_then_reconnecting);
+    RUN_TEST(test_reconnect_is_rate_limited);
+    RUN_TEST(test_transient_error_recovers_without_init);
+    RUN_TEST(test_garbage_data_forces_reinit);
+    return UNITY_END();
+}
@@ -0,0 +1,434 @@
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+// Kod czcionek wygładzanych z TFT_eSPI z plikiem w SPIFFS i pamięcią podręczną glifów
+#define SMOOTH_FONT
+#define FONT_FS_AVAILABLE
+#define SMOOTH_FONT_CACHE 16384
+
+#include <Arduino.h>
+#include <FS.h>
+#include <SPIFFS.h>
+
+typedef uint16_t (*getColorCallback)(uint16_t x, uint16_t y);
+
+// Ekran w pamięci z tą częścią TFT_eSPI, której używa Smooth_font.cpp
+class TFT_eSPI {
+public:
+    static const int16_t WIDTH = 320;
+    static const int16_t HEIGHT = 240;
+
+    TFT_eSPI() : framebuffer(WIDTH * HEIGHT, 0) {}
+    virtual ~TFT_eSPI() { unloadFont(); }
+
+#include "../../../lib/TFT_eSPI/Extensions/Smooth_font.h"
+
+public:
+    uint32_t textcolor = 0xFFFF, textbgcolor = 0x0000;
+    int32_t cursor_x = 0, cursor_y = 0, bg_cursor_x = 0, last_cursor_x = 0;
+    bool textwrapX = true, textwrapY = false, _fillbg = false, _psram_enable = false;
+    getColorCallback getColor = nullptr;
+
+    std::vector<uint16_t> framebuffer;
+    unsigned long pixelWrites = 0;
+
+    int16_t width() const { return WIDTH; }
+    int16_t height() const { return HEIGHT; }
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    void startWrite() {}
+    void endWrite() {}
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color) {
+        pixelWrites++;
+        if (x >= 0 && y >= 0 && x < WIDTH && y < HEIGHT) framebuffer[y * WIDTH + x] = (uint16_t)color;
+    }
+    void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+        for (int32_t i = 0; i < w; i++) drawPixel(x + i, y, color);
+    }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+        for (int32_t j = 0; j < h; j++) drawFastHLine(x, y + j, w, color);
+    }
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        fillRect(x, y, 1, h, color);
+        fillRect(x + w - 1, y, 1, h, color);
+    }
+    void fillScreen(uint32_t color) { fillRect(0, 0, WIDTH, HEIGHT, color); }
+
+    uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc) {
+        uint32_t rxb = bgc & 0xF81F;
+        rxb += ((fgc & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+        uint32_t xgx = bgc & 0x07E0;
+        xgx += ((fgc & 0x07E0) - xgx) * alpha >> 8;
+        return (rxb & 0xF81F) | (xgx & 0x07E0);
+    }
+
+    void drawText(const std::vector<uint16_t>& codes) {
+        for (uint16_t code : codes) drawGlyph(code);
+    }
+
+    void clear() {
+        std::fill(framebuffer.begin(), framebuffer.end(), 0);
+        setCursor(0, 0);
+        bg_cursor_x = last_cursor_x = 0;
+    }
+};
+
+#include "../../../lib/TFT_eSPI/Extensions/Smooth_font.cpp"
+
+// --- Czcionka .vlw generowana w teście ---
+struct GlyphSpec {
+    uint16_t code;
+    uint8_t width, height, advance;
+    int16_t dY;
+    int8_t dX;
+};
+
+static void putInt32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(value >> 24);
+    out.push_back(value >> 16);
+    out.push_back(value >> 8);
+    out.push_back(value);
+}
+
+static GlyphSpec glyphFor(uint16_t code) {
+    uint8_t w = 6 + code % 9, h = 10 + code % 7;
+    return {code, w, h, (uint8_t)(w + 1), (int16_t)(h - 2 - code % 3), (int8_t)(code % 3 - 1)};
+}
+
+// Znaki ASCII, Latin-1 i polskie litery
+static std::vector<uint16_t> fontCodes() {
+    std::vector<uint16_t> codes;
+    for (uint16_t c = 0x21; c < 0x7F; c++) codes.push_back(c);
+    for (uint16_t c = 0xA0; c <= 0xFF; c++) codes.push_back(c);
+    const uint16_t polish[] = {0x104, 0x105, 0x106, 0x107, 0x118, 0x119, 0x141, 0x142,
+                               0x143, 0x144, 0x15A, 0x15B, 0x179, 0x17A, 0x17B, 0x17C};
+    for (uint16_t c : polish) codes.push_back(c);
+    return codes;
+}
+
+static std::vector<uint8_t> makeVlw(const std::vector<uint16_t>& codes) {
+    std::vector<uint8_t> out;
+    putInt32(out, codes.size());
+    putInt32(out, 11); // Wersja kodera
+    putInt32(out, 16); // Rozmiar w punktach
+    putInt32(out, 0);
+    putInt32(out, 12); // ascent
+    putInt32(out, 4);  // descent
+    for (uint16_t code : codes) {
+        GlyphSpec g = glyphFor(code);
+        putInt32(out, g.code);
+        putInt32(out, g.height);
+        putInt32(out, g.width);
+        putInt32(out, g.advance);
+        putInt32(out, (uint32_t)(int32_t)g.dY);
+        putInt32(out, (uint32_t)(int32_t)g.dX);
+        putInt32(out, 0);
+    }
+    for (uint16_t code : codes) {
+        GlyphSpec g = glyphFor(code);
+        for (int y = 0; y < g.height; y++) {
+            for (int x = 0; x < g.width; x++) {
+                uint8_t alpha = (x + y + code) % 5 == 0 ? 0 : ((x * y + code) % 3 == 0 ? 0xFF : (x * 17 + y * 29 + code) & 0xFF);
+                out.push_back(alpha);
+            }
+        }
+    }
+    const char name[] = "\x04Test\0\x04Test\0\x01";
+    out.insert(out.end(), name, name + sizeof(name) - 1);
+    return out;
+}
+
+// Ta sama czcionka z glifami w losowej kolejności i powtórzonym kodem 'A'
+static std::vector<uint16_t> shuffledCodes() {
+    std::vector<uint16_t> codes = fontCodes();
+    srand(7);
+    for (size_t i = codes.size() - 1; i > 0; i--) std::swap(codes[i], codes[rand() % (i + 1)]);
+    codes.push_back('A');
+    return codes;
+}
+
+static std::vector<uint8_t> sortedFont, shuffledFont;
+
+// Tekst z cyframi, literami i polskimi znakami jak na ekranie sterownika
+static std::vector<uint16_t> sampleText() {
+    const uint16_t text[] = {'P', 'r', 0x119, 'd', 'k', 'o', 0x15B, 0x107, ':', '1', '2', '.', '5', 'k', 'm',
+                             '/', 'h', 'Z', 'a', 's', 'i', 0x119, 'g', ':', '8', '7', '%', 0x141, 0x105, 'c', 'z'};
+    return std::vector<uint16_t>(text, text + sizeof(text) / sizeof(text[0]));
+}
+
+// --- Poprzedni kod (odniesienie): wyszukiwanie liniowe i odczyt po bajcie ---
+static bool linearIndex(const TFT_eSPI& tft, uint16_t unicode, uint16_t* index) {
+    for (uint16_t i = 0; i < tft.gFont.gCount; i++) {
+        if (tft.gUnicode[i] == unicode) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t readInt32(fs::File& file) {
+    uint32_t val = (uint32_t)file.read() << 24;
+    val |= (uint32_t)file.read() << 16;
+    val |= (uint32_t)file.read() << 8;
+    val |= (uint32_t)file.read();
+    return val;
+}
+
+static void readMetricsByteByByte(fs::File& file, uint16_t* unicode, uint8_t* height, uint8_t* width) {
+    uint16_t count = (uint16_t)readInt32(file);
+    for (int i = 0; i < 5; i++) readInt32(file);
+    for (uint16_t n = 0; n < count; n++) {
+        unicode[n] = (uint16_t)readInt32(file);
+        height[n] = (uint8_t)readInt32(file);
+        width[n] = (uint8_t)readInt32(file);
+        for (int i = 0; i < 4; i++) readInt32(file);
+    }
+}
+
+void setUp(void) {
+    if (sortedFont.empty()) {
+        sortedFont = makeVlw(fontCodes());
+        shuffledFont = makeVlw(shuffledCodes());
+    }
+    SPIFFS.clear();
+    SPIFFS.addFile("/Test.vlw", sortedFont);
+    SPIFFS.addFile("/Shuffled.vlw", shuffledFont);
+    fs::resetFileStats();
+}
+
+void tearDown(void) {}
+
+static void assertIndexMatchesLinear(TFT_eSPI& tft) {
+    for (uint32_t code = 0; code <= 0xFFFF; code++) {
+        uint16_t expected = 0xFFFF, actual = 0xFFFF;
+        bool found = linearIndex(tft, (uint16_t)code, &expected);
+        TEST_ASSERT_EQUAL(found, tft.getUnicodeIndex((uint16_t)code, &actual));
+        if (found) TEST_ASSERT_EQUAL_UINT16(expected, actual);
+    }
+}
+
+// Wyszukiwanie binarne zwraca ten sam glif co liniowe, także przy nieposortowanym pliku
+void test_index_matches_linear_search(void) {
+    TFT_eSPI tft;
+    tft.loadFont(sortedFont.data());
+    TEST_ASSERT_TRUE(tft.fontLoaded);
+    TEST_ASSERT_NULL(tft.gSorted); // Plik posortowany: bez dodatkowej tablicy
+    assertIndexMatchesLinear(tft);
+
+    tft.loadFont(shuffledFont.data());
+    TEST_ASSERT_NOT_NULL(tft.gSorted);
+    assertIndexMatchesLinear(tft);
+
+    // Powtórzony kod: pierwszy glif w pliku, jak przy wyszukiwaniu liniowym
+    uint16_t index = 0;
+    TEST_ASSERT_TRUE(tft.getUnicodeIndex('A', &index));
+    TEST_ASSERT_TRUE(index < tft.gFont.gCount - 1);
+
+    tft.unloadFont();
+    TEST_ASSERT_NULL(tft.gSorted);
+    TEST_ASSERT_FALSE(tft.getUnicodeIndex('A', &index));
+}
+
+// Nagłówek jednym odczytem, metryki blokami po 16 glifów
+void test_metrics_are_read_in_blocks(void) {
+    TFT_eSPI fromArray, fromFile;
+    fromArray.loadFont(sortedFont.data());
+    fs::resetFileStats();
+    fromFile.loadFont("Test", SPIFFS);
+    TEST_ASSERT_TRUE(fromFile.fontLoaded);
+
+    uint16_t count = fromFile.gFont.gCount;
+    TEST_ASSERT_EQUAL_UINT16(fontCodes().size(), count);
+    TEST_ASSERT_EQUAL_UINT32(1 + (count + 15) / 16, fs::fileStats.reads);
+    TEST_ASSERT_EQUAL_UINT32(24 + 28 * count, fs::fileStats.bytesRead);
+
+    TEST_ASSERT_EQUAL(fromArray.gFont.maxDescent, fromFile.gFont.maxDescent);
+    TEST_ASSERT_EQUAL(fromArray.gFont.yAdvance, fromFile.gFont.yAdvance);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(fromArray.gUnicode, fromFile.gUnicode, count);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(fromArray.gWidth, fromFile.gWidth, count);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(fromArray.gHeight, fromFile.gHeight, count);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(fromArray.gxAdvance, fromFile.gxAdvance, count);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(fromArray.gdY, fromFile.gdY, count);
+    TEST_ASSERT_EQUAL_INT8_ARRAY(fromArray.gdX, fromFile.gdX, count);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(fromArray.gBitmap, fromFile.gBitmap, count);
+    for (uint16_t i = 0; i < count; i++) {
+        GlyphSpec g = glyphFor(fromFile.gUnicode[i]);
+        TEST_ASSERT_EQUAL(g.width, fromFile.gWidth[i]);
+        TEST_ASSERT_EQUAL(g.dY, fromFile.gdY[i]);
+        TEST_ASSERT_EQUAL(g.dX, fromFile.gdX[i]);
+    }
+}
+
+// Obraz tekstu jest taki sam z tablicy, z pliku i z pamięci podręcznej
+void test_file_font_draws_like_array_font(void) {
+    std::vector<uint16_t> text = sampleText();
+    text.push_back(' ');
+    text.push_back(0x2603); // Brak w czcionce: prostokąt
+
+    for (int fill = 0; fill < 2; fill++) {
+        TFT_eSPI tft;
+        tft._fillbg = fill;
+        tft.textbgcolor = 0x1234;
+
+        tft.loadFont(sortedFont.data());
+        tft.drawText(text);
+        std::vector<uint16_t> expected = tft.framebuffer;
+
+        tft.fontCacheSize = 0;
+        tft.loadFont("Test", SPIFFS);
+        TEST_ASSERT_NULL(tft.gCacheArena);
+        tft.clear();
+        tft.drawText(text);
+        TEST_ASSERT_TRUE(expected == tft.framebuffer);
+
+        tft.fontCacheSize = SMOOTH_FONT_CACHE;
+        tft.loadFont("Test", SPIFFS);
+        TEST_ASSERT_NOT_NULL(tft.gCacheArena);
+        for (int pass = 0; pass < 2; pass++) {
+            tft.clear();
+            tft.drawText(text);
+            TEST_ASSERT_TRUE(expected == tft.framebuffer);
+        }
+    }
+}
+
+// Drugie rysowanie tego samego tekstu nie czyta pliku
+void test_cached_glyphs_skip_the_file(void) {
+    TFT_eSPI tft;
+    tft.loadFont("Test", SPIFFS);
+    std::vector<uint16_t> text = sampleText();
+
+    tft.drawText(text);
+    uint32_t misses = tft.fontCacheMisses;
+    TEST_ASSERT_TRUE(misses > 0 && misses < text.size()); // Powtórzone znaki już z pamięci
+
+    fs::resetFileStats();
+    tft.clear();
+    tft.drawText(text);
+    TEST_ASSERT_EQUAL_UINT32(0, fs::fileStats.reads);
+    TEST_ASSERT_EQUAL_UINT32(0, fs::fileStats.seeks);
+    TEST_ASSERT_EQUAL_UINT32(misses, tft.fontCacheMisses);
+    TEST_ASSERT_EQUAL_UINT32(2 * text.size() - misses, tft.fontCacheHits);
+}
+
+// Przy braku miejsca wymieniany jest najdawniej użyty glif
+void test_cache_evicts_least_recently_used(void) {
+    TFT_eSPI tft;
+    tft.loadFont("Test", SPIFFS);
+    tft.fontCacheSize = 3 * tft.gCacheSlotSize; // Trzy miejsca
+    tft.loadFont("Test", SPIFFS);
+    TEST_ASSERT_EQUAL_UINT16(3, tft.gCacheSlots);
+
+    const uint16_t codes[] = {'a', 'b', 'c', 'a', 'd', 'a', 'b', 'c'};
+    const bool hits[] = {false, false, false, true, false, true, false, false};
+    for (size_t i = 0; i < sizeof(codes) / sizeof(codes[0]); i++) {
+        uint32_t before = tft.fontCacheHits;
+        tft.drawGlyph(codes[i]);
+        TEST_ASSERT_EQUAL_MESSAGE(hits[i], tft.fontCacheHits != before, "trafienie w pamieci podrecznej");
+    }
+    uint16_t index = 0;
+    tft.getUnicodeIndex('d', &index);
+    TEST_ASSERT_EQUAL_UINT16(0xFFFF, tft.gCacheSlot[index]); // 'd' wymienione po 'b' i 'c'
+
+    tft.unloadFont();
+    TEST_ASSERT_NULL(tft.gCacheArena);
+    TEST_ASSERT_EQUAL_UINT16(0, tft.gCacheSlots);
+}
+
+static double elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Porównanie z poprzednim kodem: wczytanie metryk, szukanie glifu i rysowanie z pliku
+void test_benchmark(void) {
+    char message[160];
+    const int loads = 200;
+    TFT_eSPI tft;
+
+    // Wczytanie metryk: odczyt po bajcie (poprzednio) i blokami
+    std::vector<uint16_t> unicode(1024);
+    std::vector<uint8_t> height(1024), width(1024);
+    fs::resetFileStats();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loads; i++) {
+        fs::File file = SPIFFS.open("/Test.vlw");
+        readMetricsByteByByte(file, unicode.data(), height.data(), width.data());
+    }
+    double oldNs = elapsedNs(start);
+    unsigned long oldReads = fs::fileStats.reads / loads;
+
+    fs::resetFileStats();
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loads; i++) tft.loadFont("Test", SPIFFS);
+    double newNs = elapsedNs(start);
+    unsigned long newReads = fs::fileStats.reads / loads;
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(unicode.data(), tft.gUnicode, tft.gFont.gCount);
+
+    snprintf(message, sizeof(message), "Metryki %u glifow: po bajcie %lu read() / %.1f us, blokami %lu read() / %.1f us",
+             tft.gFont.gCount, oldReads, oldNs / loads / 1000, newReads, newNs / loads / 1000);
+    TEST_MESSAGE(message);
+
+    // Szukanie glifu dla znaków tekstu
+    std::vector<uint16_t> text = sampleText();
+    const int rounds = 20000;
+    uint32_t sink = 0;
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (uint16_t code : text) {
+            uint16_t index = 0;
+            if (linearIndex(tft, code, &index)) sink += index;
+        }
+    }
+    oldNs = elapsedNs(start);
+    uint32_t oldSink = sink;
+    sink = 0;
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (uint16_t code : text) {
+            uint16_t index = 0;
+            if (tft.getUnicodeIndex(code, &index)) sink += index;
+        }
+    }
+    newNs = elapsedNs(start);
+    TEST_ASSERT_EQUAL_UINT32(oldSink, sink);
+
+    double lookups = (double)rounds * text.size();
+    snprintf(message, sizeof(message), "getUnicodeIndex() ns/znak: liniowo %.1f, binarnie %.1f",
+             oldNs / lookups, newNs / lookups);
+    TEST_MESSAGE(message);
+
+    // Rysowanie tekstu z pliku: odczyty wiersz po wierszu i z pamięci podręcznej
+    const int draws = 500;
+    for (int cached = 0; cached < 2; cached++) {
+        tft.fontCacheSize = cached ? SMOOTH_FONT_CACHE : 0;
+        tft.loadFont("Test", SPIFFS);
+        fs::resetFileStats();
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < draws; i++) {
+            tft.setCursor(0, 0);
+            tft.drawText(text);
+        }
+        double ns = elapsedNs(start);
+        snprintf(message, sizeof(message), "Rysowanie z pliku %s: %.1f read() i %.1f seek() na tekst, %.2f us na tekst",
+                 cached ? "z pamiecia podreczna" : "bez pamieci podrecznej", (double)fs::fileStats.reads / draws,
+                 (double)fs::fileStats.seeks / draws, ns / draws / 1000);
+        TEST_MESSAGE(message);
+    }
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_index_matches_linear_search);
+    RUN_TEST(test_metrics_are_read_in_blocks);
+    RUN_TEST(test_file_font_draws_like_array_font);
+    RUN_TEST(test_cached_glyphs_skip_the_file);
+    RUN_TEST(test_cache_evicts_least_recently_used);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,450 @@
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+// Prawdziwy TFT_eSPI (procesor Generic) z ekranem ILI9341 na atrapie SPI
+#define USER_SETUP_LOADED
+#define ILI9341_DRIVER
+#define TFT_CS 15
+#define TFT_DC 2
+#define TFT_RST -1
+#define TFT_MOSI 23
+#define TFT_SCLK 18
+#define TFT_MISO 19
+#define SPI_FREQUENCY 40000000
+#define DISABLE_ALL_LIBRARY_WARNINGS
+
+#include <Arduino.h>
+#include <FakeILI9341.h>
+#include "../../../lib/TFT_eSPI/TFT_eSPI.cpp"
+
+/**
+ * Sprite z kopią poprzednich pętli pushRotated() i pushToSprite(transp)
+ * (piksel po pikselu, z readPixel() i pushImage() dla każdego odcinka).
+ * Sprite docelowe też są OldSprite, żeby kopie miały dostęp do ich pól.
+ */
+class OldSprite : public TFT_eSprite {
+public:
+    explicit OldSprite(TFT_eSPI* tft) : TFT_eSprite(tft), display(tft) {}
+
+    // --- Poprzedni kod (odniesienie): obrót na ekran ---
+    bool oldPushRotated(int16_t angle, uint32_t transp = 0x00FFFFFF) {
+        if (!_created) return false;
+
+        int16_t min_x, min_y, max_x, max_y;
+        if (!getRotatedBounds(angle, &min_x, &min_y, &max_x, &max_y)) return false;
+
+        uint16_t sline_buffer[max_x - min_x + 1];
+
+        int32_t xt = min_x - display->getPivotX();
+        int32_t yt = min_y - display->getPivotY();
+        uint32_t xe = _dwidth << FP_SCALE;
+        uint32_t ye = _dheight << FP_SCALE;
+        uint16_t tpcolor = (uint16_t)transp;
+
+        if (transp != 0x00FFFFFF) {
+            if (_bpp == 4) tpcolor = _colorMap[transp & 0x0F];
+            tpcolor = tpcolor >> 8 | tpcolor << 8;
+        }
+        display->startWrite();
+
+        for (int32_t y = min_y; y <= max_y; y++, yt++) {
+            int32_t x = min_x;
+            uint32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+            uint32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+
+            while ((xs >= xe || ys >= ye) && x < max_x) { x++; xs += _cosra; ys += _sinra; }
+            if (x == max_x) continue;
+
+            uint32_t pixel_count = 0;
+            do {
+                uint32_t rp;
+                int32_t xp = xs >> FP_SCALE;
+                int32_t yp = ys >> FP_SCALE;
+                if (_bpp == 16) { rp = _img[xp + yp * _iwidth]; }
+                else { rp = readPixel(xp, yp); rp = (uint16_t)(rp >> 8 | rp << 8); }
+                if (transp != 0x00FFFFFF && tpcolor == rp) {
+                    if (pixel_count) {
+                        display->setWindow(x - pixel_count, y, x - 1, y);
+                        display->pushPixels(sline_buffer, pixel_count);
+                        pixel_count = 0;
+                    }
+                }
+                else {
+                    sline_buffer[pixel_count++] = rp;
+                }
+            } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
+            if (pixel_count) {
+                display->setWindow(x - pixel_count, y, x - 1, y);
+                display->pushPixels(sline_buffer, pixel_count);
+            }
+        }
+
+        display->endWrite();
+        return true;
+    }
+
+    // --- Poprzedni kod (odniesienie): obrót do innego sprite ---
+    bool oldPushRotated(OldSprite* spr, int16_t angle, uint32_t transp = 0x00FFFFFF) {
+        if (!_created || _bpp == 4) return false;
+        if (!spr->_created || spr->_bpp == 4) return false;
+
+        int16_t min_x, min_y, max_x, max_y;
+        if (!getRotatedBounds(spr, angle, &min_x, &min_y, &max_x, &max_y)) return false;
+
+        uint16_t sline_buffer[max_x - min_x + 1];
+
+        int32_t xt = min_x - spr->_xPivot;
+        int32_t yt = min_y - spr->_yPivot;
+        uint32_t xe = _dwidth << FP_SCALE;
+        uint32_t ye = _dheight << FP_SCALE;
+        uint16_t tpcolor = (uint16_t)transp;
+
+        if (transp != 0x00FFFFFF) {
+            if (_bpp == 4) tpcolor = _colorMap[transp & 0x0F];
+            tpcolor = tpcolor >> 8 | tpcolor << 8;
+        }
+
+        bool oldSwapBytes = spr->getSwapBytes();
+        spr->setSwapBytes(false);
+
+        for (int32_t y = min_y; y <= max_y; y++, yt++) {
+            int32_t x = min_x;
+            uint32_t xs = (_cosra * xt - (_sinra * yt - (_xPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+            uint32_t ys = (_sinra * xt + (_cosra * yt + (_yPivot << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+
+            while ((xs >= xe || ys >= ye) && x < max_x) { x++; xs += _cosra; ys += _sinra; }
+            if (x == max_x) continue;
+
+            uint32_t pixel_count = 0;
+            do {
+                uint32_t rp;
+                int32_t xp = xs >> FP_SCALE;
+                int32_t yp = ys >> FP_SCALE;
+                if (_bpp == 16) rp = _img[xp + yp * _iwidth];
+                else { rp = readPixel(xp, yp); rp = (uint16_t)(rp >> 8 | rp << 8); }
+                if (transp != 0x00FFFFFF && tpcolor == rp) {
+                    if (pixel_count) {
+                        spr->pushImage(x - pixel_count, y, pixel_count, 1, sline_buffer);
+                        pixel_count = 0;
+                    }
+                }
+                else {
+                    sline_buffer[pixel_count++] = rp;
+                }
+            } while (++x < max_x && (xs += _cosra) < xe && (ys += _sinra) < ye);
+            if (pixel_count) spr->pushImage(x - pixel_count, y, pixel_count, 1, sline_buffer);
+        }
+        spr->setSwapBytes(oldSwapBytes);
+        return true;
+    }
+
+    // --- Poprzedni kod (odniesienie): kopia z kolorem przezroczystym ---
+    bool oldPushToSprite(OldSprite* dspr, int32_t x, int32_t y, uint16_t transp) {
+        if (!_created || !dspr->_created) return false;
+
+        int8_t ds_bpp = dspr->getColorDepth();
+        if (_bpp == 16 && ds_bpp != 16 && ds_bpp != 8) return false;
+        if (_bpp == 8 && ds_bpp != 8) return false;
+        if (_bpp == 4 || ds_bpp == 4) return false;
+        if (_bpp == 1 && ds_bpp != 1) return false;
+
+        bool oldSwapBytes = dspr->getSwapBytes();
+        uint16_t sline_buffer[width()];
+
+        transp = transp >> 8 | transp << 8;
+
+        for (int32_t ys = 0; ys < height(); ys++) {
+            int32_t ox = x;
+            uint32_t pixel_count = 0;
+
+            for (int32_t xs = 0; xs < width(); xs++) {
+                uint16_t rp = 0;
+                if (_bpp == 16) rp = _img[xs + ys * width()];
+                else { rp = readPixel(xs, ys); rp = rp >> 8 | rp << 8; }
+
+                if (transp == rp) {
+                    if (pixel_count) {
+                        dspr->pushImage(ox, y, pixel_count, 1, sline_buffer);
+                        ox += pixel_count;
+                        pixel_count = 0;
+                    }
+                    ox++;
+                }
+                else {
+                    sline_buffer[pixel_count++] = rp;
+                }
+            }
+            if (pixel_count) dspr->pushImage(ox, y, pixel_count, 1, sline_buffer);
+            y++;
+        }
+        dspr->setSwapBytes(oldSwapBytes);
+        return true;
+    }
+
+private:
+    TFT_eSPI* display;
+};
+
+static TFT_eSPI tft;
+static FakeILI9341 panel(TFT_WIDTH, TFT_HEIGHT, TFT_DC);
+
+static const uint16_t PALETTE[16] = {TFT_BLACK,  TFT_NAVY,   TFT_DARKGREEN, TFT_DARKCYAN, TFT_MAROON, TFT_PURPLE,
+                                     TFT_OLIVE,  TFT_LIGHTGREY, TFT_DARKGREY, TFT_BLUE,  TFT_GREEN,  TFT_CYAN,
+                                     TFT_RED,    TFT_MAGENTA, TFT_YELLOW,   TFT_WHITE};
+
+// Sprite z pseudolosowym wzorem; co czwarty piksel ma kolor przezroczysty (TFT_BLACK lub indeks 0)
+static void fillPattern(TFT_eSprite& spr, int16_t w, int16_t h, uint8_t bpp, unsigned seed) {
+    spr.setColorDepth(bpp);
+    spr.createSprite(w, h);
+    if (bpp == 4) spr.createPalette(PALETTE);
+    srand(seed);
+    for (int16_t y = 0; y < h; y++) {
+        for (int16_t x = 0; x < w; x++) {
+            bool hole = rand() % 4 == 0;
+            uint16_t color = (uint16_t)rand();
+            if (bpp == 4) color = hole ? 0 : 1 + color % 15;
+            else if (bpp == 1) color = hole ? 0 : color & 1;
+            else if (hole) color = TFT_BLACK;
+            spr.drawPixel(x, y, color);
+        }
+    }
+}
+
+// Cała zawartość sprite jako kolory 565 (przez readPixel() bez obszaru widoku)
+static std::vector<uint16_t> contents(TFT_eSprite& spr) {
+    spr.resetViewport();
+    std::vector<uint16_t> pixels;
+    for (int16_t y = 0; y < spr.height(); y++) {
+        for (int16_t x = 0; x < spr.width(); x++) pixels.push_back(spr.readPixel(x, y));
+    }
+    return pixels;
+}
+
+static void checkEqual(const std::vector<uint16_t>& expected, const std::vector<uint16_t>& actual, const char* what) {
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(expected.size(), actual.size(), what);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY_MESSAGE(expected.data(), actual.data(), expected.size(), what);
+}
+
+static const int16_t ANGLES[] = {0, 7, 45, 90, 137, 180, 211, 270, 333, 359};
+
+void setUp(void) {
+    ArduinoShim::resetPins();
+    SPI.device = &panel;
+    tft.setPivot(TFT_WIDTH / 2, TFT_HEIGHT / 2);
+    tft.setBitmapColor(TFT_ORANGE, TFT_NAVY);
+}
+
+void tearDown(void) {
+    SPI.device = nullptr;
+}
+
+// Obrót na ekran: każda głębia sprite, z kolorem przezroczystym i bez, także poza krawędzią ekranu
+void test_rotated_to_tft_matches_previous(void) {
+    const uint8_t depths[] = {16, 8, 4, 1};
+    const int16_t pivots[][2] = {{TFT_WIDTH / 2, TFT_HEIGHT / 2}, {8, 5}, {TFT_WIDTH - 3, TFT_HEIGHT - 10}};
+    char what[80];
+
+    for (uint8_t bpp : depths) {
+        OldSprite spr(&tft);
+        fillPattern(spr, 37, 23, bpp, bpp);
+        spr.setPivot(11, 17);
+        for (int rotation = 0; rotation < (bpp == 1 ? 2 : 1); rotation++) {
+            spr.setRotation(rotation); // 1bpp z obrotem czyta piksele przez readPixel()
+            for (auto& pivot : pivots) {
+                tft.setPivot(pivot[0], pivot[1]);
+                for (int16_t angle : ANGLES) {
+                    for (int t = 0; t < 2; t++) {
+                        uint32_t transp = t ? (bpp == 4 ? 0 : (bpp == 1 ? TFT_NAVY : TFT_BLACK)) : 0x00FFFFFF;
+                        snprintf(what, sizeof(what), "%u bpp, obrot %d, kat %d, oparcie %d,%d, przezroczysty %d", bpp,
+                                 rotation, angle, pivot[0], pivot[1], t);
+
+                        panel.fill(0x1234);
+                        TEST_ASSERT_TRUE(spr.oldPushRotated(angle, transp));
+                        std::vector<uint16_t> expected = panel.pixels;
+
+                        panel.fill(0x1234);
+                        TEST_ASSERT_TRUE(spr.pushRotated(angle, transp));
+                        checkEqual(expected, panel.pixels, what);
+                    }
+                }
+            }
+        }
+        spr.deleteSprite();
+    }
+}
+
+// Obrót do sprite 16, 8 i 1 bpp, także z obszarem widoku i punktem odniesienia w sprite docelowym
+void test_rotated_to_sprite_matches_previous(void) {
+    const uint8_t sources[] = {16, 8, 1};
+    const uint8_t targets[] = {16, 8, 1};
+    char what[96];
+
+    for (uint8_t sbpp : sources) {
+        OldSprite src(&tft);
+        fillPattern(src, 41, 29, sbpp, 100 + sbpp);
+        src.setPivot(20, 3);
+        for (uint8_t dbpp : targets) {
+            for (int viewport = 0; viewport < 2; viewport++) {
+                for (int16_t angle : ANGLES) {
+                    for (int t = 0; t < 2; t++) {
+                        uint32_t transp = t ? (sbpp == 1 ? TFT_NAVY : TFT_BLACK) : 0x00FFFFFF;
+                        snprintf(what, sizeof(what), "%u -> %u bpp, widok %d, kat %d, przezroczysty %d", sbpp, dbpp,
+                                 viewport, angle, t);
+
+                        std::vector<uint16_t> results[2];
+                        for (int impl = 0; impl < 2; impl++) {
+                            OldSprite dst(&tft);
+                            fillPattern(dst, 53, 47, dbpp, 7);
+                            dst.setPivot(26, 40);
+                            if (viewport) dst.setViewport(6, 4, 40, 30);
+                            if (impl == 0) TEST_ASSERT_TRUE(src.oldPushRotated(&dst, angle, transp));
+                            else TEST_ASSERT_TRUE(src.pushRotated(&dst, angle, transp));
+                            results[impl] = contents(dst);
+                            dst.deleteSprite();
+                        }
+                        checkEqual(results[0], results[1], what);
+                    }
+                }
+            }
+        }
+        src.deleteSprite();
+    }
+}
+
+// Kopia z kolorem przezroczystym: położenia poza krawędziami, obszar widoku i zamiana bajtów w celu
+void test_push_to_sprite_matches_previous(void) {
+    const uint8_t pairs[][2] = {{16, 16}, {16, 8}, {8, 8}, {1, 1}};
+    const int32_t positions[][2] = {{0, 0}, {-5, -3}, {30, 20}, {45, -10}};
+    const uint16_t colors[] = {TFT_BLACK, TFT_WHITE, 0x1234, TFT_NAVY};
+    char what[112];
+
+    for (auto& pair : pairs) {
+        OldSprite src(&tft);
+        fillPattern(src, 33, 21, pair[0], 200 + pair[0]);
+        for (auto& position : positions) {
+            for (int mode = 0; mode < 3; mode++) { // 0: zwykły, 1: obszar widoku, 2: swapBytes w celu
+                for (uint16_t transp : colors) {
+                    snprintf(what, sizeof(what), "%u -> %u bpp, %d,%d, tryb %d, przezroczysty %04X", pair[0], pair[1],
+                             (int)position[0], (int)position[1], mode, transp);
+
+                    std::vector<uint16_t> results[2];
+                    for (int impl = 0; impl < 2; impl++) {
+                        OldSprite dst(&tft);
+                        fillPattern(dst, 50, 40, pair[1], 9);
+                        if (mode == 1) dst.setViewport(3, 5, 30, 25);
+                        dst.setSwapBytes(mode == 2);
+                        if (impl == 0) TEST_ASSERT_TRUE(src.oldPushToSprite(&dst, position[0], position[1], transp));
+                        else TEST_ASSERT_TRUE(src.pushToSprite(&dst, position[0], position[1], transp));
+                        TEST_ASSERT_EQUAL_MESSAGE(mode == 2, dst.getSwapBytes(), what);
+                        results[impl] = contents(dst);
+                        dst.deleteSprite();
+                    }
+                    checkEqual(results[0], results[1], what);
+                }
+            }
+        }
+        src.deleteSprite();
+    }
+}
+
+// Obrót o wielokrotność 90 stopni kopiuje wiersze lub kolumny 1:1
+void test_right_angles_copy_pixels_exactly(void) {
+    OldSprite src(&tft);
+    fillPattern(src, 20, 10, 16, 5);
+    src.setPivot(0, 0);
+    OldSprite dst(&tft);
+    dst.createSprite(40, 40);
+    dst.setPivot(20, 20);
+
+    const int16_t angles[] = {0, 90, 180, 270};
+    for (int16_t angle : angles) {
+        dst.fillSprite(TFT_WHITE);
+        TEST_ASSERT_TRUE(src.pushRotated(&dst, angle));
+        for (int16_t y = 0; y < 10; y++) {
+            for (int16_t x = 0; x < 20; x++) {
+                int16_t dx = x, dy = y;
+                if (angle == 90) { dx = -y; dy = x; }
+                if (angle == 180) { dx = -x; dy = -y; }
+                if (angle == 270) { dx = y; dy = -x; }
+                TEST_ASSERT_EQUAL_HEX16(src.readPixel(x, y), dst.readPixel(20 + dx, 20 + dy));
+            }
+        }
+    }
+    src.deleteSprite();
+    dst.deleteSprite();
+}
+
+static double elapsedNs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Porównanie z poprzednim kodem: ns na piksel sprite źródłowego
+void test_benchmark(void) {
+    char message[160];
+    const int rounds = 200;
+    OldSprite dst16(&tft), dst8(&tft);
+    dst16.createSprite(200, 200);
+    dst16.setPivot(100, 100);
+    dst8.setColorDepth(8);
+    dst8.createSprite(200, 200);
+    dst8.setPivot(100, 100);
+
+    struct Case {
+        const char* name;
+        uint8_t sbpp;
+        OldSprite* dst;
+        int16_t angle;
+        uint32_t transp;
+    } cases[] = {
+        {"obrot 16->16 bpp o 90", 16, &dst16, 90, 0x00FFFFFF},
+        {"obrot 16->16 bpp o 30", 16, &dst16, 30, 0x00FFFFFF},
+        {"obrot 16->16 bpp o 30, przezroczysty", 16, &dst16, 30, TFT_BLACK},
+        {"obrot 8->16 bpp o 30", 8, &dst16, 30, 0x00FFFFFF},
+        {"obrot 16->8 bpp o 30", 16, &dst8, 30, 0x00FFFFFF},
+        {"pushToSprite 16->16 bpp, przezroczysty", 16, &dst16, -1, TFT_BLACK},
+        {"pushToSprite 8->8 bpp, przezroczysty", 8, &dst8, -1, TFT_BLACK},
+    };
+
+    for (auto& c : cases) {
+        OldSprite src(&tft);
+        fillPattern(src, 120, 120, c.sbpp, 1);
+        src.setPivot(60, 60);
+        double pixels = 120.0 * 120.0 * rounds;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            if (c.angle < 0) src.oldPushToSprite(c.dst, 40, 40, c.transp);
+            else src.oldPushRotated(c.dst, c.angle, c.transp);
+        }
+        double oldNs = elapsedNs(start);
+        std::vector<uint16_t> expected = contents(*c.dst);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            if (c.angle < 0) src.pushToSprite(c.dst, 40, 40, c.transp);
+            else src.pushRotated(c.dst, c.angle, c.transp);
+        }
+        double newNs = elapsedNs(start);
+        checkEqual(expected, contents(*c.dst), c.name);
+
+        snprintf(message, sizeof(message), "%s: poprzednio %.2f ns/piksel, teraz %.2f ns/piksel", c.name,
+                 oldNs / pixels, newNs / pixels);
+        TEST_MESSAGE(message);
+        src.deleteSprite();
+    }
+    dst16.deleteSprite();
+    dst8.deleteSprite();
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_rotated_to_tft_matches_previous);
+    RUN_TEST(test_rotated_to_sprite_matches_previous);
+    RUN_TEST(test_push_to_sprite_matches_previous);
+    RUN_TEST(test_right_angles_copy_pixels_exactly);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,193 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <SPI.h>
+#include <FakeXPT2046.h>
+
+// Prawdziwy sterownik zamiast atrapy z shims (ten sam katalog ma pierwszeństwo)
+#include "../../../lib/XPT2046_Touchscreen/XPT2046_Touchscreen.cpp"
+
+static const uint8_t TOUCH_CS_PIN = 33;
+static const uint8_t TOUCH_IRQ_PIN = 36;
+static const unsigned long POLL_MS = 30; // Okres odczytu wejść LVGL (LV_DEF_REFR_PERIOD)
+
+SPIClass bus(VSPI);
+FakeXPT2046 device;
+XPT2046_Touchscreen touch(TOUCH_CS_PIN, TOUCH_IRQ_PIN);
+
+void setUp() {
+    ArduinoShim::resetClock();
+    ArduinoShim::advanceMillis(1000);
+    device = FakeXPT2046();
+    bus.device = &device;
+    touch = XPT2046_Touchscreen(TOUCH_CS_PIN, TOUCH_IRQ_PIN);
+    touch.begin(bus);
+    touch.setRotation(1);
+    bus.resetCounters();
+}
+
+void tearDown() {}
+
+// Sekwencja jak w my_touch_read przed zmianą
+static bool readOld(TS_Point& point) {
+    if (!touch.touched()) return false;
+    point = touch.getPoint();
+    return true;
+}
+
+// --- Unit tests ---
+void test_read_sample_uses_one_transaction() {
+    device.press(1200, 3100);
+    TS_Sample sample = touch.readSample();
+    TEST_ASSERT_TRUE(sample.valid);
+    TEST_ASSERT_EQUAL(1200, sample.x);
+    TEST_ASSERT_EQUAL(3100, sample.y);
+    TEST_ASSERT_EQUAL(2000, sample.z);
+    TEST_ASSERT_EQUAL(1, bus.transactions);
+    TEST_ASSERT_EQUAL(10, bus.transfers); // Z1, Z2, X (pomiar odrzucany), 3 x XY, wyłączenie, ostatni wynik
+    TEST_ASSERT_EQUAL(MSBFIRST, bus.settings.bitOrder);
+    TEST_ASSERT_EQUAL(HIGH, digitalRead(TOUCH_CS_PIN));
+}
+
+void test_read_sample_matches_touched_and_get_point() {
+    static const uint16_t points[][2] = {{0, 0}, {4095, 4095}, {200, 3900}, {2048, 17}};
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+        touch.setRotation(rotation);
+        for (const auto& p : points) {
+            device.press(p[0], p[1]);
+            ArduinoShim::advanceMillis(POLL_MS);
+            TS_Point point;
+            TEST_ASSERT_TRUE(readOld(point));
+
+            ArduinoShim::advanceMillis(POLL_MS);
+            TS_Sample sample = touch.readSample();
+            TEST_ASSERT_TRUE(sample.valid);
+            TEST_ASSERT_EQUAL(point.x, sample.x);
+            TEST_ASSERT_EQUAL(point.y, sample.y);
+            TEST_ASSERT_EQUAL(point.z, sample.z);
+        }
+    }
+}
+
+void test_release_skips_spi_until_irq() {
+    device.press(1000, 1000);
+    TEST_ASSERT_TRUE(touch.readSample().valid);
+
+    device.release();
+    ArduinoShim::advanceMillis(POLL_MS);
+    TS_Sample sample = touch.readSample();
+    TEST_ASSERT_FALSE(sample.valid);
+    TEST_ASSERT_EQUAL(0, sample.x);
+    TEST_ASSERT_EQUAL(0, sample.z);
+    TEST_ASSERT_FALSE(touch.isrWake);
+
+    // Bez zbocza na TIRQ kolejne odczyty nie dotykają magistrali
+    bus.resetCounters();
+    for (int i = 0; i < 100; i++) {
+        ArduinoShim::advanceMillis(POLL_MS);
+        TEST_ASSERT_FALSE(touch.readSample().valid);
+    }
+    TEST_ASSERT_EQUAL(0, bus.transactions);
+    TEST_ASSERT_EQUAL(0, bus.transfers);
+
+    device.press(500, 600);
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    sample = touch.readSample();
+    TEST_ASSERT_TRUE(sample.valid);
+    TEST_ASSERT_EQUAL(500, sample.x);
+    TEST_ASSERT_EQUAL(1, bus.transactions);
+}
+
+void test_light_touch_keeps_irq_armed() {
+    device.press(1000, 1000, 200); // Poniżej progu dotyku, powyżej progu przerwania
+    TS_Sample sample = touch.readSample();
+    TEST_ASSERT_FALSE(sample.valid);
+    TEST_ASSERT_EQUAL(0, sample.x);
+    TEST_ASSERT_TRUE(touch.isrWake);
+
+    // Bez poprawnego odczytu nie ma 3 ms przerwy - każde wywołanie mierzy ponownie
+    device.press(1000, 1000);
+    sample = touch.readSample();
+    TEST_ASSERT_TRUE(sample.valid);
+    TEST_ASSERT_EQUAL(2, bus.transactions);
+}
+
+void test_samples_within_3ms_reuse_last_read() {
+    device.press(1000, 2000);
+    TEST_ASSERT_TRUE(touch.readSample().valid);
+
+    device.press(3000, 100);
+    ArduinoShim::advanceMillis(2);
+    TS_Sample sample = touch.readSample();
+    TEST_ASSERT_TRUE(sample.valid);
+    TEST_ASSERT_EQUAL(1000, sample.x);
+    TEST_ASSERT_EQUAL(1, bus.transactions);
+
+    ArduinoShim::advanceMillis(1);
+    sample = touch.readSample();
+    TEST_ASSERT_EQUAL(3000, sample.x);
+    TEST_ASSERT_EQUAL(2, bus.transactions);
+}
+
+// --- Koszt odczytu: sesja 10 s bez dotyku, 2 s dotyku i znów 10 s bez dotyku ---
+struct BusCost {
+    uint32_t transactions;
+    uint32_t transfers;
+};
+
+static BusCost runSession(bool useReadSample) {
+    bus.resetCounters();
+    device.release();
+    for (unsigned long t = 0; t < 22000; t += POLL_MS) {
+        bool pressing = t >= 10000 && t < 12000;
+        if (pressing && device.z1 == 0) {
+            device.press(1500 + t % 7, 2500);
+            ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+        } else if (!pressing) {
+            device.release();
+        }
+
+        if (useReadSample) {
+            TEST_ASSERT_EQUAL(pressing, touch.readSample().valid);
+        } else {
+            TS_Point point;
+            TEST_ASSERT_EQUAL(pressing, readOld(point));
+        }
+        ArduinoShim::advanceMillis(POLL_MS);
+    }
+    return {bus.transactions, bus.transfers};
+}
+
+void test_touch_bus_cost() {
+    BusCost old = runSession(false);
+    BusCost sample = runSession(true);
+
+    // Ta sama sesja bez linii TIRQ: każdy odczyt idzie przez SPI
+    touch = XPT2046_Touchscreen(TOUCH_CS_PIN);
+    touch.begin(bus);
+    BusCost polled = runSession(true);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "touched()+getPoint(): %u transakcji / %u transferow SPI",
+             (unsigned)old.transactions, (unsigned)old.transfers);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "readSample() z TIRQ:  %u transakcji / %u transferow SPI",
+             (unsigned)sample.transactions, (unsigned)sample.transfers);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "readSample() bez TIRQ: %u transakcji / %u transferow SPI",
+             (unsigned)polled.transactions, (unsigned)polled.transfers);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_LESS_OR_EQUAL(old.transactions, sample.transactions);
+    TEST_ASSERT_LESS_THAN(polled.transactions, sample.transactions);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_read_sample_uses_one_transaction);
+    RUN_TEST(test_read_sample_matches_touched_and_get_point);
+    RUN_TEST(test_release_skips_spi_until_irq);
+    RUN_TEST(test_light_touch_keeps_irq_armed);
+    RUN_TEST(test_samples_within_3ms_reuse_last_read);
+    RUN_TEST(test_touch_bus_cost);
+    return UNITY_END();
+}
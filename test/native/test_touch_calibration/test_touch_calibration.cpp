@@ -0,0 +1,270 @@
+#include <unity.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <Arduino.h>
+#include <Preferences.h>
+#include <TouchCalibration.h>
+
+static const uint16_t WIDTH = 320;
+static const uint16_t HEIGHT = 240;
+static const TouchPoint TARGETS[3] = {{32, 24}, {288, 120}, {160, 216}};
+
+// Model panelu: piksel -> surowy odczyt (dowolne przekształcenie afiniczne)
+struct Panel {
+    double ax, bx, cx, ay, by, cy;
+
+    TouchPoint raw(double x, double y) const {
+        return {(int32_t)lround(ax * x + bx * y + cx), (int32_t)lround(ay * x + by * y + cy)};
+    }
+};
+
+static const Panel PANELS[] = {
+    {10.0, 0, 400, 0, 14.2, 300},        // Jak domyślny zakres 400-3600 / 300-3700
+    {-10.5, 0, 3700, 0, -14.8, 3800},    // Obie osie odwrócone
+    {0, 13.5, 350, 11.2, 0, 200},        // Osie zamienione (panel obrócony o 90 stopni)
+    {10.1, 0.6, 380, -0.4, -14.1, 3750}, // Lekko obrócony i pochylony
+};
+
+static bool calibrate(TouchCalibration& calibration, const Panel& panel) {
+    TouchPoint raw[3];
+    for (int i = 0; i < 3; i++) raw[i] = panel.raw(TARGETS[i].x, TARGETS[i].y);
+    return calibration.compute(TARGETS, raw, WIDTH, HEIGHT);
+}
+
+// --- Poprzednie przeliczanie z my_touch_read (odniesienie) ---
+struct MinMaxMapping {
+    uint16_t minX = 400, maxX = 3600, minY = 300, maxY = 3700;
+
+    static long arduinoMap(long x, long in_min, long in_max, long out_min, long out_max) {
+        return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+    }
+
+    void apply(uint16_t rawX, uint16_t rawY, int32_t& x, int32_t& y) {
+        minX = rawX < minX ? rawX : minX;
+        maxX = rawX > maxX ? rawX : maxX;
+        minY = rawY < minY ? rawY : minY;
+        maxY = rawY > maxY ? rawY : maxY;
+        x = arduinoMap(rawX, minX, maxX, 1, WIDTH);
+        y = arduinoMap(rawY, minY, maxY, 1, HEIGHT);
+    }
+};
+
+static uint32_t seed = 1;
+static double uniform() {
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) / 16777216.0;
+}
+static double gaussian() {
+    return sqrt(-2.0 * log(uniform() + 1e-12)) * cos(2.0 * PI * uniform());
+}
+
+void setUp() {
+    PreferencesShim::reset();
+    seed = 1;
+}
+
+void tearDown() {}
+
+// --- Unit tests ---
+void test_affine_panels_map_to_pixels() {
+    for (const Panel& panel : PANELS) {
+        TouchCalibration calibration;
+        TEST_ASSERT_TRUE(calibrate(calibration, panel));
+
+        // Cały ekran co 4 piksele: najwyżej 1 piksel od położenia rzeczywistego
+        for (int32_t py = 0; py < HEIGHT; py += 4) {
+            for (int32_t px = 0; px < WIDTH; px += 4) {
+                TouchPoint raw = panel.raw(px, py);
+                int32_t x, y;
+                calibration.apply(raw.x, raw.y, x, y);
+                TEST_ASSERT_INT_WITHIN(1, px, x);
+                TEST_ASSERT_INT_WITHIN(1, py, y);
+            }
+        }
+    }
+}
+
+void test_targets_map_exactly() {
+    TouchCalibration calibration;
+    TEST_ASSERT_TRUE(calibrate(calibration, PANELS[3]));
+    for (const TouchPoint& target : TARGETS) {
+        TouchPoint raw = PANELS[3].raw(target.x, target.y);
+        int32_t x, y;
+        calibration.apply(raw.x, raw.y, x, y);
+        TEST_ASSERT_EQUAL(target.x, x);
+        TEST_ASSERT_EQUAL(target.y, y);
+    }
+}
+
+void test_output_is_clamped_to_screen() {
+    TouchCalibration calibration;
+    TEST_ASSERT_TRUE(calibrate(calibration, PANELS[0]));
+    int32_t x, y;
+    calibration.apply(0, 0, x, y);
+    TEST_ASSERT_EQUAL(0, x);
+    TEST_ASSERT_EQUAL(0, y);
+    calibration.apply(4095, 4095, x, y);
+    TEST_ASSERT_EQUAL(WIDTH - 1, x);
+    TEST_ASSERT_EQUAL(HEIGHT - 1, y);
+}
+
+void test_bad_points_are_rejected() {
+    TouchCalibration calibration;
+    TEST_ASSERT_FALSE(calibration.valid());
+
+    const TouchPoint collinear[3] = {{500, 500}, {1000, 1000}, {2000, 2000}};
+    TEST_ASSERT_FALSE(calibration.compute(TARGETS, collinear, WIDTH, HEIGHT));
+
+    // Trzy dotknięcia w prawie tym samym miejscu - skala poza zakresem
+    const TouchPoint same[3] = {{2000, 2000}, {2010, 2001}, {2001, 2012}};
+    TEST_ASSERT_FALSE(calibration.compute(TARGETS, same, WIDTH, HEIGHT));
+    TEST_ASSERT_FALSE(calibration.valid());
+    TEST_ASSERT_FALSE(calibration.save());
+}
+
+void test_calibration_survives_restart() {
+    TouchCalibration calibration;
+    TEST_ASSERT_TRUE(calibrate(calibration, PANELS[2]));
+    TEST_ASSERT_TRUE(calibration.save());
+    TEST_ASSERT_EQUAL(1, PreferencesShim::writes);
+
+    TouchCalibration loaded;
+    TEST_ASSERT_TRUE(loaded.load(WIDTH, HEIGHT));
+    for (int32_t raw = 0; raw < 4096; raw += 97) {
+        int32_t x1, y1, x2, y2;
+        calibration.apply(raw, 4095 - raw, x1, y1);
+        loaded.apply(raw, 4095 - raw, x2, y2);
+        TEST_ASSERT_EQUAL(x1, x2);
+        TEST_ASSERT_EQUAL(y1, y2);
+    }
+
+    // Inny ekran lub inny format zapisu wymaga nowej kalibracji
+    TEST_ASSERT_FALSE(TouchCalibration().load(HEIGHT, WIDTH));
+    Preferences prefs;
+    prefs.begin("touch");
+    uint8_t stored[64] = {};
+    size_t len = prefs.getBytes("cal", stored, sizeof(stored));
+    stored[0]++; // Wersja
+    prefs.putBytes("cal", stored, len);
+    prefs.end();
+    TEST_ASSERT_FALSE(TouchCalibration().load(WIDTH, HEIGHT));
+
+    TouchCalibration::erase();
+    TEST_ASSERT_FALSE(TouchCalibration().load(WIDTH, HEIGHT));
+}
+
+// --- Dokładność ---
+struct MappingError {
+    double mean;
+    int max;
+};
+
+// Losowe dotknięcia z szumem odczytu po filtrze (sigma LSB), błąd w pikselach względem położenia rzeczywistego
+template <typename Mapping>
+static MappingError sessionError(Mapping& mapping, const Panel& panel, double sigma, int touches) {
+    double sum = 0;
+    int worst = 0;
+    for (int i = 0; i < touches; i++) {
+        double px = uniform() * (WIDTH - 1), py = uniform() * (HEIGHT - 1);
+        TouchPoint raw = panel.raw(px, py);
+        int32_t rx = constrain((int32_t)lround(raw.x + gaussian() * sigma), 0, 4095);
+        int32_t ry = constrain((int32_t)lround(raw.y + gaussian() * sigma), 0, 4095);
+        int32_t x, y;
+        mapping.apply(rx, ry, x, y);
+        double error = hypot(x - px, y - py);
+        sum += error;
+        worst = std::max(worst, (int)lround(error));
+    }
+    return {sum / touches, worst};
+}
+
+struct CalibrationMapping {
+    TouchCalibration calibration;
+    void apply(int32_t rx, int32_t ry, int32_t& x, int32_t& y) { calibration.apply(rx, ry, x, y); }
+};
+
+void test_accuracy_against_running_min_max() {
+    // Panel o innym zakresie niż domyślny - dawne min/max dochodzi do niego dopiero przy skrajnych dotknięciach
+    const Panel panel = {11.0, 0, 250, 0, 15.0, 180};
+    const double sigma = 6;
+    char msg[160];
+    TEST_MESSAGE("Blad polozenia [px] po kolejnych dotknieciach (szum 6 LSB): srednio / max");
+
+    MinMaxMapping old;
+    CalibrationMapping calibrated;
+
+    // Kalibracja z zaszumionych celów: średnia z 20 odczytów na cel, jak w calibration_touch()
+    TouchPoint raw[3];
+    for (int i = 0; i < 3; i++) {
+        double sx = 0, sy = 0;
+        for (int n = 0; n < 20; n++) {
+            TouchPoint exact = panel.raw(TARGETS[i].x, TARGETS[i].y);
+            sx += exact.x + gaussian() * sigma;
+            sy += exact.y + gaussian() * sigma;
+        }
+        raw[i] = {(int32_t)lround(sx / 20), (int32_t)lround(sy / 20)};
+    }
+    TEST_ASSERT_TRUE(calibrated.calibration.compute(TARGETS, raw, WIDTH, HEIGHT));
+
+    MappingError oldFirst = sessionError(old, panel, sigma, 50);
+    MappingError oldLater = sessionError(old, panel, sigma, 5000);
+    MappingError calFirst = sessionError(calibrated, panel, sigma, 50);
+    MappingError calLater = sessionError(calibrated, panel, sigma, 5000);
+
+    snprintf(msg, sizeof(msg), "min/max + map(): pierwsze 50 %.1f / %d, kolejne 5000 %.1f / %d",
+             oldFirst.mean, oldFirst.max, oldLater.mean, oldLater.max);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "kalibracja 3 pkt: pierwsze 50 %.1f / %d, kolejne 5000 %.1f / %d",
+             calFirst.mean, calFirst.max, calLater.mean, calLater.max);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_TRUE(calFirst.mean < 2);
+    TEST_ASSERT_TRUE(calFirst.mean < oldFirst.mean);
+    TEST_ASSERT_TRUE(calLater.mean <= oldLater.mean);
+}
+
+// --- Benchmark ---
+void test_mapping_throughput() {
+    const int samples = 4000000;
+    static uint16_t raws[1024];
+    for (uint16_t& raw : raws) raw = (uint16_t)(300 + rand() % 3400);
+    volatile int32_t sink = 0;
+
+    MinMaxMapping old;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++) {
+        int32_t x, y;
+        old.apply(raws[i & 1023], raws[(i + 1) & 1023], x, y);
+        sink = sink + x + y;
+    }
+    double oldNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    TouchCalibration calibration;
+    TEST_ASSERT_TRUE(calibrate(calibration, PANELS[3]));
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < samples; i++) {
+        int32_t x, y;
+        calibration.apply(raws[i & 1023], raws[(i + 1) & 1023], x, y);
+        sink = sink + x + y;
+    }
+    double calNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    char message[160];
+    snprintf(message, sizeof(message), "ns/punkt: min/max + 2x map() %.2f, TouchCalibration::apply() %.2f",
+             oldNs / samples, calNs / samples);
+    TEST_MESSAGE(message);
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_affine_panels_map_to_pixels);
+    RUN_TEST(test_targets_map_exactly);
+    RUN_TEST(test_output_is_clamped_to_screen);
+    RUN_TEST(test_bad_points_are_rejected);
+    RUN_TEST(test_calibration_survives_restart);
+    RUN_TEST(test_accuracy_against_running_min_max);
+    RUN_TEST(test_mapping_throughput);
+    return UNITY_END();
+}
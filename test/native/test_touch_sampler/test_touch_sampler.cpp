@@ -0,0 +1,353 @@
+#include <unity.h>
+#include <Arduino.h>
+#include <SPI.h>
+#include <FakeXPT2046.h>
+#include <TouchSampler.h>
+#include <math.h>
+
+// Sterownik XPT2046_Touchscreen jako punkt odniesienia dla filtru
+#include "../../../lib/XPT2046_Touchscreen/XPT2046_Touchscreen.cpp"
+
+static const uint8_t TOUCH_CS_PIN = 33;
+static const uint8_t TOUCH_IRQ_PIN = 36;
+
+/**
+ * Panel z szumem przetwornika: szum gaussowski oraz rzadkie duże skoki
+ * (np. drgania styku przy słabym nacisku). Generator ze stałym ziarnem,
+ * więc każde uruchomienie daje ten sam przebieg.
+ */
+class NoisyPanel : public FakeXPT2046 {
+public:
+    double sigma = 0;         // Odchylenie standardowe szumu w LSB
+    double spikeChance = 0;   // Prawdopodobieństwo skoku w jednej konwersji
+    int spikeAmplitude = 0;   // Największy skok w LSB
+    uint32_t seed = 12345;
+
+protected:
+    uint16_t convert(uint8_t channel) override {
+        int value = FakeXPT2046::convert(channel);
+        if (channel == CHANNEL_X || channel == CHANNEL_Y) {
+            value += (int)lround(gaussian() * sigma);
+            if (uniform() < spikeChance) value += (int)((uniform() * 2 - 1) * spikeAmplitude);
+        }
+        return (uint16_t)constrain(value, 0, 4095);
+    }
+
+private:
+    double uniform() {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) / 16777216.0;
+    }
+
+    double gaussian() {
+        double u1 = uniform() + 1e-12;
+        double u2 = uniform();
+        return sqrt(-2.0 * log(u1)) * cos(2.0 * PI * u2);
+    }
+};
+
+SPIClass bus(VSPI);
+NoisyPanel panel;
+
+void setUp() {
+    ArduinoShim::resetClock();
+    ArduinoShim::advanceMillis(1000);
+    panel = NoisyPanel();
+    bus.device = &panel;
+    bus.resetCounters();
+}
+
+void tearDown() {}
+
+static TouchSamplerConfig makeConfig(uint8_t oversample, uint8_t iirShift) {
+    TouchSamplerConfig config;
+    config.oversample = oversample;
+    config.iirShift = iirShift;
+    return config;
+}
+
+// Pierwszy krok po begin() sprawdza, czy palec nie był na ekranie już przy starcie
+static void settle(TouchSampler& sampler) {
+    sampler.begin();
+    sampler.step();
+    bus.resetCounters();
+}
+
+// --- Unit tests ---
+void test_median_of_odd_and_even_counts() {
+    const uint16_t odd[] = {900, 10, 500, 4095, 480};
+    TEST_ASSERT_EQUAL(500, TouchFilter::median(odd, 5));
+    const uint16_t even[] = {7, 3, 100, 4};
+    TEST_ASSERT_EQUAL(6, TouchFilter::median(even, 4));
+    const uint16_t one[] = {1234};
+    TEST_ASSERT_EQUAL(1234, TouchFilter::median(one, 1));
+}
+
+void test_iir_filter_starts_without_lag() {
+    TouchFilter filter(2);
+    uint16_t xs[] = {1000}, ys[] = {2000};
+    uint16_t x, y;
+    filter.apply(xs, ys, 1, x, y);
+    TEST_ASSERT_EQUAL(1000, x);
+    TEST_ASSERT_EQUAL(2000, y);
+
+    xs[0] = 1400;
+    filter.apply(xs, ys, 1, x, y);
+    TEST_ASSERT_EQUAL(1100, x); // Krok 1/4
+
+    filter.reset();
+    filter.apply(xs, ys, 1, x, y);
+    TEST_ASSERT_EQUAL(1400, x);
+}
+
+void test_queue_is_fifo_and_counts_drops() {
+    TouchQueue<4> queue;
+    TouchEvent event = {};
+    for (uint16_t i = 0; i < 5; i++) {
+        event.x = i;
+        TEST_ASSERT_EQUAL(i < 4, queue.push(event));
+    }
+    TEST_ASSERT_EQUAL(1, queue.dropped());
+    TEST_ASSERT_EQUAL(4, queue.size());
+    for (uint16_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(queue.pop(event));
+        TEST_ASSERT_EQUAL(i, event.x);
+    }
+    TEST_ASSERT_FALSE(queue.pop(event));
+    TEST_ASSERT_TRUE(queue.empty());
+}
+
+void test_batch_is_one_spi_transaction() {
+    TouchSampler sampler(bus, TOUCH_CS_PIN, TOUCH_IRQ_PIN, makeConfig(7, 0));
+    settle(sampler);
+
+    panel.press(1500, 2500);
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    TEST_ASSERT_TRUE(sampler.step());
+    TEST_ASSERT_EQUAL(1, bus.transactions);
+    TEST_ASSERT_EQUAL(1, bus.transfers);
+    TEST_ASSERT_EQUAL(2 * (4 + 2 * 7) + 1, bus.bytes);
+    TEST_ASSERT_EQUAL(HIGH, digitalRead(TOUCH_CS_PIN));
+
+    TouchEvent event;
+    TEST_ASSERT_TRUE(sampler.read(event));
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_EQUAL(1500, event.x);
+    TEST_ASSERT_EQUAL(2500, event.y);
+    TEST_ASSERT_EQUAL(2000, event.z);
+    TEST_ASSERT_EQUAL(millis(), event.timeMs);
+}
+
+void test_idle_panel_waits_for_irq_without_spi() {
+    TouchSampler sampler(bus, TOUCH_CS_PIN, TOUCH_IRQ_PIN);
+    sampler.begin();
+    TEST_ASSERT_FALSE(sampler.step()); // Sprawdzenie przy starcie: brak dotyku
+    TEST_ASSERT_EQUAL(1, bus.transactions);
+
+    for (int i = 0; i < 100; i++) {
+        ArduinoShim::advanceMillis(10);
+        TEST_ASSERT_FALSE(sampler.step());
+    }
+    TEST_ASSERT_EQUAL(1, bus.transactions);
+    TEST_ASSERT_FALSE(sampler.available());
+}
+
+void test_press_move_and_release_events() {
+    TouchSampler sampler(bus, TOUCH_CS_PIN, TOUCH_IRQ_PIN, makeConfig(5, 0));
+    settle(sampler);
+
+    panel.press(1000, 1000);
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    for (uint16_t i = 0; i < 3; i++) {
+        panel.press(1000 + 100 * i, 1000);
+        TEST_ASSERT_TRUE(sampler.step());
+        ArduinoShim::advanceMillis(10);
+    }
+    panel.release();
+    TEST_ASSERT_FALSE(sampler.step());
+
+    TouchEvent event;
+    for (uint16_t i = 0; i < 3; i++) {
+        TEST_ASSERT_TRUE(sampler.read(event));
+        TEST_ASSERT_TRUE(event.pressed);
+        TEST_ASSERT_EQUAL(1000 + 100 * i, event.x);
+        TEST_ASSERT_EQUAL(1000 + 10 * i, event.timeMs);
+    }
+    TEST_ASSERT_TRUE(sampler.read(event));
+    TEST_ASSERT_FALSE(event.pressed);
+    TEST_ASSERT_EQUAL(1200, event.x); // Puszczenie w miejscu ostatniego dotyku
+    TEST_ASSERT_EQUAL(0, event.z);
+    TEST_ASSERT_FALSE(sampler.read(event));
+
+    // Po puszczeniu zadanie śpi do kolejnego przerwania
+    bus.resetCounters();
+    ArduinoShim::advanceMillis(10);
+    TEST_ASSERT_FALSE(sampler.step());
+    TEST_ASSERT_EQUAL(0, bus.transactions);
+}
+
+void test_light_touch_keeps_sampling_without_events() {
+    TouchSampler sampler(bus, TOUCH_CS_PIN, TOUCH_IRQ_PIN);
+    settle(sampler);
+
+    panel.press(1000, 1000, 200); // Między releaseThreshold a pressThreshold
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    TEST_ASSERT_TRUE(sampler.step());
+    TEST_ASSERT_TRUE(sampler.step()); // PENIRQ wciąż niski - bez próbkowania nie byłoby zbocza
+    TEST_ASSERT_FALSE(sampler.available());
+    TEST_ASSERT_EQUAL(2, bus.transactions);
+
+    panel.press(1000, 1000);
+    TEST_ASSERT_TRUE(sampler.step());
+    TEST_ASSERT_TRUE(sampler.available());
+}
+
+void test_release_waits_for_queue_space() {
+    TouchSampler sampler(bus, TOUCH_CS_PIN, TOUCH_IRQ_PIN);
+    settle(sampler);
+
+    panel.press(2000, 2000);
+    ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+    for (size_t i = 0; i < TouchSampler::QUEUE_SIZE + 2; i++) sampler.step();
+    TEST_ASSERT_EQUAL(2, sampler.dropped());
+
+    panel.release();
+    TEST_ASSERT_TRUE(sampler.step()); // Pełna kolejka - puszczenie czeka
+    TouchEvent event;
+    TEST_ASSERT_TRUE(sampler.read(event));
+
+    bus.resetCounters();
+    TEST_ASSERT_FALSE(sampler.step());
+    TEST_ASSERT_EQUAL(0, bus.transactions);
+    for (size_t i = 0; i < TouchSampler::QUEUE_SIZE; i++) TEST_ASSERT_TRUE(sampler.read(event));
+    TEST_ASSERT_FALSE(event.pressed);
+    TEST_ASSERT_EQUAL(2000, event.x);
+}
+
+// --- Dokładność na zaszumionych danych ---
+struct FilterError {
+    double rms;
+    int max;
+};
+
+static void addError(double& sum, int& worst, int error) {
+    sum += (double)error * error;
+    if (abs(error) > worst) worst = abs(error);
+}
+
+// Palec nieruchomo w wielu punktach ekranu, błąd każdego odczytu względem położenia rzeczywistego
+static FilterError samplerError(const TouchSamplerConfig& config) {
+    double sum = 0;
+    int worst = 0, count = 0;
+    for (uint16_t px = 300; px < 4000; px += 700) {
+        TouchSampler sampler(bus, TOUCH_CS_PIN, TOUCH_IRQ_PIN, config);
+        settle(sampler);
+        panel.press(px, 4095 - px);
+        ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+        for (int i = 0; i < 200; i++) {
+            sampler.step();
+            TouchEvent event;
+            TEST_ASSERT_TRUE(sampler.read(event));
+            if (i < 8) continue; // Ustalenie filtru IIR
+            addError(sum, worst, event.x - px);
+            addError(sum, worst, event.y - (4095 - px));
+            count += 2;
+            ArduinoShim::advanceMillis(config.periodMs);
+        }
+        panel.release();
+        sampler.step();
+    }
+    return {sqrt(sum / count), worst};
+}
+
+static FilterError driverError() {
+    double sum = 0;
+    int worst = 0, count = 0;
+    for (uint16_t px = 300; px < 4000; px += 700) {
+        XPT2046_Touchscreen touch(TOUCH_CS_PIN, TOUCH_IRQ_PIN);
+        touch.begin(bus);
+        touch.setRotation(1);
+        panel.press(px, 4095 - px);
+        for (int i = 0; i < 200; i++) {
+            ArduinoShim::advanceMillis(10);
+            TS_Sample sample = touch.readSample();
+            TEST_ASSERT_TRUE(sample.valid);
+            if (i < 8) continue;
+            addError(sum, worst, sample.x - px);
+            addError(sum, worst, sample.y - (4095 - px));
+            count += 2;
+        }
+        detachInterrupt(TOUCH_IRQ_PIN); // Przerwanie wskazywałoby na usunięty sterownik
+    }
+    return {sqrt(sum / count), worst};
+}
+
+void test_noisy_stream_filter_accuracy() {
+    panel.sigma = 12;
+    panel.spikeChance = 0.05;
+    panel.spikeAmplitude = 800;
+
+    FilterError driver = driverError();
+    FilterError median1 = samplerError(makeConfig(1, 0));
+    FilterError median7 = samplerError(makeConfig(7, 0));
+    FilterError median7iir = samplerError(makeConfig(7, 1));
+    FilterError median7iir2 = samplerError(makeConfig(7, 2));
+
+    char msg[120];
+    TEST_MESSAGE("Blad polozenia w LSB (szum 12 LSB, 5% skokow do 800 LSB): RMS / max");
+    snprintf(msg, sizeof(msg), "XPT2046 besttwoavg (3 pomiary):  %6.1f / %d", driver.rms, driver.max);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "1 pomiar:                        %6.1f / %d", median1.rms, median1.max);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "mediana z 7:                     %6.1f / %d", median7.rms, median7.max);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "mediana z 7 + IIR 1/2:           %6.1f / %d", median7iir.rms, median7iir.max);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "mediana z 7 + IIR 1/4:           %6.1f / %d", median7iir2.rms, median7iir2.max);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_LESS_THAN(driver.rms, median7.rms);
+    TEST_ASSERT_LESS_THAN(driver.max, median7.max);
+    TEST_ASSERT_LESS_THAN(median7.rms, median7iir.rms);
+}
+
+void test_iir_lag_on_moving_finger() {
+    char msg[120];
+    TEST_MESSAGE("Opoznienie filtru przy ruchu 2000 LSB/s (ok. 150 px/s), bez szumu");
+    for (uint8_t shift = 0; shift <= 3; shift++) {
+        TouchSampler sampler(bus, TOUCH_CS_PIN, TOUCH_IRQ_PIN, makeConfig(7, shift));
+        settle(sampler);
+        panel.press(500, 2000);
+        ArduinoShim::fireInterrupt(TOUCH_IRQ_PIN);
+        int lag = 0;
+        for (int i = 0; i < 100; i++) {
+            uint16_t x = 500 + 20 * i; // 20 LSB na okres 10 ms
+            panel.press(x, 2000);
+            sampler.step();
+            TouchEvent event;
+            TEST_ASSERT_TRUE(sampler.read(event));
+            lag = x - event.x;
+            ArduinoShim::advanceMillis(10);
+        }
+        panel.release();
+        sampler.step();
+        snprintf(msg, sizeof(msg), "IIR 1/%d: %d LSB za palcem", 1 << shift, lag);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_EQUAL(20 * ((1 << shift) - 1), lag); // Stan ustalony filtru pierwszego rzędu
+    }
+}
+
+int main(int, char**) {
+    UNITY_BEGIN();
+    RUN_TEST(test_median_of_odd_and_even_counts);
+    RUN_TEST(test_iir_filter_starts_without_lag);
+    RUN_TEST(test_queue_is_fifo_and_counts_drops);
+    RUN_TEST(test_batch_is_one_spi_transaction);
+    RUN_TEST(test_idle_panel_waits_for_irq_without_spi);
+    RUN_TEST(test_press_move_and_release_events);
+    RUN_TEST(test_light_touch_keeps_sampling_without_events);
+    RUN_TEST(test_release_waits_for_queue_space);
+    RUN_TEST(test_noisy_stream_filter_accuracy);
+    RUN_TEST(test_iir_lag_on_moving_finger);
+    return UNITY_END();
+}